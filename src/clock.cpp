@@ -0,0 +1,7 @@
+#include "clock.h"
+
+#if CLOCK_VIRTUAL
+volatile uint64_t g_clockVirtUs = 0;
+
+void clockAdvanceUs(uint32_t us) { g_clockVirtUs = g_clockVirtUs + us; }
+#endif
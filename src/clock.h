@@ -0,0 +1,24 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+
+// Firmware time base: every module reads time through clockMs()/clockUs()
+// instead of millis()/micros(), so the clock can be shifted or replaced.
+// - CLOCK_START_MS moves the ms clock (wrap-around testing on the device).
+// - CLOCK_VIRTUAL=1 stops real time: the clock only moves when the harness
+//   calls clockAdvanceUs(), so days of loop() can run in seconds.
+// All timestamp maths must stay wrap-safe: (int32_t)(a - b) or now - t0.
+#if CLOCK_VIRTUAL
+  extern volatile uint64_t g_clockVirtUs;           // clock.cpp
+  inline uint32_t clockUs() { return (uint32_t)g_clockVirtUs; }
+  inline uint32_t clockMs() { return (uint32_t)CLOCK_START_MS + (uint32_t)(g_clockVirtUs / 1000U); }
+  void clockAdvanceUs(uint32_t us);
+  inline void clockAdvanceMs(uint32_t ms) { clockAdvanceUs(ms * 1000U); }
+#else
+  // Inline so the tach ISRs stay in IRAM
+  inline uint32_t clockUs() { return micros(); }
+  inline uint32_t clockMs() { return (uint32_t)CLOCK_START_MS + millis(); }
+#endif
+
+// Time since boot (uptime displays); wraps at 49.7 days like millis()
+inline uint32_t clockUptimeMs() { return clockMs() - (uint32_t)CLOCK_START_MS; }
@@ -25,6 +25,33 @@
 #ifndef USE_DALLAS
 #define USE_DALLAS 0
 #endif
+#ifndef USE_PROFILER
+#define USE_PROFILER 1 // per-subsystem loop-time histograms (modules/prof.h)
+#endif
+#ifndef USE_SNAPSHOT
+#define USE_SNAPSHOT 1 // boot shows the last host dashboard (RTC/NVS copy) instead of the splash
+#endif
+#ifndef SNAPSHOT_NVS_MS
+#define SNAPSHOT_NVS_MS 1800000UL // 30 min between flash copies (first one 30 min after boot)
+#endif
+#ifndef HEAPTRACE
+#define HEAPTRACE 0 // malloc/free counts per subsystem; also needs the --wrap link flags (platformio.ini)
+#endif
+#ifndef USE_LOG
+#define USE_LOG 1 // log ring (modules/logring.h); lines are only kept while /log or the host link reads
+#endif
+#ifndef LOG_CDC
+#define LOG_CDC 0 // also send log lines as 0x1E frames on the host link (host must skip/split them)
+#endif
+#ifndef LOG_RING_BYTES
+#define LOG_RING_BYTES 4096 // power of two
+#endif
+#ifndef LOG_LINE_MAX
+#define LOG_LINE_MAX 120 // one line incl. "<ms> <tag>: " and the newline
+#endif
+#ifndef LOG_HTTP_HOLD_MS
+#define LOG_HTTP_HOLD_MS 60000UL // /log keeps the ring recording this long after each request
+#endif
 
 // Pins
 #define PIN_EPD_CS 7
@@ -33,6 +60,46 @@
 #define PIN_EPD_BUSY 3
 #define PIN_ONEWIRE 8
 
+// ===== Dallas 1-Wire probes (intake / exhaust / PSU … on PIN_ONEWIRE) =====
+#ifndef DALLAS_MAX_PROBES
+#define DALLAS_MAX_PROBES 3 // ≤ MAX_LOCAL_TEMPS; extra probes on the bus are ignored
+#endif
+#ifndef DALLAS_CASE_PROBE
+#define DALLAS_CASE_PROBE 0 // probe (ROM order) that drives the fans; -1 = hottest valid probe
+#endif
+#ifndef DALLAS_SAMPLE_MS
+#define DALLAS_SAMPLE_MS 10000 // slow mode: one broadcast conversion per period
+#endif
+#ifndef DALLAS_RESOLUTION
+#define DALLAS_RESOLUTION 10 // slow mode bits; 10 = 0.25 °C in ~188 ms
+#endif
+// Fast mode while the case temperature moves or the fan controller is still
+// ramping: more samples at full resolution, back to slow once it is calm
+#ifndef DALLAS_FAST_MS
+#define DALLAS_FAST_MS 1500
+#endif
+#ifndef DALLAS_FAST_RESOLUTION
+#define DALLAS_FAST_RESOLUTION 12 // 0.0625 °C in ~750 ms
+#endif
+#ifndef DALLAS_FAST_DELTA_X100
+#define DALLAS_FAST_DELTA_X100 50 // case this far (°C×100) from its 1-min average → fast (~0.5 °C/min)
+#endif
+#ifndef DALLAS_FAST_FAN_PCT
+#define DALLAS_FAST_FAN_PCT 5 // fan command this far from the filtered output → fast
+#endif
+#ifndef DALLAS_FAST_HOLD_MS
+#define DALLAS_FAST_HOLD_MS 30000 // minimum stay in fast mode
+#endif
+#ifndef DALLAS_RESCAN_MS
+#define DALLAS_RESCAN_MS 60000 // ROM search for hot-plugged probes
+#endif
+#ifndef DALLAS_RMT
+#define DALLAS_RMT 0 // 1 = 1-Wire on the RMT peripheral (no interrupt masking; probes need VDD, no parasite power)
+#endif
+#ifndef DALLAS_FAIL_RESCAN
+#define DALLAS_FAIL_RESCAN 3 // consecutive failed reads of a probe → search at once
+#endif
+
 // ===== Touch / Button =====
 
 // Button polarity: 1 = active LOW (with INPUT_PULLUP), 0 = active HIGH (with INPUT_PULLDOWN)
@@ -55,6 +122,26 @@
 #ifndef TOUCH_ADVANCE_ARM_MS
 #define TOUCH_ADVANCE_ARM_MS 20000 // 20s: second press advances page
 #endif
+#ifndef TOUCH_VERY_LONG_MS
+#define TOUCH_VERY_LONG_MS 3500 // very long press: start fan calibration
+#endif
+
+// ===== loop() scheduler (modules/sched.h) =====
+#ifndef SCHED_MAX_JOBS
+#define SCHED_MAX_JOBS 8
+#endif
+#ifndef SCHED_SENSORS_MS
+#define SCHED_SENSORS_MS 20 // Dallas / tach windows / fan control (each keeps its own cadence inside)
+#endif
+#ifndef SCHED_UI_MS
+#define SCHED_UI_MS 250 // Debug refresh + AUTO rotation checks
+#endif
+#ifndef SCHED_IDLE_MAX_MS
+#define SCHED_IDLE_MAX_MS 100 // longest single idle wait
+#endif
+#ifndef SCHED_NET_IDLE_MS
+#define SCHED_NET_IDLE_MS 10 // idle cap while Wi-Fi is up (web server / OTA are polled)
+#endif
 
 // ===== Debug mode refresh =====
 #ifndef DEBUG_REFRESH_MS
@@ -75,6 +162,17 @@
 //#endif
 
 
+// ===== Time base (clock.h) =====
+#ifndef CLOCK_START_MS
+#define CLOCK_START_MS 0 // clockMs() at boot; e.g. 0xFFFF0000 runs the 49.7-day millis wrap ~65 s after boot
+#endif
+#ifndef CLOCK_VIRTUAL
+#define CLOCK_VIRTUAL 0 // 1 = time only moves via clockAdvanceUs() (host-side harness builds)
+#endif
+#if CLOCK_VIRTUAL && defined(ARDUINO_ARCH_ESP32)
+#error "CLOCK_VIRTUAL is for the native test env only: on the device it freezes clockUs() in the tach ISRs"
+#endif
+
 // Timings (ms)
 #define POLL_INTERVAL_MS 120000
 #define DISPLAY_INTERVAL_MS 5000
@@ -87,47 +185,67 @@
 #define RX_LINEBUF_BYTES 12288
 #define JSON_DOC_BYTES 24576
 
+// Host link: unanswered GETs are retried after SERIAL_RETRY_MS, doubling up to the max
+#ifndef SERIAL_RETRY_MS
+#define SERIAL_RETRY_MS 5000
+#endif
+#ifndef SERIAL_RETRY_MAX_MS
+#define SERIAL_RETRY_MAX_MS 60000
+#endif
+#ifndef SERIAL_PACE_MS
+#define SERIAL_PACE_MS 1000 // how often the GET pacing is checked
+#endif
+
 // Host timeout
 #ifndef LINK_TIMEOUT_S
 #define LINK_TIMEOUT_S 600 // consider the host "offline" if no JSON within this many seconds
 #endif
 
-// ===================== Fan 1 (PWM + tach) =====================
-#ifndef USE_FAN1
-#define USE_FAN1 1 // 0 => compile out fan1 modules
+// ===================== Fans (up to 4 channels) =================
+// Each channel is a row of compile-time constants (see modules/fans.h).
+// FANn_PWM_PIN  -1 = tach-only channel (no LEDC output)
+// FANn_TACH_PIN -1 = no tach (open loop only, not calibrated)
+// FANn_CURVE    index into the temperature curves below (0 = FC_PT*, 1 = FC2_PT*)
+// Defaults keep the original wiring: Fan1 PWM GPIO9 + tach GPIO5, Fan2 tach-only on GPIO0.
+#ifndef FAN_COUNT
+#define FAN_COUNT 2 // channels in use (1..4)
 #endif
+#ifndef FAN_PWM_FREQ_HZ
+#define FAN_PWM_FREQ_HZ 25000 // Intel 4-wire spec
+#endif
+#ifndef FAN_DEFAULT_PWM_PCT
+#define FAN_DEFAULT_PWM_PCT 50 // startup duty (%) until fan control takes over
+#endif
+
+// ---- Fan 1 ----
 #ifndef FAN1_PWM_PIN
 #define FAN1_PWM_PIN 9 // GPIO9 → transistor → fan PWM (open-collector)
 #endif
-#ifndef FAN1_PWM_FREQ_HZ
-#define FAN1_PWM_FREQ_HZ 25000 // Intel 4-wire spec
+#ifndef FAN1_TACH_PIN
+#define FAN1_TACH_PIN 5 // GPIO5 (tach input, pull-up to 3.3V)
 #endif
-#ifndef FAN1_DEFAULT_PWM_PCT
-#define FAN1_DEFAULT_PWM_PCT 50 // startup duty (%)
+#ifndef FAN1_PPR
+#define FAN1_PPR 2 // pulses per revolution
 #endif
 #ifndef FAN1_MIN_DUTY_PCT
 #define FAN1_MIN_DUTY_PCT 8 // Arctic P8 Slim: ≤5% → 0 rpm; margin
 #endif
-
-#ifndef FAN1_TACH_PIN
-#define FAN1_TACH_PIN 5 // GPIO5 (tach input, pull-up to 3.3V)
+#ifndef FAN1_MAX_RPM
+#define FAN1_MAX_RPM 3000 // RPM at 100% duty (Arctic P8 Slim ~3000)
 #endif
-#ifndef FAN1_PPR
-#define FAN1_PPR 2 // pulses per revolution
+#ifndef FAN1_CURVE
+#define FAN1_CURVE 0
 #endif
 #ifndef FAN1_TACH_WIN_MS
-#define FAN1_TACH_WIN_MS 500 // measurement window
+#define FAN1_TACH_WIN_MS 500 // longest measurement window (closes early at speed)
 #endif
 #ifndef FAN1_TACH_TIMEOUT_MS
 #define FAN1_TACH_TIMEOUT_MS 2000 // no pulses → 0 RPM
 #endif
-#ifndef FAN1_PWM_SET
-#define FAN1_PWM_SET(pct) fan1PwmSet(pct)
-#endif
 
-// ===================== Fan 2 (tach-only) ======================
-#ifndef USE_FAN2_TACH
-#define USE_FAN2_TACH 1 // 0 => compile out fan2 tach module
+// ---- Fan 2 ----
+#ifndef FAN2_PWM_PIN
+#define FAN2_PWM_PIN -1 // tach-only by default
 #endif
 #ifndef FAN2_TACH_PIN
 #define FAN2_TACH_PIN 0 // GPIO0 (strap pin) — INPUT_PULLUP is safe
@@ -135,17 +253,78 @@
 #ifndef FAN2_PPR
 #define FAN2_PPR 2
 #endif
+#ifndef FAN2_MIN_DUTY_PCT
+#define FAN2_MIN_DUTY_PCT FAN1_MIN_DUTY_PCT
+#endif
+#ifndef FAN2_MAX_RPM
+#define FAN2_MAX_RPM FAN1_MAX_RPM
+#endif
+#ifndef FAN2_CURVE
+#define FAN2_CURVE 0
+#endif
 #ifndef FAN2_TACH_WIN_MS
-#define FAN2_TACH_WIN_MS 500
+#define FAN2_TACH_WIN_MS 500 // longest measurement window
 #endif
 #ifndef FAN2_TACH_TIMEOUT_MS
 #define FAN2_TACH_TIMEOUT_MS 2000
 #endif
 
+// ---- Fan 3 ----
+#ifndef FAN3_PWM_PIN
+#define FAN3_PWM_PIN -1
+#endif
+#ifndef FAN3_TACH_PIN
+#define FAN3_TACH_PIN -1
+#endif
+#ifndef FAN3_PPR
+#define FAN3_PPR 2
+#endif
+#ifndef FAN3_MIN_DUTY_PCT
+#define FAN3_MIN_DUTY_PCT FAN1_MIN_DUTY_PCT
+#endif
+#ifndef FAN3_MAX_RPM
+#define FAN3_MAX_RPM FAN1_MAX_RPM
+#endif
+#ifndef FAN3_CURVE
+#define FAN3_CURVE 0
+#endif
+#ifndef FAN3_TACH_WIN_MS
+#define FAN3_TACH_WIN_MS 500
+#endif
+#ifndef FAN3_TACH_TIMEOUT_MS
+#define FAN3_TACH_TIMEOUT_MS 2000
+#endif
+
+// ---- Fan 4 ----
+#ifndef FAN4_PWM_PIN
+#define FAN4_PWM_PIN -1
+#endif
+#ifndef FAN4_TACH_PIN
+#define FAN4_TACH_PIN -1
+#endif
+#ifndef FAN4_PPR
+#define FAN4_PPR 2
+#endif
+#ifndef FAN4_MIN_DUTY_PCT
+#define FAN4_MIN_DUTY_PCT FAN1_MIN_DUTY_PCT
+#endif
+#ifndef FAN4_MAX_RPM
+#define FAN4_MAX_RPM FAN1_MAX_RPM
+#endif
+#ifndef FAN4_CURVE
+#define FAN4_CURVE 0
+#endif
+#ifndef FAN4_TACH_WIN_MS
+#define FAN4_TACH_WIN_MS 500
+#endif
+#ifndef FAN4_TACH_TIMEOUT_MS
+#define FAN4_TACH_TIMEOUT_MS 2000
+#endif
+
 // ===================== Experimental ===========================
 
 
-// ==== Fan control (Dallas-only) ====
+// ==== Fan control (Dallas-only, every channel with a PWM pin) ====
 #ifndef USE_FANCTRL
 #define USE_FANCTRL 1
 #endif
@@ -177,8 +356,93 @@
 #ifndef FAN_TICK_MS
 #define FAN_TICK_MS 200 // 5 Hz
 #endif
+// Slew limiting in the LEDC fade engine: each new duty is faded in at
+// FAN_RATE_PCT_PER_S, so ramps are smooth and keep going while loop() is
+// blocked (e-ink refresh). Fades are capped so a new target is taken at
+// least this often (IDF 4.4 cannot retarget a running fade).
+#ifndef FAN_HW_FADE
+#define FAN_HW_FADE 1
+#endif
+#ifndef FAN_HW_FADE_MAX_MS
+#define FAN_HW_FADE_MAX_MS 1000
+#endif
+
+// ==== Fan control: closed-loop RPM ====
+// 0 = open loop (curve duty → PWM)
+// 1 = curve duty is scaled to a target RPM (FANn_MAX_RPM) and a PI loop on
+//     the channel's tach drives the PWM (curve duty stays as feed-forward);
+//     channels without a tach stay open loop
+#ifndef FAN_CTRL_MODE
+#define FAN_CTRL_MODE 0
+#endif
+// PI gains in milli-units: Kp [%/rpm], Ki [%/(rpm*s)]. Defaults are sized for the
+// 500 ms tach window: ~1/3 of the plant inverse (1% ≈ 30 rpm) so the loop settles in a few windows.
+#ifndef FAN_PI_KP_MILLI
+#define FAN_PI_KP_MILLI 10
+#endif
+#ifndef FAN_PI_KI_MILLI
+#define FAN_PI_KI_MILLI 20
+#endif
+#ifndef FAN_PI_I_LIMIT_PCT
+#define FAN_PI_I_LIMIT_PCT 30 // integrator clamp (± duty %)
+#endif
 
-// Curve points (°C → duty %)
+// ==== Fan calibration sweep (duty → RPM, stored in NVS) ====
+#ifndef USE_FANCAL
+#define USE_FANCAL 1
+#endif
+#ifndef FANCAL_SETTLE_MS
+#define FANCAL_SETTLE_MS 3000 // per duty step (several tach windows)
+#endif
+#ifndef FANCAL_SPINUP_MS
+#define FANCAL_SPINUP_MS 8000 // time at 100% to find top speed / spin-up time
+#endif
+#ifndef FANCAL_STOP_MS
+#define FANCAL_STOP_MS 15000 // max wait for the fan to coast to 0 rpm
+#endif
+#ifndef FANCAL_ABORT_C
+#define FANCAL_ABORT_C 45 // abort (fan → 100%) if the case gets this warm
+#endif
+#ifndef FANCAL_MARGIN_PCT
+#define FANCAL_MARGIN_PCT 2 // added to measured stall/start duty when applied
+#endif
+
+// ==== Fan health monitor (stall / degraded / no tach → alert) ====
+// Channels with a PWM and a tach pin only. A fan that reads ~0 rpm while
+// driven gets one recovery kick; if it is still stopped the alert is raised
+// (e-ink alert page, /api/fan/health, "ALERT" line to the host).
+#ifndef USE_FANMON
+#define USE_FANMON 1
+#endif
+#ifndef FANMON_MIN_DUTY_PCT
+#define FANMON_MIN_DUTY_PCT 20 // below this a stopped fan is not judged (dead zone)
+#endif
+#ifndef FANMON_SETTLE_MS
+#define FANMON_SETTLE_MS 8000 // driven this long (no kick) before judging
+#endif
+#ifndef FANMON_STALL_RPM
+#define FANMON_STALL_RPM 100 // below this the fan counts as stopped
+#endif
+#ifndef FANMON_STALL_MS
+#define FANMON_STALL_MS 3000 // stopped this long → recovery kick
+#endif
+#ifndef FANMON_KICK_MS
+#define FANMON_KICK_MS 2000 // recovery kick at FAN_KICK_PCT
+#endif
+#ifndef FANMON_RECOVER_MS
+#define FANMON_RECOVER_MS 5000 // after the kick: still stopped → alert
+#endif
+#ifndef FANMON_RETRY_MS
+#define FANMON_RETRY_MS 60000 // kick again this often while the alert stands
+#endif
+#ifndef FANMON_DEGRADED_PCT
+#define FANMON_DEGRADED_PCT 60 // RPM below this share of the calibrated curve...
+#endif
+#ifndef FANMON_DEGRADED_MS
+#define FANMON_DEGRADED_MS 120000 // ...for this long → degraded (needs FanCal)
+#endif
+
+// Curve 0 points (°C → duty %)
 #ifndef FC_PT1_C
 #define FC_PT1_C 35
 #endif
@@ -210,19 +474,161 @@
 #define FC_PT5_P 100
 #endif
 
-// ---- Debug page fan visibility (compile-time) ----
-#ifndef DBG_SHOW_FAN1_PWM
-#define DBG_SHOW_FAN1_PWM 1
+// Curve 1 points (°C → duty %), for fans with FANn_CURVE=1 (default: quieter)
+#ifndef FC2_PT1_C
+#define FC2_PT1_C 38
+#endif
+#ifndef FC2_PT1_P
+#define FC2_PT1_P 0
+#endif
+#ifndef FC2_PT2_C
+#define FC2_PT2_C 42
+#endif
+#ifndef FC2_PT2_P
+#define FC2_PT2_P 12
+#endif
+#ifndef FC2_PT3_C
+#define FC2_PT3_C 47
+#endif
+#ifndef FC2_PT3_P
+#define FC2_PT3_P 20
+#endif
+#ifndef FC2_PT4_C
+#define FC2_PT4_C 52
+#endif
+#ifndef FC2_PT4_P
+#define FC2_PT4_P 40
+#endif
+#ifndef FC2_PT5_C
+#define FC2_PT5_C 57
+#endif
+#ifndef FC2_PT5_P
+#define FC2_PT5_P 100
+#endif
+
+// ==== Fan control: host inputs ====
+// Besides the case curve, each fan can follow the hottest active disk and the
+// host CPU load (both from the host frame). Host inputs count only while the
+// last accepted frame is younger than their stale timeout; with the link down
+// the controller is Dallas-only as before.
+#ifndef FAN_USE_DISK
+#define FAN_USE_DISK 1
+#endif
+#ifndef FAN_USE_CPU
+#define FAN_USE_CPU 1
+#endif
+#ifndef FAN_MIX_MODE
+#define FAN_MIX_MODE 0 // 0 = max of the valid inputs, 1 = weighted average
+#endif
+#ifndef FAN_W_CASE
+#define FAN_W_CASE 2 // weights for FAN_MIX_MODE=1
 #endif
-#ifndef DBG_SHOW_FAN1_RPM
-#define DBG_SHOW_FAN1_RPM 1
+#ifndef FAN_W_DISK
+#define FAN_W_DISK 1
 #endif
-#ifndef DBG_SHOW_FAN2_RPM
-#define DBG_SHOW_FAN2_RPM 1
+#ifndef FAN_W_CPU
+#define FAN_W_CPU 1
+#endif
+#ifndef FAN_DISK_STALE_MS
+#define FAN_DISK_STALE_MS 300000 // host frames come every POLL_INTERVAL_MS (2 min)
+#endif
+#ifndef FAN_CPU_STALE_MS
+#define FAN_CPU_STALE_MS 180000
+#endif
+
+// Feed-forward from host load trends: when load1 / CPU / net RX rise between
+// frames, a bounded extra duty is added so airflow starts before the case warms.
+// It decays linearly to 0 over FAN_FF_DECAY_MS unless the next frame renews it.
+#ifndef FAN_USE_FF
+#define FAN_USE_FF 1
+#endif
+#ifndef FAN_FF_MAX_PCT
+#define FAN_FF_MAX_PCT 20 // cap on the feed-forward term
+#endif
+#ifndef FAN_FF_DECAY_MS
+#define FAN_FF_DECAY_MS 240000 // ~2 frames
+#endif
+#ifndef FAN_FF_K_LOAD_X10
+#define FAN_FF_K_LOAD_X10 50 // duty % ×10 per +1.0 load1/min
+#endif
+#ifndef FAN_FF_K_CPU_X10
+#define FAN_FF_K_CPU_X10 5 // duty % ×10 per +1 CPU %-point/min
+#endif
+#ifndef FAN_FF_K_NET_X10
+#define FAN_FF_K_NET_X10 1 // duty % ×10 per +1 Mbit/s RX per min
+#endif
+
+// Disk curve (hottest active disk °C → duty %)
+#ifndef DK_PT1_C
+#define DK_PT1_C 38
+#endif
+#ifndef DK_PT1_P
+#define DK_PT1_P 0
+#endif
+#ifndef DK_PT2_C
+#define DK_PT2_C 42
+#endif
+#ifndef DK_PT2_P
+#define DK_PT2_P 15
+#endif
+#ifndef DK_PT3_C
+#define DK_PT3_C 46
+#endif
+#ifndef DK_PT3_P
+#define DK_PT3_P 30
+#endif
+#ifndef DK_PT4_C
+#define DK_PT4_C 50
+#endif
+#ifndef DK_PT4_P
+#define DK_PT4_P 60
+#endif
+#ifndef DK_PT5_C
+#define DK_PT5_C 55
+#endif
+#ifndef DK_PT5_P
+#define DK_PT5_P 100
+#endif
+
+// CPU curve (host CPU % → duty %)
+#ifndef CPU_PT1_L
+#define CPU_PT1_L 30
+#endif
+#ifndef CPU_PT1_P
+#define CPU_PT1_P 0
+#endif
+#ifndef CPU_PT2_L
+#define CPU_PT2_L 50
+#endif
+#ifndef CPU_PT2_P
+#define CPU_PT2_P 15
+#endif
+#ifndef CPU_PT3_L
+#define CPU_PT3_L 70
+#endif
+#ifndef CPU_PT3_P
+#define CPU_PT3_P 30
+#endif
+#ifndef CPU_PT4_L
+#define CPU_PT4_L 85
+#endif
+#ifndef CPU_PT4_P
+#define CPU_PT4_P 50
+#endif
+#ifndef CPU_PT5_L
+#define CPU_PT5_L 100
+#endif
+#ifndef CPU_PT5_P
+#define CPU_PT5_P 70
+#endif
+
+// ---- Debug page fan visibility (compile-time) ----
+#ifndef DBG_SHOW_FANS
+#define DBG_SHOW_FANS 1 // one "FanN  duty% rpm" line per channel
 #endif
 
 #ifndef DBG_SHOW_FAN_BLOCK
-#define DBG_SHOW_FAN_BLOCK 1 // master switch for FanCmd/FanOut/FanAct
+#define DBG_SHOW_FAN_BLOCK 1 // master switch for FanCmd/FanOut/FanAct (first PWM channel)
 #endif
 #ifndef DBG_SHOW_FAN_CMD
 #define DBG_SHOW_FAN_CMD 1
@@ -233,6 +639,13 @@
 #ifndef DBG_SHOW_FAN_ACT
 #define DBG_SHOW_FAN_ACT 1
 #endif
+#ifndef DBG_SHOW_FAN_STATS
+#define DBG_SHOW_FAN_STATS 0 // "FanSt  toggles/h kicks avg%" (tuning)
+#endif
+
+#ifndef DBG_SHOW_PROF
+#define DBG_SHOW_PROF 1 // "Loop  idle%  slowest subsystem max ms"
+#endif
 
 #ifndef DBG_SHOW_DALLAS
   #define DBG_SHOW_DALLAS 1
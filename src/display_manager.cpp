@@ -1,9 +1,11 @@
 #include "display_manager.h"
+#include "ui_theme.h"
 
 // ---------- ctor ----------
 // IMPORTANT: Construct GxEPD2_BW with a *panel* object, not raw pins.
 DisplayManager::DisplayManager()
 : _count(0),
+  _renderCount(0),
   _display(GxEPD2_154_D67(/*CS=*/7, /*DC=*/1, /*RST=*/2, /*BUSY=*/3))
 {}
 
@@ -69,6 +71,11 @@ int DisplayManager::mapUiIndexToReal(const UiState& ui) const {
 
 // ---------- render current page ----------
 void DisplayManager::renderCurrent(const HostState& host, const UiState& ui) {
+  if (_alert && ui.alertShown) {
+    renderPage(*_alert, host, ui);
+    return;
+  }
+
   uint8_t avail = pageCount(ui);
   if (avail == 0) return;
 
@@ -78,11 +85,18 @@ void DisplayManager::renderCurrent(const HostState& host, const UiState& ui) {
     const bool includeDbg = (ui.debugEnabled && DEBUG_IN_ROTATION);
     for (uint8_t i = 0; i < _count; ++i) {
       if (_pages[i].isDebug && !includeDbg) continue;
-      _pages[i].page->render(_display, host, ui);
+      renderPage(*_pages[i].page, host, ui);
       return;
     }
     return;
   }
 
-  _pages[real].page->render(_display, host, ui);
+  renderPage(*_pages[real].page, host, ui);
+}
+
+// ---------- render a specific page (also used for the Debug page) ----------
+void DisplayManager::renderPage(IPage& page, const HostState& host, const UiState& ui) {
+  ++_renderCount;
+  ui::setStale(ui.stale);
+  page.render(_display, host, ui);
 }
@@ -7,7 +7,40 @@
 #include <Fonts/FreeMonoBold9pt7b.h>
 
 // Panel/type alias: 200x200 SSD1681
-using Epd_t = GxEPD2_BW<GxEPD2_154_D67, GxEPD2_154_D67::HEIGHT>;
+using EpdBase_t = GxEPD2_BW<GxEPD2_154_D67, GxEPD2_154_D67::HEIGHT>;
+
+// GxEPD2_BW keeps its page buffer private, so we mirror every pixel write
+// into a 1bpp frame in *logical* (rotated) coordinates. Layout matches PBM P4:
+// rows of STRIDE bytes, MSB first, 1 = black. Used by /screen.pbm|bmp.
+class EpdMirror : public EpdBase_t {
+public:
+  static constexpr int16_t  FRAME_W     = GxEPD2_154_D67::WIDTH;
+  static constexpr int16_t  FRAME_H     = GxEPD2_154_D67::HEIGHT;
+  static constexpr uint16_t STRIDE      = (FRAME_W + 7) / 8;
+  static constexpr uint16_t FRAME_BYTES = STRIDE * FRAME_H;
+
+  explicit EpdMirror(const GxEPD2_154_D67& panel) : EpdBase_t(panel) {}
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    EpdBase_t::drawPixel(x, y, color);
+    if (x < 0 || y < 0 || x >= FRAME_W || y >= FRAME_H) return;
+    uint8_t& b = _frame[y * STRIDE + (x >> 3)];
+    const uint8_t m = 0x80 >> (x & 7);
+    if (color == GxEPD_WHITE) b &= ~m; else b |= m;
+  }
+
+  void fillScreen(uint16_t color) override {
+    EpdBase_t::fillScreen(color);
+    memset(_frame, color == GxEPD_WHITE ? 0x00 : 0xFF, sizeof(_frame));
+  }
+
+  const uint8_t* frame() const { return _frame; }
+
+private:
+  uint8_t _frame[FRAME_BYTES] = {0};
+};
+
+using Epd_t = EpdMirror;
 
 // Simple page interface
 struct IPage {
@@ -25,8 +58,12 @@ public:
   void   toast(const __FlashStringHelper* msg); // simple centered message
 
   void   registerPage(IPage* page, bool isDebug);
+  void   setAlertPage(IPage* page) { _alert = page; } // replaces the current page while ui.alertShown
   uint8_t pageCount(const UiState& ui) const;   // counts pages included in rotation
   void   renderCurrent(const HostState& host, const UiState& ui);
+  void   renderPage(IPage& page, const HostState& host, const UiState& ui); // any page, counted
+
+  uint32_t renderCount() const { return _renderCount; }  // full page renders since boot
 
   Epd_t& display();                              // access to underlying GxEPD2
 
@@ -36,6 +73,8 @@ private:
 
   Entry   _pages[MAX_PAGES];
   uint8_t _count;
+  uint32_t _renderCount;
+  IPage*  _alert = nullptr;
 
   // Map UiState.currentPage (filtered index) to actual index in _pages[]
   int     mapUiIndexToReal(const UiState& ui) const;
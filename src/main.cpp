@@ -13,6 +13,7 @@
 // Modules 
 #if USE_WIFI
   #include "modules/wifi_ota.h"
+  #include "modules/ota_stream.h"
   //static WifiOta WIFI;
 #endif
 
@@ -20,16 +21,18 @@
 #include "modules/dallas.h"
 #endif
 
-#if USE_FAN1
-#include "modules/fan1_pwm.h"
-#include "modules/fan1_tach.h"
-#endif
-#if USE_FAN2_TACH
-#include "modules/fan2_tach.h"
-#endif
+#include "modules/fans.h"
 #if USE_FANCTRL
 #include "modules/fanctrl.h"
 #endif
+#include "modules/fancal.h"
+#include "modules/fanmon.h"
+#include "modules/prof.h"
+#include "modules/sched.h"
+#include "modules/heaptrace.h"
+#include "modules/snapshot.h"
+#include "modules/logring.h"
+
 #if USE_EXPERIMENTAL
 #include "modules/experimental.h"
 #endif
@@ -40,6 +43,7 @@
 #include "pages/page_vms.h"
 #include "pages/page_network.h"
 #include "pages/page_debug.h"
+#include "pages/page_alert.h"
 
 #include <Fonts/FreeMono9pt7b.h>
 #include <Fonts/FreeMonoBold9pt7b.h>
@@ -64,21 +68,181 @@ PageDisks g_pageDisks;
 PageVMs g_pageVMs;
 PageNetwork g_pageNetwork;
 PageDebug g_pageDebug;
+PageAlert g_pageAlert;
 
 static uint32_t lastDisplayMs = 0; // rotation timer (0 means not started)
 static bool bootCleared = false;   // leave splash once first data arrives
+static uint32_t lastParseOk = 0;   // frames seen (snapshot + first live render)
+static SchedId tapJob = -1;        // commits a single tap once the double-tap window passed
+
+extern "C" void uiTriggerPageUpdate(void);
 
 // ---- helpers ----
 static inline void renderNow()
 {
+  PROF_SCOPE(PROF_RENDER);
+  HEAP_SCOPE(HEAP_RENDER);
   g_disp.renderCurrent(g_host, g_ui);
 }
 
 static inline void renderDebugDirect()
 {
-  auto &d = g_disp.display();
-  g_pageDebug.render(d, g_host, g_ui);
+  PROF_SCOPE(PROF_RENDER);
+  HEAP_SCOPE(HEAP_RENDER);
+  g_disp.renderPage(g_pageDebug, g_host, g_ui);
+}
+
+#if USE_DALLAS
+// Fan controller still converging on its command → sample the probes fast
+static bool fansSettling()
+{
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch)
+  {
+    const FanTelemetry &t = g_host.fan[ch];
+    if (!isnan(t.duty_cmd) && fabsf(t.duty_cmd - t.duty_filt) >= DALLAS_FAST_FAN_PCT) return true;
+  }
+  return false;
 }
+#endif
+
+// Local sensors + fan control (shared by loop() and the upload service hook)
+static void tickSensorsAndFans()
+{
+#if USE_DALLAS
+  {
+    PROF_SCOPE(PROF_DALLAS);
+    g_dallas.tick(fansSettling());
+  }
+  static uint32_t dallasSeq = 0;
+  if (g_dallas.sampleSeq() != dallasSeq)
+  {
+    dallasSeq = g_dallas.sampleSeq();
+    auto same = [](float a, float b) { return a == b || (isnan(a) && isnan(b)); };
+    bool changed = g_host.local_temp_count != g_dallas.count();
+    for (uint8_t i = 0; i < MAX_LOCAL_TEMPS; ++i)
+    {
+      changed |= !same(g_host.local_temps_c[i], g_dallas.tempC(i));
+      g_host.local_temps_c[i] = g_dallas.tempC(i);
+    }
+    g_host.local_temp_c     = g_dallas.lastC();
+    g_host.local_temp_count = g_dallas.count();
+    if (changed) g_ui.stateGen++;
+  }
+#endif
+  {
+    PROF_SCOPE(PROF_TACH);
+    fansTick();
+  }
+  PROF_SCOPE(PROF_FANCTRL);
+  fanCalTick(g_host);
+#if USE_FANCTRL
+  fanCtrlTick(g_host, g_ui);
+#endif
+  fanMonTick(g_host);
+}
+
+// Fan faults: report every change upstream; a new fault takes over the
+// panel (also out of Debug mode), all clear gives it back
+static void handleFanAlerts()
+{
+  const uint8_t changed = fanMonTakeChanges();
+  if (!changed) return;
+
+  bool raised = false;
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch)
+  {
+    if (!(changed & (1u << ch))) continue;
+    const uint8_t f = g_host.fan[ch].fault;
+    g_serial.sendAlert(ch + 1, fanFaultName(f), fanPwmGetPercent(ch), fanTachGetRPM(ch));
+    LOGF("fan", "fan%u %s duty=%u rpm=%d", (unsigned)(ch + 1), fanFaultName(f),
+         (unsigned)fanPwmGetPercent(ch), fanTachGetRPM(ch));
+    if (f != FAN_OK) raised = true;
+  }
+  g_ui.stateGen++;
+
+  if (raised)
+  {
+    g_ui.alertShown  = true;
+    g_ui.inDebugMode = false;
+    renderNow();
+  }
+  else if (g_ui.alertShown && !fanMonAnyFault(g_host))
+  {
+    g_ui.alertShown = false;
+    renderNow();
+  }
+}
+
+#if USE_WIFI
+// Firmware uploads (HTTP and ArduinoOTA) run inside a single handler call;
+// they call this between flash-write slices so fan control, Dallas sampling
+// and host ingest keep their cadence. No page rendering except Debug, which
+// shows the upload progress.
+void otaServiceCriticalTasks()
+{
+  static bool busy = false;
+  if (busy) return;
+  busy = true;
+
+  g_serial.tick(g_host, g_ui);
+  tickSensorsAndFans();
+
+  if (g_ui.inDebugMode && clockMs() - g_ui.lastDebugRefresh >= DEBUG_REFRESH_MS)
+  {
+    renderDebugDirect();
+    g_ui.lastDebugRefresh = clockMs();
+  }
+  busy = false;
+}
+#endif
+
+// ---- scheduled jobs ----
+static void jobSensors()
+{
+  tickSensorsAndFans();
+  handleFanAlerts();
+}
+
+static void jobPoll()
+{
+  g_serial.pollHost();
+}
+
+static void jobTapCommit()
+{
+  if (!g_ui.tapPending) return;    // cancelled by a double/long press
+  g_ui.tapPending = false;
+  uiTriggerPageUpdate();
+}
+
+static void jobUi()
+{
+  // --- Periodic refresh in dedicated Debug mode
+  if (g_ui.inDebugMode)
+  {
+    uint32_t nowDbg = clockMs();
+    if (nowDbg - g_ui.lastDebugRefresh >= DEBUG_REFRESH_MS)
+    {
+      renderDebugDirect();
+      g_ui.lastDebugRefresh = nowDbg;
+    }
+  }
+
+  // --- Auto mode page rotation (paused in debug mode)
+  uint32_t now = clockMs();
+  if (!g_ui.inDebugMode && g_ui.mode == MODE_AUTO &&
+      (lastDisplayMs != 0) && (now - lastDisplayMs >= DISPLAY_INTERVAL_MS))
+  {
+    lastDisplayMs = now;
+    renderNow();
+    uint8_t n = g_disp.pageCount(g_ui);
+    g_ui.currentPage = (n == 0) ? 0 : (g_ui.currentPage + 1) % n;
+    g_ui.stateGen++;
+  }
+}
+
+// Button edges wake the idle wait; poll() still does the debouncing
+static void IRAM_ATTR onTouchEdge() { schedWakeFromISR(); }
 
 // ---- splash ----
 static void splash()
@@ -135,20 +299,28 @@ static void splash()
 
 extern "C" void uiTriggerPageUpdate(void)
 {
-  // Mirror the "commit pending single-tap" branch from loop()
-  if (!g_ui.inDebugMode)
+  // Single-tap action (committed by jobTapCommit; C linkage for external triggers)
+  if (g_ui.alertShown)
   {
-    if (millis() > g_ui.advanceArmUntilMs)
+    g_ui.alertShown = false; // dismiss; faults stay on Debug/web until cleared
+    g_ui.stateGen++;
+    renderNow();
+  }
+  else if (!g_ui.inDebugMode)
+  {
+    // 0 = disarmed; otherwise armed until the deadline (wrap-safe)
+    if (!g_ui.advanceArmUntilMs || schedDue(clockMs(), g_ui.advanceArmUntilMs))
     {
       // First tap: refresh current page & arm the advance window
       renderNow();
-      g_ui.advanceArmUntilMs = millis() + TOUCH_ADVANCE_ARM_MS; // e.g., 20s
+      g_ui.advanceArmUntilMs = clockMs() + TOUCH_ADVANCE_ARM_MS; // e.g., 20s
     }
     else
     {
       // Second tap inside the advance window: advance page & disarm
       uint8_t n = g_disp.pageCount(g_ui);
       g_ui.currentPage = (n == 0) ? 0 : (g_ui.currentPage + 1) % n;
+      g_ui.stateGen++;
       renderNow();
       g_ui.advanceArmUntilMs = 0;
     }
@@ -158,11 +330,15 @@ extern "C" void uiTriggerPageUpdate(void)
 // ======================= setup =======================
 void setup()
 {
+  heapTraceBegin(); // loop task = this task
   #if USE_WIFI
   wifiOtaSetup();
 #endif
   // USB CDC (no debug prints — Serial is for host protocol)
   Serial.setRxBufferSize(8192);
+#if USE_LOG && LOG_CDC
+  Serial.setTxBufferSize(1024);     // log frames share the link
+#endif
   Serial.begin(115200);
   Serial.setRxBufferSize(8192);
 
@@ -174,18 +350,9 @@ void setup()
 #if USE_DALLAS
   g_dallas.begin();
 #endif
-#if USE_FAN1
-  fan1PwmBegin();
-  fan1TachBegin();
-#endif
-#if USE_FAN2_TACH
-  fan2TachBegin();
-#endif
-#if USE_FAN1
-  fan1PwmBegin();
-  fan1TachBegin();
-#endif
+  fansBegin();
 
+  fanCalBegin(); // before fanCtrlBegin(): it applies the stored calibration
 #if USE_FANCTRL
   fanCtrlBegin();
 #endif
@@ -199,53 +366,99 @@ void setup()
   g_disp.registerPage(&g_pageVMs, /*isDebug*/ false);
   g_disp.registerPage(&g_pageNetwork, /*isDebug*/ false);
   g_disp.registerPage(&g_pageDebug, /*isDebug*/ true); // not in normal rotation
+  g_disp.setAlertPage(&g_pageAlert);                    // fan faults, outside the rotation
 
-  splash();
+  // Last known dashboard (marked stale) instead of the splash when we have one
+  if (snapshotRestore(g_host, g_ui))
+  {
+    g_ui.stale = true;
+    renderNow();
+    g_ui.bootPixelsMs = clockUptimeMs();
+    bootCleared = true;
+    lastDisplayMs = clockMs();
+  }
+  else
+  {
+    splash();
+  }
 
   g_serial.begin(); // sends INFO once
   // NOTE: do NOT set lastDisplayMs here; we start it when first data arrives
+
+  // Periodic work; loop() sleeps between deadlines. USB RX, the button and
+  // Wi-Fi events wake it early.
+  schedEvery(SCHED_SENSORS_MS, jobSensors);
+  schedEvery(SERIAL_PACE_MS, jobPoll); // the client paces GETs (poll period / backoff)
+  schedEvery(SCHED_UI_MS, jobUi);
+  tapJob = schedOnce(jobTapCommit);
+#if HEAPTRACE
+  schedEvery(1000, heapTraceSample);
+#endif
+#if USE_LOG
+  schedEvery(1000, logTick);
+#endif
+  attachInterrupt(digitalPinToInterrupt(TOUCH_PIN), onTouchEdge, CHANGE);
+#if ARDUINO_USB_MODE && ARDUINO_USB_CDC_ON_BOOT
+  Serial.onEvent(ARDUINO_HW_CDC_RX_EVENT, [](void*, esp_event_base_t, int32_t, void*) { schedWake(); });
+#endif
 }
 
 // ======================= loop =======================
-void loop()
+// Event-driven part: web/OTA, host RX, due jobs, touch
+static void loopWork()
 {
   #if USE_WIFI
   // Keep OTA responsive; cheap call, safe when not connected
-  wifiOtaLoop();
+  {
+    PROF_SCOPE(PROF_WIFI);
+    HEAP_SCOPE(HEAP_WEB);
+    wifiOtaLoop();
+  }
 #endif
-  // --- Host serial client (read, parse, poll GET interval)
-  g_serial.tick(g_host, g_ui);
+  // --- Host serial client (read, parse)
+  {
+    PROF_SCOPE(PROF_SERIAL);
+    HEAP_SCOPE(HEAP_INGEST);
+    g_serial.tick(g_host, g_ui);
+  }
+
+  // --- New host frame: refresh the snapshot; the first one after boot
+  // replaces the stale (or empty) view right away
+  if (g_ui.parseOkCount != lastParseOk)
+  {
+    lastParseOk = g_ui.parseOkCount;
+    snapshotSave(g_host, g_ui);
+    if (!g_ui.bootLiveMs)
+    {
+      g_ui.stale = false;
+      g_ui.stateGen++;
+      if (!g_ui.inDebugMode) renderNow();
+      g_ui.bootLiveMs = clockUptimeMs();
+      if (!g_ui.bootPixelsMs) g_ui.bootPixelsMs = g_ui.bootLiveMs;
+    }
+  }
 
   // Leave splash automatically once first valid data arrives (Option B)
   if (!bootCleared) // && g_ui.firstDataReady
   {
     bootCleared = true;
-    lastDisplayMs = millis(); // start auto-rotation timer now
-    renderNow();              // show first real page
+    lastDisplayMs = clockMs(); // start auto-rotation timer now
+    if (!g_ui.bootLiveMs) renderNow(); // show first real page (unless a frame just did)
   }
 
-
-
-#if USE_DALLAS
-  g_dallas.tick();
-  g_host.local_temp_c = g_dallas.lastC();
-#endif
-#if USE_FAN1
-  fan1TachTick();
-#endif
-#if USE_FAN2_TACH
-  fan2TachTick();
-#endif
-#if USE_FANCTRL
-  fanCtrlTick(g_host);
-#endif
+  // --- Due jobs: sensors/fans, GET poll, Debug refresh, rotation, tap commit
+  schedRun();
 
 #if USE_EXPERIMENTAL
   experimentalTick(g_ui);
 #endif
 
   // --- Handle touch events (non-blocking to allow double-tap)
-  ButtonEvent ev = g_touch.poll();
+  ButtonEvent ev;
+  {
+    PROF_SCOPE(PROF_TOUCH);
+    ev = g_touch.poll();
+  }
 
   if (ev == ButtonEvent::DoubleTap)
   {
@@ -254,6 +467,7 @@ void loop()
 
     // Toggle dedicated Debug mode (not part of normal rotation)
     g_ui.inDebugMode = !g_ui.inDebugMode;
+    g_ui.stateGen++;
     g_ui.lastDebugRefresh = 0; // force immediate refresh
 
     // Render immediately: Debug page directly, or normal page via DM
@@ -273,6 +487,7 @@ void loop()
 
     // Toggle TOUCH/AUTO mode
     g_ui.mode = (g_ui.mode == MODE_TOUCH) ? MODE_AUTO : MODE_TOUCH;
+    g_ui.stateGen++;
 
     // Re-render current view (Debug or normal)
     if (g_ui.inDebugMode)
@@ -284,60 +499,36 @@ void loop()
       renderNow();
     }
   }
+  else if (ev == ButtonEvent::VeryLongPress)
+  {
+    // Fan characterization sweep (~1.5 min); progress shows on the Debug page
+    g_ui.tapPending = false;
+    fanCalStart();
+    g_disp.toast(F("Fan calibration"));
+  }
   else if (ev == ButtonEvent::Tap)
   {
     if (!g_ui.inDebugMode)
     {
       // Defer single-tap action until double-tap window expires (prevents e-ink blocking)
       g_ui.tapPending = true;
-      g_ui.tapDeadlineMs = millis() + TOUCH_DBL_MS; // e.g., 350 ms
-    }
-  }
-
-  // --- Commit pending single-tap after double-tap window passes
-  if (g_ui.tapPending && (int32_t)(millis() - g_ui.tapDeadlineMs) >= 0)
-  {
-    g_ui.tapPending = false;
-
-    // In normal mode: first tap = refresh, second within ADVANCE window = advance
-    if (!g_ui.inDebugMode)
-    {
-      if (millis() > g_ui.advanceArmUntilMs)
-      {
-        // First tap: refresh current page & arm the advance window
-        renderNow();
-        g_ui.advanceArmUntilMs = millis() + TOUCH_ADVANCE_ARM_MS; // e.g., 20s
-      }
-      else
-      {
-        // Second tap inside the advance window: advance page & disarm
-        uint8_t n = g_disp.pageCount(g_ui);
-        g_ui.currentPage = (n == 0) ? 0 : (g_ui.currentPage + 1) % n;
-        renderNow();
-        g_ui.advanceArmUntilMs = 0;
-      }
-    }
-  }
-
-  // --- Periodic refresh in dedicated Debug mode
-  if (g_ui.inDebugMode)
-  {
-    uint32_t nowDbg = millis();
-    if (nowDbg - g_ui.lastDebugRefresh >= DEBUG_REFRESH_MS)
-    {
-      renderDebugDirect();
-      g_ui.lastDebugRefresh = nowDbg;
+      schedArm(tapJob, TOUCH_DBL_MS);
     }
   }
+}
 
-  // --- Auto mode page rotation (paused in debug mode)
-  uint32_t now = millis();
-  if (!g_ui.inDebugMode && g_ui.mode == MODE_AUTO &&
-      (lastDisplayMs != 0) && (now - lastDisplayMs >= DISPLAY_INTERVAL_MS))
+// Work, then sleep until the next job deadline (or a wake-up)
+void loop()
+{
+  profLoopMark();
+  heapTraceLoopMark();
   {
-    lastDisplayMs = now;
-    renderNow();
-    uint8_t n = g_disp.pageCount(g_ui);
-    g_ui.currentPage = (n == 0) ? 0 : (g_ui.currentPage + 1) % n;
+    PROF_SCOPE(PROF_LOOP);
+    loopWork();
   }
+#if USE_WIFI
+  schedIdle(wifiOtaConnected() ? SCHED_NET_IDLE_MS : SCHED_IDLE_MAX_MS);
+#else
+  schedIdle(SCHED_IDLE_MAX_MS);
+#endif
 }
@@ -1,35 +1,229 @@
 #include <Arduino.h>
-#include <OneWire.h>
-#include <DallasTemperature.h>
+#include <OneWire.h>                   // crc8 (and the bit-banged bus)
 #include "config.h"
 #include "modules/dallas.h"
 
+// Bus backend: OneWire bit-banging (masks interrupts per slot, parasite power
+// supported) or the RMT driver (DALLAS_RMT, interrupts stay on)
+#if DALLAS_RMT
+#include "modules/onewire_rmt.h"
+static OneWireRmt oneWire(PIN_ONEWIRE);
+#else
+#include <DallasTemperature.h>
 static OneWire oneWire(PIN_ONEWIRE);
 static DallasTemperature dallas(&oneWire);
+#endif
+
+static constexpr uint8_t kConvertT     = 0x44;
+static constexpr uint8_t kReadScratch  = 0xBE;
+static constexpr uint8_t kWriteScratch = 0x4E;
+
+static void startConversion() {
+#if DALLAS_RMT
+  if (!oneWire.reset()) return;
+  oneWire.skip();
+  oneWire.write(kConvertT);
+#else
+  dallas.requestTemperatures();        // SKIP ROM + convert (strong pull-up if parasite)
+#endif
+}
+
+static uint32_t convMs(uint8_t bits) { return 94UL << (bits - 9); }  // 94/188/375/750 ms
+
+static float median3(const float* h, uint8_t n) {
+  if (n < 3) return h[(n + 2) % 3];                 // newest until the window is full
+  const float a = h[0], b = h[1], c = h[2];
+  return fmaxf(fminf(a, b), fminf(fmaxf(a, b), c));
+}
+
+static bool supportedFamily(uint8_t f) {
+  return f == 0x28 || f == 0x22 || f == 0x3B || f == 0x10;  // DS18B20, DS1822, MAX31850, DS18S20
+}
+
+// Resolution in scratchpad byte 4, set by WRITE SCRATCHPAD. The DS18S20 is
+// fixed at 9 bit; the MAX31850 has no WRITE SCRATCHPAD and its byte 4 holds
+// the AD pin strapping.
+static bool hasConfigReg(uint8_t f) { return f == 0x28 || f == 0x22; }
+
+static uint8_t configBits(uint8_t reg) { return (uint8_t)(9 + ((reg >> 5) & 3)); }
 
 void DallasProbe::begin() {
+#if DALLAS_RMT
+  oneWire.begin();
+#else
   dallas.begin();
-  dallas.setResolution(10);            // 10-bit ~187ms (good compromise)
   dallas.setWaitForConversion(false);  // non-blocking
+#endif
+  startScan();
+  while (scanning_) scanStep();        // boot: complete list before the first sample
+}
+
+// Scratchpad write only (no COPY SCRATCHPAD): no EEPROM wear and no 10 ms
+// copy time, so the resolution can follow the mode.
+void DallasProbe::writeConfig(Probe& p, uint8_t bits) {
+  if (!hasConfigReg(p.rom[0]) || !p.haveSp) return;
+  if (!oneWire.reset()) return;
+  oneWire.select(p.rom);
+  oneWire.write(kWriteScratch);
+  oneWire.write(p.th);
+  oneWire.write(p.tl);
+  oneWire.write((uint8_t)(((bits - 9) << 5) | 0x1F));
+}
+
+void DallasProbe::setResolution(uint8_t bits) {
+  for (uint8_t i = 0; i < count_; ++i) writeConfig(p_[i], bits);
+}
+
+// Fast while the case value runs away from its slow average (a ramp of
+// ~DALLAS_FAST_DELTA_X100/100 °C per minute) or the fans are still moving
+void DallasProbe::adapt(bool fanBusy, uint32_t now) {
+  const float c = caseC();
+  if (!isnan(c)) {
+    if (isnan(baseC_)) baseC_ = c;
+    const float k = fminf(1.0f, (float)(now - baseMs_) / 60000.0f);
+    baseC_ += (c - baseC_) * k;
+  }
+  baseMs_ = now;
+
+  const float dev = isnan(c) ? 0.0f : fabsf(c - baseC_) * 100.0f;
+  const bool  hot = fanBusy || dev >= DALLAS_FAST_DELTA_X100;
+  if (hot) fastSince = now;
+
+  const bool want = hot || (fast_ && now - fastSince < DALLAS_FAST_HOLD_MS);
+  if (want != fast_) {
+    fast_ = want;
+    setResolution(fast_ ? DALLAS_FAST_RESOLUTION : DALLAS_RESOLUTION);
+  }
+}
+
+// ROM search, one device per call so a rescan never stalls loop() for the
+// whole bus; probes that are still present keep their error counters
+void DallasProbe::startScan() {
+  oneWire.reset_search();
+  scanN_    = 0;
+  scanning_ = true;
+  rescan_   = false;
+}
+
+void DallasProbe::scanStep() {
+  uint8_t addr[8];
+  if (scanN_ < DALLAS_MAX_PROBES && oneWire.search(addr)) {
+    if (OneWire::crc8(addr, 7) != addr[7] || !supportedFamily(addr[0])) return;
+    Probe& p = scan_[scanN_++];
+    p = Probe();
+    memcpy(p.rom, addr, sizeof(p.rom));
+    for (uint8_t i = 0; i < count_; ++i) {
+      if (memcmp(p_[i].rom, addr, sizeof(addr)) == 0) { p = p_[i]; p.failRun = 0; return; }
+    }
+    // Hot-plugged (or boot): learn TH/TL from the scratchpad, set the mode's resolution
+    uint8_t sp[9];
+    readScratch(p, sp);
+    return;
+  }
+  for (uint8_t i = 0; i < scanN_; ++i) p_[i] = scan_[i];
+  count_     = scanN_;
+  lastScanMs = clockMs();
+  scanning_  = false;
+}
+
+// Addressed scratchpad read with our own CRC check (library reads hide why they failed).
+// A probe that lost power since the last write is back at its EEPROM
+// resolution: its value was converted at a different resolution than we
+// waited for, so the config is written again and the sample is dropped.
+bool DallasProbe::readScratch(Probe& p, uint8_t* sp) {
+  if (!oneWire.reset()) { p.missing++; return false; }
+  oneWire.select(p.rom);
+  oneWire.write(kReadScratch);
+  for (uint8_t i = 0; i < 9; ++i) sp[i] = oneWire.read();
+  if (OneWire::crc8(sp, 8) != sp[8]) { p.crcErr++; return false; }  // also catches all-0xFF (gone mid-read)
+  p.th     = sp[2];
+  p.tl     = sp[3];
+  p.haveSp = true;
+  const uint8_t bits = fast_ ? DALLAS_FAST_RESOLUTION : DALLAS_RESOLUTION;
+  if (hasConfigReg(p.rom[0]) && configBits(sp[4]) != bits) {
+    writeConfig(p, bits);
+    return false;
+  }
+  return true;
+}
+
+bool DallasProbe::readProbe(Probe& p, float& c) {
+  uint8_t sp[9];
+  if (!readScratch(p, sp)) return false;
+
+  int16_t raw = (int16_t)((sp[1] << 8) | sp[0]);
+  if (p.rom[0] == 0x3B) {
+    // MAX31850: 14-bit thermocouple value in bits 15..2, bit 0 = fault (open/short)
+    if (raw & 1) { p.missing++; return false; }
+    c = (int16_t)(raw & ~3) / 16.0f;
+    return true;
+  }
+  if (p.rom[0] == 0x10) {
+    // DS18S20: 0.5 °C register + COUNT_REMAIN/COUNT_PER_C for the fraction (1/16 °C units)
+    raw = (int16_t)((raw & ~1) * 8 - 4 + ((sp[7] - sp[6]) << 4) / (sp[7] ? sp[7] : 16));
+  }
+  if (raw == 0x0550) { p.missing++; return false; }   // 85.0 °C power-on value: no conversion happened
+  c = raw / 16.0f;
+  return true;
+}
+
+float DallasProbe::caseC() const {
+#if DALLAS_CASE_PROBE < 0
+  float hot = NAN;
+  for (uint8_t i = 0; i < count_; ++i) {
+    if (!isnan(p_[i].c) && (isnan(hot) || p_[i].c > hot)) hot = p_[i].c;
+  }
+  return hot;
+#else
+  return tempC(DALLAS_CASE_PROBE);
+#endif
+}
+
+void DallasProbe::tick(bool fanBusy) {
+  const uint32_t t0 = clockUs();
+  step(fanBusy);
+  const uint32_t us = clockUs() - t0;
+  busyUs_ += us;
+  if (us > maxStepUs_) maxStepUs_ = us;
 }
 
-void DallasProbe::tick() {
-  uint32_t now = millis();
+void DallasProbe::step(bool fanBusy) {
+  uint32_t now = clockMs();
 
-  // sample every 10s
+  // sample every DALLAS_SAMPLE_MS (slow) / DALLAS_FAST_MS (fast); the bus is
+  // free between conversions, so search there (one ROM per tick)
   if (state == IDLE) {
-    if (now - lastSampleMs >= 10000) {
-      dallas.requestTemperatures();    // start conversion (returns immediately)
+    if (scanning_) { scanStep(); return; }
+    if (rescan_ || now - lastScanMs >= DALLAS_RESCAN_MS) { startScan(); return; }
+    if (fanBusy && !fast_) adapt(true, now);     // don't sit out a slow period
+    if (now - lastSampleMs >= (fast_ ? DALLAS_FAST_MS : DALLAS_SAMPLE_MS)) {
+      startConversion();               // SKIP ROM + convert: every probe at once
       tStart = now;
       state = CONVERTING;
     }
     return;
   }
 
-  // CONVERTING -> read after typical conversion time
+  // CONVERTING -> read each cached ROM after the conversion time
   if (state == CONVERTING) {
-    if (now - tStart >= 200) {         // >187ms for 10-bit
-      lastC_ = dallas.getTempCByIndex(0);
+    const uint8_t bits = fast_ ? DALLAS_FAST_RESOLUTION : DALLAS_RESOLUTION;
+    if (now - tStart >= convMs(bits) + 10) {
+      for (uint8_t i = 0; i < count_; ++i) {
+        Probe& p = p_[i];
+        float c;
+        if (readProbe(p, c)) {
+          p.failRun = 0;
+          p.hist[p.histN % 3] = c;
+          if (++p.histN >= 6) p.histN = 3;     // stay "full", keep the ring index cycling
+          p.c = median3(p.hist, p.histN);
+        } else {
+          p.c = NAN;
+          if (++p.failRun >= DALLAS_FAIL_RESCAN) rescan_ = true;  // unplugged / replaced
+        }
+      }
+      lastC_ = caseC();
+      adapt(fanBusy, now);
+      seq_++;
       lastSampleMs = now;
       state = IDLE;
     }
@@ -1,14 +1,72 @@
 #pragma once
 #include <Arduino.h>
+#include "config.h"
+#include "state.h"
 
+static_assert(DALLAS_MAX_PROBES <= MAX_LOCAL_TEMPS, "DALLAS_MAX_PROBES > MAX_LOCAL_TEMPS");
+
+// All DS18x20 probes on PIN_ONEWIRE. ROM codes are found once (boot, every
+// DALLAS_RESCAN_MS, or when a probe stops answering) and cached; each sample
+// is one broadcast conversion followed by an addressed, CRC-checked read.
+// Cadence/resolution adapt (slow 10 s @ DALLAS_RESOLUTION, fast @ 12 bit);
+// every probe reports the median of its last three good reads.
 class DallasProbe {
 public:
   void begin();
-  void tick();                 // non-blocking
-  float lastC() const { return lastC_; }
+  void tick(bool fanBusy = false);  // non-blocking; fanBusy: controller still ramping → fast mode
+  bool fastMode() const { return fast_; }
+  float lastC() const { return lastC_; }           // case probe (DALLAS_CASE_PROBE)
+
+  uint8_t  count() const { return count_; }
+  float    tempC(uint8_t i) const { return i < count_ ? p_[i].c : NAN; }
+  uint32_t crcErrors(uint8_t i) const { return i < count_ ? p_[i].crcErr : 0; }
+  uint32_t missing(uint8_t i) const { return i < count_ ? p_[i].missing : 0; } // no presence / no conversion
+  const uint8_t* rom(uint8_t i) const { return i < count_ ? p_[i].rom : nullptr; }
+  uint32_t sampleSeq() const { return seq_; }      // bumped after every read-out
+  uint32_t busyMs() const { return (uint32_t)(busyUs_ / 1000); } // time spent in tick() (bus I/O), total
+  uint32_t maxStepUs() const { return maxStepUs_; } // longest single tick() since boot
+
 private:
-  float lastC_ = NAN;
+  struct Probe {
+    uint8_t  rom[8]  = {0};
+    float    c       = NAN;
+    uint32_t crcErr  = 0;
+    uint32_t missing = 0;
+    uint8_t  failRun = 0;      // consecutive failed reads
+    float    hist[3] = {NAN, NAN, NAN}; // last good reads (median-of-3)
+    uint8_t  histN   = 0;
+    uint8_t  th = 0, tl = 0;   // user bytes from the scratchpad, rewritten with the resolution
+    bool     haveSp  = false;
+  };
+
+  Probe    p_[DALLAS_MAX_PROBES];
+  uint8_t  count_ = 0;
+  float    lastC_ = NAN;
+  uint32_t seq_   = 0;
   enum { IDLE, CONVERTING } state = IDLE;
   uint32_t tStart = 0;
   uint32_t lastSampleMs = 0;
+  uint32_t lastScanMs = 0;
+  bool     rescan_ = false;
+  bool     scanning_ = false;
+  Probe    scan_[DALLAS_MAX_PROBES];   // list being built by the running search
+  uint8_t  scanN_  = 0;
+  uint64_t busyUs_ = 0;
+  uint32_t maxStepUs_ = 0;
+
+  // adaptive sampling
+  bool     fast_     = false;
+  uint32_t fastSince = 0;      // last reason to be fast
+  float    baseC_    = NAN;    // ~1 min average of the case value
+  uint32_t baseMs_   = 0;
+
+  void  step(bool fanBusy);
+  void  startScan();
+  void  scanStep();
+  bool  readScratch(Probe& p, uint8_t* sp);
+  bool  readProbe(Probe& p, float& c);
+  void  writeConfig(Probe& p, uint8_t bits);
+  float caseC() const;
+  void  setResolution(uint8_t bits);
+  void  adapt(bool fanBusy, uint32_t now);
 };
@@ -0,0 +1,265 @@
+#include "fancal.h"
+
+#if USE_FANCAL && FAN_COUNT > 0
+#include <Preferences.h>
+#include "fans.h"
+
+static const char* kNvsNs  = "fancal";
+static const char* kNvsKey[MAX_FANS] = {"f1", "f2", "f3", "f4"};
+static constexpr uint8_t kVersion = 1;
+
+// Down-sweep: coarse for the curve, 2% steps at the low end to find the stall point
+static const uint8_t kDown[] = {100, 90, 80, 70, 60, 50, 40, 30, 20,
+                                18, 16, 14, 12, 10, 8, 6, 4, 2};
+static constexpr uint8_t kDownN     = sizeof(kDown) / sizeof(kDown[0]);
+static constexpr uint8_t kUpStep    = 2;
+static constexpr uint8_t kUpMax     = 40;  // no start by here → fan/tach problem
+static constexpr uint8_t kStepsAll  = 1 + 1 + kDownN + 1 + kUpMax / kUpStep;
+static constexpr int     kSpinRpm   = 100; // below this the fan is coasting, not driven
+static constexpr uint8_t kTraceN    = 64;  // spin-up samples per channel (8 s of 125 ms windows)
+
+enum Phase : uint8_t { CAL_IDLE, CAL_STOP, CAL_SPINUP, CAL_DOWN, CAL_STOP2, CAL_UP };
+
+// Per-channel measurement while the sweep runs
+struct CalChan {
+  FanCalData work;
+  uint32_t   seq;     // last tach window seen (spin-up timing)
+  uint16_t   top;
+  uint8_t    n;       // spin-up samples in s_trace
+  bool       done;    // stalled (down-sweep) / started (up-sweep)
+};
+
+// Spin-up trace: one (time since 100%, rpm) sample per tach window
+struct SpinSample {
+  uint16_t ms;
+  uint16_t rpm;
+};
+
+static FanCalData  s_data[MAX_FANS]; // what is stored / applied
+static CalChan     s_cal[MAX_FANS];
+static SpinSample  s_trace[FAN_COUNT][kTraceN];
+static Phase       s_phase   = CAL_IDLE;
+static const char* s_status  = "idle";
+static char        s_why[32];        // failure text naming the channel
+static uint8_t     s_idx     = 0;    // index in kDown / current up duty
+static uint8_t     s_steps   = 0;    // progress
+static uint32_t    s_t0      = 0;    // phase/step start
+
+static constexpr bool calibrated(uint8_t ch) { return fanHasPwm(ch) && fanHasTach(ch); }
+
+// ---- helpers ----
+static void setDuty(uint8_t pct, uint32_t now) {
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+    if (calibrated(ch)) fanPwmSetPercent(ch, pct);
+  }
+  s_t0 = now;
+  s_steps++;
+}
+
+static void finish(const char* status) {
+  s_phase  = CAL_IDLE;
+  s_status = status;
+}
+
+static void failChan(const char* what, uint8_t ch) {
+  snprintf(s_why, sizeof(s_why), "failed: fan%u %s", (unsigned)(ch + 1), what);
+  finish(s_why);
+}
+
+static void clearDone() {
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) s_cal[ch].done = false;
+}
+
+static void save() {
+  Preferences p;
+  const bool ok = p.begin(kNvsNs, false);
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+    if (!calibrated(ch)) continue;
+    s_cal[ch].work.version = kVersion;
+    s_data[ch] = s_cal[ch].work;
+    if (ok) p.putBytes(kNvsKey[ch], &s_data[ch], sizeof(s_data[ch]));
+  }
+  if (ok) p.end();
+}
+
+// 100% → first sample at 90% of the top speed of the whole window, so a
+// late (noisy) peak raises the bar but does not move the time
+static uint16_t spinUpMs(uint8_t ch) {
+  const CalChan& c = s_cal[ch];
+  for (uint8_t i = 0; i < c.n; ++i) {
+    if ((uint32_t)s_trace[ch][i].rpm * 10U >= (uint32_t)c.top * 9U) return s_trace[ch][i].ms;
+  }
+  return 0;
+}
+
+// ---- public ----
+void fanCalBegin() {
+  Preferences p;
+  if (!p.begin(kNvsNs, true)) return;
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+    FanCalData d;
+    if (p.getBytesLength(kNvsKey[ch]) == sizeof(d) &&
+        p.getBytes(kNvsKey[ch], &d, sizeof(d)) == sizeof(d) && d.version == kVersion) {
+      s_data[ch] = d;
+    }
+  }
+  p.end();
+}
+
+void fanCalStart() {
+  if (s_phase != CAL_IDLE) return;
+  bool any = false;
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+    s_cal[ch] = CalChan();
+    if (!calibrated(ch)) continue;
+    any = true;
+    fanPwmSetMinPercent(ch, 0);       // sweep needs the dead zone too
+  }
+  if (!any) { s_status = "failed: no fan with PWM and tach"; return; }
+  s_steps  = 0;
+  s_status = "running";
+  setDuty(0, clockMs());
+  s_phase  = CAL_STOP;
+}
+
+void fanCalTick(const HostState& host) {
+  if (s_phase == CAL_IDLE) return;
+  const uint32_t now = clockMs();
+
+  // Never characterize a hot box at low duty
+  if (!isnan(host.local_temp_c) && host.local_temp_c >= FANCAL_ABORT_C) {
+    setDuty(100, now);
+    finish("aborted: too hot");
+    return;
+  }
+
+  switch (s_phase) {
+  case CAL_STOP:    // wait for standstill of every swept fan, then full power
+  case CAL_STOP2:
+    for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+      if (!calibrated(ch) || fanTachGetRPM(ch) == 0) continue;
+      if (now - s_t0 < FANCAL_STOP_MS) return;
+      failChan("does not stop", ch);
+      return;
+    }
+    if (s_phase == CAL_STOP) {
+      setDuty(100, now);
+      for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) s_cal[ch].seq = fanTachSeq(ch);
+      s_phase = CAL_SPINUP;
+    } else {
+      clearDone();
+      s_idx = kUpStep;
+      setDuty(s_idx, now);
+      s_phase = CAL_UP;
+    }
+    return;
+
+  case CAL_SPINUP: {
+    // One sample per tach window. A full trace keeps only new peaks, in its
+    // last slot: the 90% crossing is at or before the peak, so it stays in
+    for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+      CalChan& c = s_cal[ch];
+      if (!calibrated(ch) || fanTachSeq(ch) == c.seq) continue;
+      c.seq = fanTachSeq(ch);
+      const int rpm = fanTachGetRPM(ch);
+      if (rpm <= 0) continue;
+      const bool peak = rpm > (int)c.top;
+      if (peak) c.top = (uint16_t)rpm;
+      if (c.n < kTraceN) c.n++;
+      else if (!peak) continue;
+      s_trace[ch][c.n - 1] = {(uint16_t)(now - s_t0), (uint16_t)rpm};
+    }
+    if (now - s_t0 < FANCAL_SPINUP_MS) return;
+    for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+      CalChan& c = s_cal[ch];
+      if (!calibrated(ch)) continue;
+      if (c.top == 0) { failChan("no tach signal", ch); return; }
+      c.work.spinUpMs = spinUpMs(ch);
+      c.work.rpm[10]  = c.top;
+    }
+    clearDone();
+    s_idx = 1;                               // kDown[0] (100%) is already measured
+    setDuty(kDown[s_idx], now);
+    s_phase = CAL_DOWN;
+    return;
+  }
+
+  case CAL_DOWN: {
+    if (now - s_t0 < FANCAL_SETTLE_MS) return;
+    const uint8_t duty = kDown[s_idx];
+    bool allStalled = true;
+    for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+      CalChan& c = s_cal[ch];
+      if (!calibrated(ch) || c.done) continue;
+      const int rpm = fanTachGetRPM(ch);
+      const uint16_t r = rpm >= kSpinRpm ? (uint16_t)rpm : 0;
+      if (duty % 10 == 0) c.work.rpm[duty / 10] = r;
+      if (r > 0) { c.work.stallPct = duty; allStalled = false; }
+      else       c.done = true;
+    }
+    if (allStalled || ++s_idx >= kDownN) {
+      setDuty(0, now);
+      s_phase = CAL_STOP2;
+    } else {
+      setDuty(kDown[s_idx], now);
+    }
+    return;
+  }
+
+  case CAL_UP: {
+    if (now - s_t0 < FANCAL_SETTLE_MS) return;
+    bool allStarted = true;
+    for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+      CalChan& c = s_cal[ch];
+      if (!calibrated(ch) || c.done) continue;
+      if (fanTachGetRPM(ch) >= kSpinRpm) {
+        c.work.startPct = s_idx;
+        c.done = true;
+      } else if (s_idx >= kUpMax) {
+        failChan("does not start", ch);
+        return;
+      } else {
+        allStarted = false;
+      }
+    }
+    if (allStarted) {
+      save();
+      finish("done");
+      return;
+    }
+    s_idx += kUpStep;
+    setDuty(s_idx, now);
+    return;
+  }
+
+  default:
+    return;
+  }
+}
+
+bool fanCalActive() { return s_phase != CAL_IDLE; }
+
+uint8_t fanCalProgressPct() {
+  const uint16_t p = (uint16_t)s_steps * 100U / kStepsAll;
+  return p > 99 ? 99 : (uint8_t)p;
+}
+
+const char* fanCalStatus() { return s_status; }
+
+const FanCalData& fanCalData(uint8_t ch) {
+  static const FanCalData none;
+  return ch < FAN_COUNT ? s_data[ch] : none;
+}
+
+int32_t fanCalRpmAt(uint8_t ch, int32_t pctQ16) {
+  if (ch >= FAN_COUNT || !s_data[ch].version) return -1;
+  const FanCalData& d = s_data[ch];
+  const int32_t step = 10 << 16;             // 10 % in Q16.16
+  if (pctQ16 <= 0)        return d.rpm[0];
+  if (pctQ16 >= 10 * step) return d.rpm[10];
+  const int32_t i    = pctQ16 / step;
+  const int32_t frac = pctQ16 - i * step;
+  return d.rpm[i] + (int32_t)((int64_t)(d.rpm[i + 1] - d.rpm[i]) * frac / step);
+}
+
+#endif // USE_FANCAL && FAN_COUNT > 0
@@ -0,0 +1,36 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+#include "state.h"
+
+// Fan characterization sweep (duty → RPM), persisted in NVS per channel and
+// applied by fanCtrlBegin() in place of the compiled-in low-end knobs.
+// All channels with both a PWM and a tach pin are swept together.
+struct FanCalData {
+  uint8_t  version  = 0;      // 0 = no calibration stored
+  uint8_t  startPct = 0;      // lowest duty that starts the fan from standstill
+  uint8_t  stallPct = 0;      // lowest duty that keeps a spinning fan turning
+  uint8_t  _pad     = 0;
+  uint16_t spinUpMs = 0;      // 100% from standstill → 90% of top speed
+  uint16_t rpm[11]  = {0};    // RPM at 0,10,…,100 %
+};
+
+#if USE_FANCAL && FAN_COUNT > 0
+  void fanCalBegin();                    // load from NVS
+  void fanCalStart();                    // request a sweep (ignored if running)
+  void fanCalTick(const HostState& host); // call in loop(); owns the PWM while active
+  bool fanCalActive();
+  uint8_t fanCalProgressPct();
+  const char* fanCalStatus();            // "idle", "running", "done", or failure reason
+  const FanCalData& fanCalData(uint8_t ch);
+  int32_t fanCalRpmAt(uint8_t ch, int32_t pctQ16); // interpolated curve (duty in Q16.16); -1 if uncalibrated
+#else
+  inline void fanCalBegin() {}
+  inline void fanCalStart() {}
+  inline void fanCalTick(const HostState&) {}
+  inline bool fanCalActive() { return false; }
+  inline uint8_t fanCalProgressPct() { return 0; }
+  inline const char* fanCalStatus() { return "disabled"; }
+  inline const FanCalData& fanCalData(uint8_t) { static const FanCalData d; return d; }
+  inline int32_t fanCalRpmAt(uint8_t, int32_t) { return -1; }
+#endif
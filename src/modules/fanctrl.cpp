@@ -1,5 +1,6 @@
 // src/modules/fanctrl.cpp
 #include "fanctrl.h"
+#include "fancal.h"
 #include <math.h>
 
 // ---- Low-end behavior (no flapping) ----
@@ -19,95 +20,335 @@
   #define FAN_MIN_OFF_MS 4000
 #endif
 
+// ---- Q16.16 fixed point ----
+// The C3 has no FPU: the whole loop runs on integers. Duty and temperature
+// are Q16.16 (100% = 100 << 16); RPM stays a plain int.
+typedef int32_t q16_t;
+static constexpr int   kQ    = 16;
+static constexpr q16_t kQOne = (q16_t)1 << kQ;
+
+static constexpr q16_t qi(int32_t v) { return v * kQOne; }
+static inline q16_t qclamp(q16_t v, q16_t lo, q16_t hi) { return v < lo ? lo : (v > hi ? hi : v); }
+static inline uint8_t qRoundPct(q16_t v) { return (uint8_t)((v + kQOne / 2) >> kQ); } // v >= 0
+static inline float qToF(q16_t v) { return (float)v * (1.0f / kQOne); }            // telemetry only
+
+// Per-channel controller state (only channels with a PWM pin are driven)
+struct FanChan {
+  q16_t    caseCmd      = 0;     // case curve (held while Dallas is briefly invalid)
+  q16_t    cmdPct       = 0;     // raw command after mixing the inputs (%)
+  q16_t    outPct       = 0;     // filtered & rate-limited output (%)
+  uint32_t kickUntilMs  = 0;
+  bool     kickOn       = false; // kickUntilMs is armed (no 0 sentinel: clockMs() wraps)
+  bool     onLatched    = false; // ON/OFF latch
+  uint32_t stateChanged = 0;     // last time we toggled ON/OFF
+  // Low-end knobs: compiled-in defaults, replaced by the NVS calibration if present
+  q16_t    offThr       = qi(FAN_OFF_BELOW_PCT);
+  q16_t    onThr        = qi(FAN_ON_ABOVE_PCT);
+  uint32_t kickMs       = FAN_KICK_MS;
+  bool     wasKicking   = false;
+#if FAN_CTRL_MODE == 1
+  q16_t    piI          = 0;     // integrator (duty %)
+  q16_t    piOut        = 0;     // last PI output, held between tach windows
+  uint32_t piSeq        = 0;     // last tach window consumed
+#endif
+};
+
+static FanChan  s_ch[MAX_FANS];
+
+// Behaviour counters for tuning curves/hysteresis on the device (not reset by fanCtrlBegin)
+struct FanStat {
+  uint32_t toggles = 0;
+  uint32_t kicks   = 0;
+  uint64_t dutyMs  = 0;  // Σ applied duty% × ms
+  uint64_t runMs   = 0;  // wraps a uint32_t after 49.7 days of uptime
+};
+static FanStat  s_stat[MAX_FANS];
 static uint32_t s_lastTick     = 0;
-static float    s_cmdPct       = 0.0f;  // raw command from curve (%)
-static float    s_outPct       = 0.0f;  // filtered & rate-limited output (%)
-static uint32_t s_kickUntilMs  = 0;
-static bool     s_onLatched    = false; // ON/OFF latch
-static uint32_t s_stateChanged = 0;     // last time we toggled ON/OFF
-
-static inline float clampf(float v, float lo, float hi) {
-  return v < lo ? lo : (v > hi ? hi : v);
+static bool     s_calHold      = false; // calibration sweep owns the PWM
+static uint32_t s_tickCycles   = 0;     // CPU cycles of the last control tick (all channels)
+static uint32_t s_tickCyclesMax = 0;
+
+// Disarms once the deadline has passed, so an old deadline never looks
+// "in the future" again after 24.8 days
+static bool kickRunning(FanChan& c, uint32_t now) {
+  if (c.kickOn && (int32_t)(c.kickUntilMs - now) <= 0) c.kickOn = false;
+  return c.kickOn;
+}
+
+#if FAN_CTRL_MODE == 1
+// ---- Closed-loop RPM (PI on the channel's tach) ----
+
+// Duty → RPM target: calibrated curve if available, else linear to FANn_MAX_RPM
+static int32_t targetRpmFor(uint8_t ch, q16_t pct) {
+  const int32_t r = fanCalRpmAt(ch, pct);
+  return r >= 0 ? r : (int32_t)(((int64_t)kFanDefs[ch].maxRpm * pct + qi(100) / 2) / qi(100));
+}
+
+// duty = feed-forward (curve duty) + Kp*e + I; runs once per tach window so
+// every step sees a fresh measurement. reset: seed from feed-forward, clear I.
+static q16_t rpmLoop(uint8_t ch, q16_t ffPct, int32_t targetRpm, bool reset) {
+  FanChan& c = s_ch[ch];
+  if (reset) {
+    c.piI   = 0;
+    c.piOut = ffPct;
+    c.piSeq = fanTachSeq(ch);
+    return ffPct;
+  }
+  const uint32_t seq = fanTachSeq(ch);
+  if (seq == c.piSeq) return c.piOut;
+  c.piSeq = seq;
+
+  const int rpm = fanTachGetRPM(ch);
+  if (rpm < 0) return c.piOut;             // tach unknown → hold
+
+  // Gains are milli-units: P = Kp/1000 * e, I += Ki/1000 * e * dt[ms]/1000
+  const int32_t err = targetRpm - rpm;
+  const q16_t   p   = (q16_t)((int64_t)FAN_PI_KP_MILLI * err * kQOne / 1000);
+
+  // Anti-windup: stop integrating while the output is pinned in the error's direction
+  const q16_t unsat = ffPct + p + c.piI;
+  const bool pinned = (unsat >= qi(100) && err > 0) || (unsat <= 0 && err < 0);
+  if (!pinned) {
+    const q16_t di = (q16_t)((int64_t)FAN_PI_KI_MILLI * err * (int64_t)fanTachWinMs(ch) * kQOne / 1000000);
+    c.piI = qclamp(c.piI + di, -qi(FAN_PI_I_LIMIT_PCT), qi(FAN_PI_I_LIMIT_PCT));
+  }
+  c.piOut = qclamp(ffPct + p + c.piI, 0, qi(100));
+  return c.piOut;
 }
-static inline float lerp(float a, float b, float t) { return a + (b - a) * t; }
-
-// Piecewise-linear curve T(°C) -> duty%
-static float curveDutyFromTemp(float tc) {
-  struct P { float c, p; };
-  const P pt[] = {
-    {FC_PT1_C, FC_PT1_P},
-    {FC_PT2_C, FC_PT2_P},
-    {FC_PT3_C, FC_PT3_P},
-    {FC_PT4_C, FC_PT4_P},
-    {FC_PT5_C, FC_PT5_P}
-  };
-  if (tc <= pt[0].c) return pt[0].p;
+#endif
+
+// Piecewise-linear curves x -> duty%; FANn_CURVE picks the case curve row,
+// disk (°C) and CPU (%) curves are shared. Points are whole numbers, so the
+// tables stay integer.
+struct CurvePt { int16_t c, p; };
+static const CurvePt kCurves[][5] = {
+  { {FC_PT1_C, FC_PT1_P}, {FC_PT2_C, FC_PT2_P}, {FC_PT3_C, FC_PT3_P},
+    {FC_PT4_C, FC_PT4_P}, {FC_PT5_C, FC_PT5_P} },
+  { {FC2_PT1_C, FC2_PT1_P}, {FC2_PT2_C, FC2_PT2_P}, {FC2_PT3_C, FC2_PT3_P},
+    {FC2_PT4_C, FC2_PT4_P}, {FC2_PT5_C, FC2_PT5_P} },
+};
+static constexpr uint8_t kCurveCount = sizeof(kCurves) / sizeof(kCurves[0]);
+
+static const CurvePt kDiskCurve[5] = {
+  {DK_PT1_C, DK_PT1_P}, {DK_PT2_C, DK_PT2_P}, {DK_PT3_C, DK_PT3_P},
+  {DK_PT4_C, DK_PT4_P}, {DK_PT5_C, DK_PT5_P}
+};
+static const CurvePt kCpuCurve[5] = {
+  {CPU_PT1_L, CPU_PT1_P}, {CPU_PT2_L, CPU_PT2_P}, {CPU_PT3_L, CPU_PT3_P},
+  {CPU_PT4_L, CPU_PT4_P}, {CPU_PT5_L, CPU_PT5_P}
+};
+
+static q16_t curveDuty(const CurvePt* pt, q16_t tq) {
+  if (tq <= qi(pt[0].c)) return qi(pt[0].p);
   for (int i = 0; i < 4; ++i) {
-    if (tc <= pt[i + 1].c) {
-      const float t = (tc - pt[i].c) / (pt[i + 1].c - pt[i].c);
-      return lerp(pt[i].p, pt[i + 1].p, t);
+    if (tq <= qi(pt[i + 1].c)) {
+      // p0 + (T - c0) * (p1 - p0) / (c1 - c0), one 64-bit multiply/divide
+      const int64_t num = (int64_t)(tq - qi(pt[i].c)) * (pt[i + 1].p - pt[i].p);
+      return qi(pt[i].p) + (q16_t)(num / (pt[i + 1].c - pt[i].c));
     }
   }
-  return pt[4].p;
+  return qi(pt[4].p);
+}
+
+// ---- Inputs ----
+// Read once per tick; host inputs only count while the last frame is fresh
+struct FanInputs {
+  bool  caseOk = false;  q16_t caseT = 0;   // Dallas °C
+  bool  diskOk = false;  q16_t diskT = 0;   // hottest active disk °C
+  bool  cpuOk  = false;  q16_t cpu   = 0;   // host CPU %
+};
+
+static FanInputs readInputs(const HostState& host, const UiState& ui, uint32_t now) {
+  FanInputs in;
+  in.caseOk = !isnan(host.local_temp_c);
+  if (in.caseOk) in.caseT = (q16_t)(host.local_temp_c * (float)kQOne);
+
+  const uint32_t age = ui.lastParseOkMs ? now - ui.lastParseOkMs : UINT32_MAX;
+  (void)age;
+#if FAN_USE_DISK
+  if (age < FAN_DISK_STALE_MS) {
+    int16_t hot = -127;                       // -127 = unknown (see DiskInfo)
+    for (uint8_t i = 0; i < host.disk_count && i < MAX_DISKS; ++i) {
+      const DiskInfo& d = host.disks[i];
+      if (d.active && d.temp_c > hot) hot = d.temp_c;
+    }
+    if (hot > -127) { in.diskOk = true; in.diskT = qi(hot); }
+  }
+#endif
+#if FAN_USE_CPU
+  if (age < FAN_CPU_STALE_MS && !isnan(host.cpu_percent)) {
+    in.cpuOk = true;
+    in.cpu   = (q16_t)(host.cpu_percent * (float)kQOne);
+  }
+#endif
+  return in;
+}
+
+// Combine the case command with the valid host inputs (max or weighted);
+// *src gets the input with the largest (weighted) say
+static q16_t mixInputs(q16_t caseCmd, const FanInputs& in, uint8_t* src) {
+  const q16_t d[3]  = { caseCmd,
+                        in.diskOk ? curveDuty(kDiskCurve, in.diskT) : 0,
+                        in.cpuOk  ? curveDuty(kCpuCurve, in.cpu)    : 0 };
+  const bool  ok[3] = { true, in.diskOk, in.cpuOk };
+#if FAN_MIX_MODE == 1
+  static const int32_t w[3] = { FAN_W_CASE, FAN_W_DISK, FAN_W_CPU };
+#else
+  static const int32_t w[3] = { 1, 1, 1 };
+#endif
+  int64_t sum  = 0, best = -1;
+  int32_t wsum = 0;
+  q16_t   mx   = 0;
+  *src = FAN_IN_CASE;
+  for (uint8_t i = 0; i < 3; ++i) {
+    if (!ok[i] || w[i] <= 0) continue;
+    const int64_t wd = (int64_t)w[i] * d[i];
+    sum  += wd;
+    wsum += w[i];
+    if (d[i] > mx) mx = d[i];
+    if (wd > best) { best = wd; *src = i; }
+  }
+#if FAN_MIX_MODE == 1
+  return wsum ? (q16_t)(sum / wsum) : caseCmd;
+#else
+  return mx;
+#endif
 }
 
 void fanCtrlBegin() {
-  s_lastTick     = millis();
-  s_cmdPct       = 0.0f;
-  s_outPct       = 0.0f;
-  s_kickUntilMs  = 0;
-  s_onLatched    = false;
-  s_stateChanged = s_lastTick;
+  s_lastTick = clockMs();
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+    if (!fanHasPwm(ch)) continue;
+    FanChan& c = s_ch[ch];
+    c = FanChan();
+    c.stateChanged = s_lastTick;
+
+    // Apply the stored fan characterization (measured stall/start duty, spin-up)
+    const FanCalData& cal = fanCalData(ch);
+    if (cal.version) {
+      c.offThr = qi(cal.stallPct + FANCAL_MARGIN_PCT);
+      c.onThr  = qi(cal.startPct + FANCAL_MARGIN_PCT);
+      if (c.onThr < c.offThr) c.onThr = c.offThr;
+      // A quarter of the 0→90% spin-up is plenty to break away
+      c.kickMs = constrain(cal.spinUpMs / 4U, 100U, 1000U);
+      fanPwmSetMinPercent(ch, cal.stallPct + FANCAL_MARGIN_PCT);
+    } else {
+      fanPwmSetMinPercent(ch, kFanDefs[ch].minDutyPct);
+    }
+#if FAN_CTRL_MODE == 1
+    rpmLoop(ch, 0, 0, true);
+#endif
+  }
 }
 
-void fanCtrlTick(HostState& host) {
-  const uint32_t now = millis();
-  if (now - s_lastTick < FAN_TICK_MS) return;
+// ---- Feed-forward from host load trends ----
+// Sampled once per accepted host frame (~POLL_INTERVAL_MS apart). Each signal
+// keeps an incremental slope estimate (EWMA, alpha 1/2, units per minute);
+// rising slopes map to extra duty, capped and decaying until the next frame.
+#if FAN_USE_FF
+struct FfSignal {
+  q16_t prev  = 0;
+  bool  ok    = false;
+  q16_t slope = 0;      // per minute
+};
 
-  const float dt_s = (now - s_lastTick) / 1000.0f;
-  s_lastTick = now;
+static FfSignal s_ffLoad, s_ffCpu, s_ffNet;
+static uint32_t s_ffFrames = 0;   // ui.parseOkCount last sampled
+static uint32_t s_ffLastMs = 0;   // frame time of the previous sample
+static q16_t    s_ffPeak   = 0;   // term at the last frame
+static uint32_t s_ffPeakMs = 0;
 
-  // 1) Command from Dallas temperature (no floors here)
-  const float tC = host.local_temp_c;
-  const bool  tempValid = !isnan(tC);
+static void ffUpdate(FfSignal& sg, float v, uint32_t dtMs) {
+  if (isnan(v)) { sg.ok = false; sg.slope = 0; return; }
+  const q16_t q = (q16_t)(v * (float)kQOne);
+  if (sg.ok && dtMs) {
+    const q16_t perMin = (q16_t)((int64_t)(q - sg.prev) * 60000 / dtMs);
+    sg.slope += (perMin - sg.slope) / 2;
+  }
+  sg.prev = q;
+  sg.ok   = true;
+}
+
+static void ffSample(const HostState& host, uint32_t frameMs) {
+  // Frames closer than 10 s (e.g. an immediate GET) are too short for a slope
+  const uint32_t dtMs = s_ffLastMs ? frameMs - s_ffLastMs : 0;
+  if (s_ffLastMs && dtMs < 10000) return;
+  s_ffLastMs = frameMs;
+
+  ffUpdate(s_ffLoad, host.load1, dtMs);
+  ffUpdate(s_ffCpu,  host.cpu_percent, dtMs);
+  ffUpdate(s_ffNet,  host.net_rx_kbps / 1000.0f, dtMs);   // Mbit/s
+
+  // Only rises count
+  int64_t ff = 0;
+  if (s_ffLoad.slope > 0) ff += (int64_t)s_ffLoad.slope * FAN_FF_K_LOAD_X10 / 10;
+  if (s_ffCpu.slope  > 0) ff += (int64_t)s_ffCpu.slope  * FAN_FF_K_CPU_X10  / 10;
+  if (s_ffNet.slope  > 0) ff += (int64_t)s_ffNet.slope  * FAN_FF_K_NET_X10  / 10;
+  s_ffPeak   = ff > qi(FAN_FF_MAX_PCT) ? qi(FAN_FF_MAX_PCT) : (q16_t)ff;
+  s_ffPeakMs = frameMs;
+}
+
+static q16_t ffTerm(uint32_t now) {
+  const uint32_t el = now - s_ffPeakMs;
+  if (!s_ffPeak || el >= FAN_FF_DECAY_MS) return 0;
+  return (q16_t)((int64_t)s_ffPeak * (FAN_FF_DECAY_MS - el) / FAN_FF_DECAY_MS);
+}
+#endif
+
+// One channel: curve → rate limit → EMA → hysteresis/dwell → (PI) → kick → PWM
+static void tickChannel(uint8_t ch, HostState& host, const FanInputs& in, q16_t ff,
+                        uint32_t now, uint32_t dtMs) {
+  FanChan& c = s_ch[ch];
+  FanTelemetry& tel = host.fan[ch];
 
-  if (tempValid) {
-    host.fan_last_valid_ms = now;
-    s_cmdPct = curveDutyFromTemp(tC);
+  // 1) Command: case curve from Dallas (no floors here), then disk/CPU curves
+  if (in.caseOk) {
+    const uint8_t curve = kFanDefs[ch].curve;
+    c.caseCmd = curveDuty(kCurves[curve < kCurveCount ? curve : 0], in.caseT);
   } else {
     // Sensor invalid: after timeout, go safe and latch ON once
     if (!host.fan_last_valid_ms || (now - host.fan_last_valid_ms > FAN_INVALID_HOLD_MS)) {
-      s_cmdPct = FAN_SAFE_PCT;
-      if (!s_onLatched) {
-        s_onLatched = true;
-        s_stateChanged = now;
-        s_kickUntilMs = now + FAN_KICK_MS;
+      c.caseCmd = qi(FAN_SAFE_PCT);
+      if (!c.onLatched) {
+        c.onLatched = true;
+        c.stateChanged = now;
+        c.kickUntilMs = now + c.kickMs;
+        c.kickOn = true;
+        s_stat[ch].toggles++;
+        s_stat[ch].kicks++;
       }
     }
   }
+  c.cmdPct = qclamp(mixInputs(c.caseCmd, in, &tel.source) + ff, 0, qi(100));
 
-  // 2) Rate limit (±FAN_RATE_PCT_PER_S %/s)
-  const float rate    = FAN_RATE_PCT_PER_S * dt_s;
-  const float limited = clampf(s_cmdPct, s_outPct - rate, s_outPct + rate);
+  // 2) Rate limit (±FAN_RATE_PCT_PER_S %/s); with FAN_HW_FADE the LEDC fade does it (step 6)
+#if FAN_HW_FADE
+  const q16_t limited = c.cmdPct;
+#else
+  const q16_t rate    = (q16_t)((int64_t)FAN_RATE_PCT_PER_S * kQOne * dtMs / 1000);
+  const q16_t limited = qclamp(c.cmdPct, c.outPct - rate, c.outPct + rate);
+#endif
 
-  // 3) Smoothing (EMA with Q8 alpha)
-  const float alpha = (float)FAN_ALPHA_Q8 / 256.0f;
-  s_outPct = (1.0f - alpha) * s_outPct + alpha * limited;
+  // 3) Smoothing (EMA with Q8 alpha): out += alpha * (in - out)
+  c.outPct += (q16_t)(((int64_t)(limited - c.outPct) * FAN_ALPHA_Q8) >> 8);
 
   // 4) State machine with hysteresis + dwell
-  const float offThr = (float)FAN_OFF_BELOW_PCT; // strictly < offThr -> OFF
-  const float onThr  = (float)FAN_ON_ABOVE_PCT;  // >= onThr -> can turn ON
-  float applyPct = s_outPct;
+  const q16_t offThr = c.offThr; // strictly < offThr -> OFF
+  const q16_t onThr  = c.onThr;  // >= onThr -> can turn ON
+  q16_t applyPct = c.outPct;
 
-  if (!s_onLatched) {
+  if (!c.onLatched) {
     // OFF state
-    applyPct = 0.0f;
+    applyPct = 0;
     // Require dwell time before considering turn-on
-    const bool dwellOk = (now - s_stateChanged) >= FAN_MIN_OFF_MS;
-    if (dwellOk && s_cmdPct >= onThr) {
-      s_onLatched = true;
-      s_stateChanged = now;
-      s_kickUntilMs = now + FAN_KICK_MS; // one-shot kick
+    const bool dwellOk = (now - c.stateChanged) >= FAN_MIN_OFF_MS;
+    if (dwellOk && c.cmdPct >= onThr) {
+      c.onLatched = true;
+      c.stateChanged = now;
+      c.kickUntilMs = now + c.kickMs; // one-shot kick
+      c.kickOn = true;
+      s_stat[ch].toggles++;
+      s_stat[ch].kicks++;
       applyPct = onThr; // seed at least ON threshold after the kick ends
     }
   } else {
@@ -116,27 +357,128 @@ void fanCtrlTick(HostState& host) {
     if (applyPct < offThr) applyPct = offThr;
 
     // Turn OFF only if under OFF threshold and dwell elapsed
-    const bool dwellOk = (now - s_stateChanged) >= FAN_MIN_ON_MS;
-    if (dwellOk && s_cmdPct < offThr) {
-      s_onLatched = false;
-      s_stateChanged = now;
-      applyPct = 0.0f;
-      s_kickUntilMs = 0;
+    const bool dwellOk = (now - c.stateChanged) >= FAN_MIN_ON_MS;
+    if (dwellOk && c.cmdPct < offThr) {
+      c.onLatched = false;
+      c.stateChanged = now;
+      applyPct = 0;
+      c.kickOn = false;
+      s_stat[ch].toggles++;
+    }
+  }
+
+  const bool kicking = kickRunning(c, now);
+
+#if FAN_CTRL_MODE == 1
+  // 4b) Closed loop: the hysteresis/dwell result is the feed-forward and the
+  //     RPM target; the PI trims it (frozen/reset while OFF or kicking)
+  if (fanHasTach(ch)) {
+    if (c.onLatched && applyPct > 0) {
+      const int32_t targetRpm = targetRpmFor(ch, applyPct);
+      applyPct = rpmLoop(ch, applyPct, targetRpm, kicking);
+      if (applyPct < offThr) applyPct = offThr;
+      tel.rpm_target = targetRpm;
+    } else {
+      rpmLoop(ch, 0, 0, true);
+      tel.rpm_target = 0.0f;
     }
   }
+#endif
 
   // 5) Start-kick (brief) — only while kick window active
-  if ((int32_t)(s_kickUntilMs - now) > 0) {
-    applyPct = FAN_KICK_PCT;
+  if (kicking) {
+    applyPct = qi(FAN_KICK_PCT);
+  }
+
+  // 6) Clamp and send to the channel's PWM (0..100)
+  applyPct = qclamp(applyPct, 0, qi(100));
+#if FAN_HW_FADE
+  // Fade at FAN_RATE_PCT_PER_S toward the new duty; kick start/end jump.
+  // A running fade is left alone (it cannot be retargeted); longer ramps are
+  // split into FAN_HW_FADE_MAX_MS pieces so the duty keeps the configured rate.
+  {
+    static constexpr int kMaxStep = FAN_RATE_PCT_PER_S * FAN_HW_FADE_MAX_MS / 1000 > 0
+                                  ? FAN_RATE_PCT_PER_S * FAN_HW_FADE_MAX_MS / 1000 : 1;
+    const int  cur  = fanPwmGetPercent(ch);
+    const int  want = qRoundPct(applyPct);
+    const bool jump = kicking || c.wasKicking;
+    if (want != cur && (jump || !fanPwmFading(ch))) {
+      const int step = jump ? want - cur : constrain(want - cur, -kMaxStep, kMaxStep);
+      fanPwmFadeToPercent(ch, (uint8_t)(cur + step),
+                          jump ? 0 : (uint32_t)abs(step) * 1000U / FAN_RATE_PCT_PER_S);
+    }
+  }
+  c.wasKicking = kicking;
+#else
+  fanPwmSetPercent(ch, qRoundPct(applyPct));
+#endif
+
+  // 7) Telemetry (float only at this boundary, for pages/web)
+  tel.duty_cmd  = qToF(c.cmdPct);
+  tel.duty_filt = qToF(c.outPct);
+  tel.active    = (applyPct > kQOne / 10) ? 1 : 0;
+  s_stat[ch].dutyMs += (uint64_t)qRoundPct(applyPct) * dtMs;
+  s_stat[ch].runMs  += dtMs;
+}
+
+void fanCtrlTick(HostState& host, const UiState& ui) {
+  // Calibration sweep drives the PWM itself; restart cleanly (with the new
+  // calibration) once it is over
+  if (fanCalActive()) { s_calHold = true; return; }
+  if (s_calHold) { s_calHold = false; fanCtrlBegin(); }
+
+  const uint32_t now = clockMs();
+  if (now - s_lastTick < FAN_TICK_MS) return;
+
+  const uint32_t c0   = ESP.getCycleCount();
+  const uint32_t dtMs = now - s_lastTick;
+  s_lastTick = now;
+
+  const FanInputs in = readInputs(host, ui, now);
+  if (in.caseOk) host.fan_last_valid_ms = now;
+
+#if FAN_USE_FF
+  if (ui.parseOkCount != s_ffFrames) {
+    s_ffFrames = ui.parseOkCount;
+    ffSample(host, ui.lastParseOkMs);
   }
+  const q16_t ff = ffTerm(now);
+  host.fan_ff_pct = qToF(ff);
+#else
+  const q16_t ff = 0;
+#endif
+
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+    if (fanHasPwm(ch)) tickChannel(ch, host, in, ff, now, dtMs);
+  }
+
+  s_tickCycles = ESP.getCycleCount() - c0;
+  if (s_tickCycles > s_tickCyclesMax) s_tickCyclesMax = s_tickCycles;
+}
 
-  // 6) Clamp and send to FAN1 (0..100)
-  if (applyPct < 0.0f)   applyPct = 0.0f;
-  if (applyPct > 100.0f) applyPct = 100.0f;
-  fan1PwmSetPercent((uint8_t)lroundf(applyPct));
+void fanCtrlKick(uint8_t ch, uint32_t ms) {
+  if (ch >= FAN_COUNT || !s_ch[ch].onLatched) return;
+  s_ch[ch].kickUntilMs = clockMs() + ms;
+  s_ch[ch].kickOn = true;
+  s_stat[ch].kicks++;
+}
 
-  // 7) Telemetry
-  host.fan_duty_cmd  = s_cmdPct;
-  host.fan_duty_filt = s_outPct;
-  host.fan_active    = (applyPct > 0.1f) ? 1 : 0;
+bool fanCtrlKicking(uint8_t ch) {
+  return ch < FAN_COUNT && kickRunning(s_ch[ch], clockMs());
 }
+
+FanCtrlStats fanCtrlStats(uint8_t ch) {
+  FanCtrlStats r = {0, 0, NAN, NAN};
+  if (ch >= FAN_COUNT) return r;
+  const FanStat& s = s_stat[ch];
+  r.toggles = s.toggles;
+  r.kicks   = s.kicks;
+  if (s.runMs) {
+    r.avgDutyPct     = (float)s.dutyMs / (float)s.runMs;
+    r.togglesPerHour = (float)s.toggles * 3600000.0f / (float)s.runMs;
+  }
+  return r;
+}
+
+uint32_t fanCtrlTickCycles()    { return s_tickCycles; }
+uint32_t fanCtrlTickCyclesMax() { return s_tickCyclesMax; }
@@ -2,7 +2,24 @@
 #include <Arduino.h>
 #include "config.h"
 #include "state.h"
-#include "fan1_pwm.h"
+#include "fans.h"
 
 void fanCtrlBegin();
-void fanCtrlTick(HostState& host);
+void fanCtrlTick(HostState& host, const UiState& ui); // ui: host link age (stale inputs)
+
+// Kick at FAN_KICK_PCT for ms (stall recovery); ignored while the channel is OFF
+void fanCtrlKick(uint8_t ch, uint32_t ms);
+bool fanCtrlKicking(uint8_t ch);
+
+// Tuning statistics since boot (survive the restart after a calibration)
+struct FanCtrlStats {
+  uint32_t toggles;     // ON/OFF transitions
+  uint32_t kicks;       // start and recovery kicks
+  float    avgDutyPct;  // time-weighted applied duty
+  float    togglesPerHour;
+};
+FanCtrlStats fanCtrlStats(uint8_t ch);
+
+// Micro-benchmark: CPU cycles spent in the last control tick (all channels)
+uint32_t fanCtrlTickCycles();
+uint32_t fanCtrlTickCyclesMax();
@@ -0,0 +1,151 @@
+#include "fanmon.h"
+
+#if USE_FANMON && FAN_COUNT > 0
+#include "fans.h"
+#include "fancal.h"
+#if USE_FANCTRL
+#include "fanctrl.h"
+#endif
+
+enum MonPhase : uint8_t { MON_WATCH, MON_RECOVER, MON_FAILED };
+
+struct MonChan {
+  MonPhase phase     = MON_WATCH;
+  bool     seen      = false;  // tach has shown a spinning fan since boot
+  uint32_t drivenMs  = 0;      // start of the current driven stretch (0 = not driven)
+  uint32_t lowMs     = 0;      // start of "stopped while driven"
+  uint32_t kickMs    = 0;      // last recovery kick
+  uint32_t seq       = 0;      // last tach window used for the trend
+  int32_t  ratioQ8   = -1;     // EMA of rpm / calibrated rpm (% in Q8), -1 = none
+  uint32_t degMs     = 0;      // start of "below FANMON_DEGRADED_PCT"
+};
+
+static MonChan s_mon[MAX_FANS];
+static uint8_t s_changed = 0;
+
+static constexpr bool monitored(uint8_t ch) { return fanHasPwm(ch) && fanHasTach(ch); }
+
+// ---- helpers ----
+static void setFault(HostState& host, uint8_t ch, FanFault f) {
+  if (host.fan[ch].fault == f) return;
+  host.fan[ch].fault = f;
+  s_changed |= (uint8_t)(1u << ch);
+}
+
+static bool kicking(uint8_t ch) {
+#if USE_FANCTRL
+  return fanCtrlKicking(ch);
+#else
+  (void)ch;
+  return false;
+#endif
+}
+
+static void kick(uint8_t ch, uint32_t now) {
+#if USE_FANCTRL
+  fanCtrlKick(ch, FANMON_KICK_MS);
+#endif
+  s_mon[ch].kickMs = now;
+}
+
+// Slow trend of measured vs calibrated RPM; a single slow window is not a fault
+static void trackDegraded(HostState& host, uint8_t ch, uint8_t duty, int rpm, uint32_t now) {
+  MonChan& m = s_mon[ch];
+  if (fanTachSeq(ch) == m.seq) return;
+  m.seq = fanTachSeq(ch);
+
+  const int32_t expect = fanCalRpmAt(ch, (int32_t)duty << 16);
+  if (expect < 2 * FANMON_STALL_RPM) { m.ratioQ8 = -1; m.degMs = 0; return; }  // uncalibrated / low end
+
+  const int32_t r = (int32_t)((int64_t)rpm * (100 << 8) / expect);
+  m.ratioQ8 = m.ratioQ8 < 0 ? r : m.ratioQ8 + (r - m.ratioQ8) / 16;
+
+  if (m.ratioQ8 < (FANMON_DEGRADED_PCT << 8)) {
+    if (!m.degMs) m.degMs = now;
+    else if (now - m.degMs >= FANMON_DEGRADED_MS && host.fan[ch].fault == FAN_OK) setFault(host, ch, FAN_DEGRADED);
+  } else if (m.ratioQ8 >= ((FANMON_DEGRADED_PCT + 10) << 8)) {  // hysteresis
+    m.degMs = 0;
+    if (host.fan[ch].fault == FAN_DEGRADED) setFault(host, ch, FAN_OK);
+  }
+}
+
+static void tickChannel(HostState& host, uint8_t ch, uint32_t now) {
+  MonChan& m = s_mon[ch];
+  const uint8_t duty = fanPwmGetPercent(ch);
+  const int     rpm  = fanTachGetRPM(ch);
+  if (rpm < 0) return;                         // no tach window yet
+  const bool spinning = rpm >= FANMON_STALL_RPM;
+  if (spinning) m.seen = true;
+
+  const bool driven = duty >= FANMON_MIN_DUTY_PCT && !kicking(ch);
+  if (!driven)          m.drivenMs = 0;
+  else if (!m.drivenMs) m.drivenMs = now;
+  const bool settled = m.drivenMs && now - m.drivenMs >= FANMON_SETTLE_MS;
+
+  switch (m.phase) {
+  case MON_WATCH:
+    if (!settled || spinning) {
+      m.lowMs = 0;
+      if (settled) trackDegraded(host, ch, duty, rpm, now);
+      return;
+    }
+    if (!m.lowMs) { m.lowMs = now; return; }
+    if (now - m.lowMs < FANMON_STALL_MS) return;
+    kick(ch, now);
+    m.phase = MON_RECOVER;
+    return;
+
+  case MON_RECOVER:
+    if (now - m.kickMs < FANMON_KICK_MS + FANMON_RECOVER_MS) return;
+    m.lowMs = 0;
+    if (spinning || duty < FANMON_MIN_DUTY_PCT) {  // recovered, or commanded off meanwhile
+      m.phase = MON_WATCH;
+      return;
+    }
+    // Never seen turning since boot → more likely the tach wire than the fan
+    setFault(host, ch, m.seen ? FAN_STALL : FAN_NO_TACH);
+    m.phase = MON_FAILED;
+    return;
+
+  case MON_FAILED:
+    if (now - m.kickMs < FANMON_KICK_MS + FANMON_RECOVER_MS) return;
+    if (spinning) {
+      setFault(host, ch, FAN_OK);
+      m.phase   = MON_WATCH;
+      m.ratioQ8 = -1;
+      m.degMs   = 0;
+      return;
+    }
+    if (duty >= FANMON_MIN_DUTY_PCT && now - m.kickMs >= FANMON_RETRY_MS) kick(ch, now);
+    return;
+  }
+}
+
+// ---- public ----
+void fanMonTick(HostState& host) {
+  const uint32_t now = clockMs();
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+    if (!monitored(ch)) continue;
+    if (fanCalActive()) {                      // the sweep stops fans on purpose
+      s_mon[ch].drivenMs = 0;
+      s_mon[ch].lowMs    = 0;
+      continue;
+    }
+    tickChannel(host, ch, now);
+  }
+}
+
+uint8_t fanMonTakeChanges() {
+  const uint8_t c = s_changed;
+  s_changed = 0;
+  return c;
+}
+
+bool fanMonAnyFault(const HostState& host) {
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+    if (host.fan[ch].fault != FAN_OK) return true;
+  }
+  return false;
+}
+
+#endif // USE_FANMON && FAN_COUNT > 0
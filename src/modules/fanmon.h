@@ -0,0 +1,18 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+#include "state.h"
+
+// Fan health monitor: compares the applied duty with the tach and flags
+// stalled fans, fans without a tach signal and fans running well below their
+// calibrated curve (host.fan[ch].fault). A stopped fan gets a recovery kick
+// before the fault is raised.
+#if USE_FANMON && FAN_COUNT > 0
+  void    fanMonTick(HostState& host);  // after fanCtrlTick()
+  uint8_t fanMonTakeChanges();          // bit ch set: fault of ch changed since the last call
+  bool    fanMonAnyFault(const HostState& host);
+#else
+  inline void    fanMonTick(HostState&) {}
+  inline uint8_t fanMonTakeChanges() { return 0; }
+  inline bool    fanMonAnyFault(const HostState&) { return false; }
+#endif
@@ -0,0 +1,115 @@
+#include "fans.h"
+
+#if FAN_COUNT > 0
+#include "tach_core.h"
+#if FAN_HW_FADE
+#include <driver/ledc.h>
+#include <esp_idf_version.h>
+#endif
+
+static const int kLedcResBits = 10;                   // 0..1023 steps
+static const int kLedcMax     = (1 << kLedcResBits) - 1;
+
+static TachCore s_tach[FAN_COUNT];
+static uint8_t  s_pct[FAN_COUNT];
+static uint8_t  s_minPct[FAN_COUNT];
+#if FAN_HW_FADE
+static uint32_t s_fadeEndMs[FAN_COUNT];
+static bool     s_fading[FAN_COUNT];  // s_fadeEndMs is armed (cleared once it passes)
+#endif
+
+// One ISR for every channel; the TachCore comes in as the argument
+static void IRAM_ATTR onTachEdge(void* arg) { tachCoreEdge(*static_cast<TachCore*>(arg)); }
+
+void fansBegin() {
+#if FAN_HW_FADE
+  ledc_fade_func_install(0);  // Arduino's ledcSetup() uses LEDC channel ch, low-speed group
+#endif
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+    const FanDef& f = kFanDefs[ch];
+    if (f.pwmPin >= 0) {
+      pinMode(f.pwmPin, OUTPUT);
+      ledcSetup(ch, FAN_PWM_FREQ_HZ, kLedcResBits);
+      ledcAttachPin(f.pwmPin, ch);
+      s_minPct[ch] = f.minDutyPct;
+      fanPwmSetPercent(ch, FAN_DEFAULT_PWM_PCT);
+    }
+    tachCoreBegin(s_tach[ch], f.ppr, f.tachWinMs, f.tachTimeoutMs);
+    if (f.tachPin >= 0) {
+      pinMode(f.tachPin, INPUT_PULLUP); // open-collector tach → pull up to 3.3V
+      attachInterruptArg(digitalPinToInterrupt(f.tachPin), onTachEdge, &s_tach[ch], FALLING);
+    }
+  }
+}
+
+void fansTick() {
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+    if (fanHasTach(ch)) tachCoreTick(s_tach[ch]);
+  }
+}
+
+void fanPwmSetPercent(uint8_t ch, uint8_t pct) { fanPwmFadeToPercent(ch, pct, 0); }
+
+void fanPwmFadeToPercent(uint8_t ch, uint8_t pct, uint32_t ms) {
+  if (!fanHasPwm(ch)) return;
+  if (pct > 100) pct = 100;
+  if (pct > 0 && pct < s_minPct[ch]) pct = s_minPct[ch];  // avoid dead zone
+  uint32_t duty = (uint32_t)((uint32_t)pct * kLedcMax + 50) / 100; // round
+  // Intel 4-wire PWM: “high” on MCU pulls line LOW via transistor → mapping is correct
+#if FAN_HW_FADE
+  // With the fade service installed every duty change must go through it,
+  // and both calls below wait for a fade still running on the channel, so
+  // stop it first (kick jumps land mid-ramp)
+  const ledc_channel_t lc = (ledc_channel_t)ch;
+  if (fanPwmFading(ch)) {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(4, 4, 0)
+    ledc_fade_stop(LEDC_LOW_SPEED_MODE, lc);
+#else
+    return;  // cannot cut it short: skip, the caller retries next tick
+#endif
+  }
+  s_pct[ch] = pct;
+  if (ms == 0) {
+    ledc_set_duty_and_update(LEDC_LOW_SPEED_MODE, lc, duty, 0);
+    s_fading[ch] = false;
+    return;
+  }
+  ledc_set_fade_with_time(LEDC_LOW_SPEED_MODE, lc, duty, ms);
+  ledc_fade_start(LEDC_LOW_SPEED_MODE, lc, LEDC_FADE_NO_WAIT);
+  s_fadeEndMs[ch] = clockMs() + ms + 1;  // clockMs() is whole ms: the fade may end up to 1 ms later
+  s_fading[ch]    = true;
+#else
+  (void)ms;
+  s_pct[ch] = pct;
+  ledcWrite(ch, duty);
+#endif
+}
+
+bool fanPwmFading(uint8_t ch) {
+#if FAN_HW_FADE
+  // Disarm once passed, so an old deadline never looks pending again after 24.8 days
+  if (ch >= FAN_COUNT || !s_fading[ch]) return false;
+  if ((int32_t)(s_fadeEndMs[ch] - clockMs()) > 0) return true;
+  s_fading[ch] = false;
+  return false;
+#else
+  (void)ch;
+  return false;
+#endif
+}
+
+uint8_t fanPwmGetPercent(uint8_t ch) { return ch < FAN_COUNT ? s_pct[ch] : 0; }
+
+void fanPwmSetMinPercent(uint8_t ch, uint8_t pct) {
+  if (ch < FAN_COUNT) s_minPct[ch] = pct > 100 ? 100 : pct;
+}
+
+int      fanTachGetRPM(uint8_t ch) { return fanHasTach(ch) ? s_tach[ch].rpm : -1; }
+uint32_t fanTachSeq(uint8_t ch)    { return ch < FAN_COUNT ? s_tach[ch].seq : 0; }
+uint32_t fanTachWinMs(uint8_t ch) {
+  if (ch >= FAN_COUNT) return FAN1_TACH_WIN_MS;
+  return s_tach[ch].winMs ? s_tach[ch].winMs : kFanDefs[ch].tachWinMs;
+}
+uint32_t fanTachGlitches(uint8_t ch) { return ch < FAN_COUNT ? s_tach[ch].glitches : 0; }
+uint32_t fanTachRejects(uint8_t ch)  { return ch < FAN_COUNT ? s_tach[ch].rejects : 0; }
+#endif
@@ -0,0 +1,61 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+#include "state.h"
+
+// Fan channels: LEDC PWM output and/or tach input per row of a compile-time
+// table built from the FANn_* settings. Channel index ch is 0-based
+// (FanN in the UI = ch + 1); LEDC channel = ch.
+
+struct FanDef {
+  int8_t   pwmPin;        // -1 = tach-only
+  int8_t   tachPin;       // -1 = no tach
+  uint8_t  ppr;
+  uint8_t  minDutyPct;
+  uint8_t  curve;
+  uint16_t maxRpm;
+  uint16_t tachWinMs;
+  uint16_t tachTimeoutMs;
+};
+
+#define FAN_DEF_ROW(n) { FAN##n##_PWM_PIN, FAN##n##_TACH_PIN, FAN##n##_PPR, FAN##n##_MIN_DUTY_PCT, \
+                         FAN##n##_CURVE, FAN##n##_MAX_RPM, FAN##n##_TACH_WIN_MS, FAN##n##_TACH_TIMEOUT_MS }
+
+static constexpr FanDef kFanDefs[MAX_FANS] = {
+  FAN_DEF_ROW(1), FAN_DEF_ROW(2), FAN_DEF_ROW(3), FAN_DEF_ROW(4)
+};
+
+static_assert(FAN_COUNT >= 0 && FAN_COUNT <= MAX_FANS, "FAN_COUNT must be 0..4");
+
+constexpr bool fanHasPwm(uint8_t ch)  { return ch < FAN_COUNT && kFanDefs[ch].pwmPin >= 0; }
+constexpr bool fanHasTach(uint8_t ch) { return ch < FAN_COUNT && kFanDefs[ch].tachPin >= 0; }
+
+#if FAN_COUNT > 0
+  void     fansBegin();
+  void     fansTick();                                // tach windows; call in loop()
+
+  void     fanPwmSetPercent(uint8_t ch, uint8_t pct); // 0..100 (clamped; applies min duty if >0)
+  void     fanPwmFadeToPercent(uint8_t ch, uint8_t pct, uint32_t ms); // hardware fade (FAN_HW_FADE), else immediate; stops a running fade first
+  bool     fanPwmFading(uint8_t ch);
+  uint8_t  fanPwmGetPercent(uint8_t ch);
+  void     fanPwmSetMinPercent(uint8_t ch, uint8_t pct); // runtime min duty (default FANn_MIN_DUTY_PCT)
+
+  int      fanTachGetRPM(uint8_t ch);   // -1 = unknown/no tach, 0 = stopped, >0 = rpm
+  uint32_t fanTachSeq(uint8_t ch);      // bumps once per measurement window (new RPM value)
+  uint32_t fanTachWinMs(uint8_t ch);    // length of the last window (adaptive)
+  uint32_t fanTachGlitches(uint8_t ch); // edges dropped by the ISR gate
+  uint32_t fanTachRejects(uint8_t ch);  // periods dropped as outliers (late ISRs show up here)
+#else
+  inline void     fansBegin() {}
+  inline void     fansTick() {}
+  inline void     fanPwmSetPercent(uint8_t, uint8_t) {}
+  inline void     fanPwmFadeToPercent(uint8_t, uint8_t, uint32_t) {}
+  inline bool     fanPwmFading(uint8_t) { return false; }
+  inline uint8_t  fanPwmGetPercent(uint8_t) { return 0; }
+  inline void     fanPwmSetMinPercent(uint8_t, uint8_t) {}
+  inline int      fanTachGetRPM(uint8_t) { return -1; }
+  inline uint32_t fanTachSeq(uint8_t) { return 0; }
+  inline uint32_t fanTachWinMs(uint8_t) { return FAN1_TACH_WIN_MS; }
+  inline uint32_t fanTachGlitches(uint8_t) { return 0; }
+  inline uint32_t fanTachRejects(uint8_t) { return 0; }
+#endif
@@ -0,0 +1,116 @@
+#include "heaptrace.h"
+
+#if HEAPTRACE
+#include <esp_heap_caps.h>
+#include <esp_system.h>
+
+extern "C" {
+void* __real_malloc(size_t n);
+void  __real_free(void* p);
+void* __real_calloc(size_t n, size_t sz);
+void* __real_realloc(void* p, size_t n);
+}
+
+static const char* const kName[HEAP_TAG_COUNT] = { "loop", "ingest", "render", "web", "wifi" };
+
+static HeapTagStats     s_st[HEAP_TAG_COUNT];
+static portMUX_TYPE     s_mux        = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t     s_loopTask   = nullptr;
+static volatile HeapTag s_tag        = HEAP_LOOP;
+static uint32_t         s_minLargest = UINT32_MAX;
+static uint32_t         s_iterAllocs = 0;   // loop task, outside HEAP_WEB, this iteration
+static uint32_t         s_allocLoops = 0;
+
+static HeapTag tagNow() {
+  return (s_loopTask && xTaskGetCurrentTaskHandle() == s_loopTask) ? s_tag : HEAP_WIFI;
+}
+
+// Counter updates only; never allocate in here
+static void noteAlloc(void* p) {
+  if (!p) return;
+  const size_t sz = heap_caps_get_allocated_size(p);
+  const HeapTag t = tagNow();
+  portENTER_CRITICAL(&s_mux);
+  s_st[t].allocs++;
+  s_st[t].allocBytes += sz;
+  if (t != HEAP_WEB && t != HEAP_WIFI) s_iterAllocs++;
+  portEXIT_CRITICAL(&s_mux);
+}
+
+static void noteFree(void* p) {
+  if (!p) return;
+  const size_t sz = heap_caps_get_allocated_size(p);
+  const HeapTag t = tagNow();
+  portENTER_CRITICAL(&s_mux);
+  s_st[t].frees++;
+  s_st[t].freeBytes += sz;
+  portEXIT_CRITICAL(&s_mux);
+}
+
+extern "C" {
+void* __wrap_malloc(size_t n) {
+  void* p = __real_malloc(n);
+  noteAlloc(p);
+  return p;
+}
+
+void __wrap_free(void* p) {
+  noteFree(p);
+  __real_free(p);
+}
+
+void* __wrap_calloc(size_t n, size_t sz) {
+  void* p = __real_calloc(n, sz);
+  noteAlloc(p);
+  return p;
+}
+
+// Counted as free + alloc (when it moves or resizes a live block)
+void* __wrap_realloc(void* p, size_t n) {
+  noteFree(p);
+  void* q = __real_realloc(p, n);
+  if (q) noteAlloc(q);
+  else if (p && n) noteAlloc(p);       // failed: the old block is still live
+  return q;
+}
+}
+
+// ---- public ----
+void heapTraceBegin() { s_loopTask = xTaskGetCurrentTaskHandle(); }
+
+HeapTag heapTraceEnter(HeapTag t) {
+  const HeapTag prev = s_tag;
+  s_tag = t;
+  return prev;
+}
+
+void heapTraceLeave(HeapTag prev) { s_tag = prev; }
+
+HeapTagStats heapTraceStats(HeapTag t) {
+  HeapTagStats r = {0, 0, 0, 0};
+  if (t >= HEAP_TAG_COUNT) return r;
+  portENTER_CRITICAL(&s_mux);
+  r = s_st[t];
+  portEXIT_CRITICAL(&s_mux);
+  return r;
+}
+
+const char* heapTraceTagName(HeapTag t) { return t < HEAP_TAG_COUNT ? kName[t] : "?"; }
+
+// Walks the free list, so not per allocation
+void heapTraceSample() {
+  const uint32_t lb = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  if (lb < s_minLargest) s_minLargest = lb;
+}
+
+uint32_t heapTraceMinFree()    { return esp_get_minimum_free_heap_size(); }
+uint32_t heapTraceMinLargest() { return s_minLargest == UINT32_MAX ? 0 : s_minLargest; }
+
+void heapTraceLoopMark() {
+  if (s_iterAllocs) s_allocLoops++;
+  s_iterAllocs = 0;
+}
+
+uint32_t heapTraceAllocLoops() { return s_allocLoops; }
+
+#endif // HEAPTRACE
@@ -0,0 +1,69 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+
+// Heap allocation tracer (HEAPTRACE=1 plus the -Wl,--wrap=malloc/free/
+// calloc/realloc link flags in platformio.ini). Every allocation and free
+// is counted against the innermost HEAP_SCOPE tag on the loop task; calls
+// from any other task (Wi-Fi, lwIP, event loop) count as HEAP_WIFI.
+// Sizes are the heap's real block sizes. Free-heap floor and the smallest
+// largest-free-block are sampled by heapTraceSample().
+//
+// Only the malloc() family is wrapped. The Wi-Fi driver, lwIP and most IDF
+// components allocate through heap_caps_malloc(), which bypasses the
+// wrappers, so HEAP_WIFI undercounts by far; watch the free-heap floor for
+// those.
+//
+// heapTraceAllocLoops() is flat only in this steady state: no HTTP traffic,
+// no page render (pages build String values; HEAP_RENDER), and host frames
+// no larger than the largest one seen so far (the Debug preview reuses its
+// buffer and only grows). Every redraw (auto rotation, Debug refresh, tap,
+// fan alert) counts one iteration. test/test_heap_steady holds the non-web,
+// non-render part of it to zero allocations.
+enum HeapTag : uint8_t {
+  HEAP_LOOP,        // loop task, untagged
+  HEAP_INGEST,      // host link read/parse
+  HEAP_RENDER,      // e-ink pages
+  HEAP_WEB,         // web handlers, OTA
+  HEAP_WIFI,        // other tasks
+  HEAP_TAG_COUNT
+};
+
+struct HeapTagStats {
+  uint32_t allocs;
+  uint32_t frees;
+  uint32_t allocBytes;
+  uint32_t freeBytes;
+};
+
+#if HEAPTRACE
+  void         heapTraceBegin();               // setup(): the loop task is the caller
+  HeapTag      heapTraceEnter(HeapTag t);      // returns the tag to restore
+  void         heapTraceLeave(HeapTag prev);
+  HeapTagStats heapTraceStats(HeapTag t);
+  const char*  heapTraceTagName(HeapTag t);
+  void         heapTraceSample();              // once a second: largest block low-water mark
+  uint32_t     heapTraceMinFree();
+  uint32_t     heapTraceMinLargest();
+  void         heapTraceLoopMark();            // top of loop(): closes the previous iteration
+  uint32_t     heapTraceAllocLoops();          // iterations that allocated outside HEAP_WEB
+
+  struct HeapScope {
+    explicit HeapScope(HeapTag t) : prev(heapTraceEnter(t)) {}
+    ~HeapScope() { heapTraceLeave(prev); }
+    HeapTag prev;
+  };
+  #define HEAP_CAT2(a, b) a##b
+  #define HEAP_CAT(a, b)  HEAP_CAT2(a, b)
+  #define HEAP_SCOPE(t)   HeapScope HEAP_CAT(_heap_, __LINE__)(t)
+#else
+  inline void         heapTraceBegin() {}
+  inline HeapTagStats heapTraceStats(HeapTag) { return HeapTagStats{0, 0, 0, 0}; }
+  inline const char*  heapTraceTagName(HeapTag) { return ""; }
+  inline void         heapTraceSample() {}
+  inline uint32_t     heapTraceMinFree() { return 0; }
+  inline uint32_t     heapTraceMinLargest() { return 0; }
+  inline void         heapTraceLoopMark() {}
+  inline uint32_t     heapTraceAllocLoops() { return 0; }
+  #define HEAP_SCOPE(t) do {} while (0)
+#endif
@@ -0,0 +1,125 @@
+#include "logring.h"
+
+#if USE_LOG
+#include <stdarg.h>
+#include "clock.h"
+
+static_assert((LOG_RING_BYTES & (LOG_RING_BYTES - 1)) == 0, "LOG_RING_BYTES must be a power of two");
+static_assert(LOG_LINE_MAX >= 32 && LOG_LINE_MAX <= LOG_RING_BYTES / 4, "LOG_LINE_MAX out of range");
+
+static constexpr uint32_t kMask = LOG_RING_BYTES - 1;
+
+volatile uint8_t         g_logReaders = 0;
+static char              s_ring[LOG_RING_BYTES];
+static volatile uint32_t s_head   = 0;   // bytes ever written; always on a line boundary
+static portMUX_TYPE      s_mux    = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t          s_httpMs = 0;   // last /log request
+
+// ---- producer ----
+// Whole line in one critical section (≤ LOG_LINE_MAX bytes), so lines from
+// different tasks/ISRs never interleave and s_head only ever moves by lines
+static void IRAM_ATTR append(const char* s, size_t n) {
+  portENTER_CRITICAL_SAFE(&s_mux);
+  const uint32_t h = s_head;
+  for (size_t i = 0; i < n; ++i) s_ring[(h + i) & kMask] = s[i];
+  s_head = h + n;
+  portEXIT_CRITICAL_SAFE(&s_mux);
+}
+
+// "<ms> <tag>: " without printf (ISR-safe); returns the length
+static size_t IRAM_ATTR prefix(char* p, const char* tag) {
+  char t[10];
+  size_t n = 0, k = 0;
+  uint32_t v = clockMs();
+  do { t[k++] = (char)('0' + v % 10); v /= 10; } while (v);
+  while (k) p[n++] = t[--k];
+  p[n++] = ' ';
+  while (*tag && n < 24) p[n++] = *tag++;
+  p[n++] = ':';
+  p[n++] = ' ';
+  return n;
+}
+
+// Message text up to the line limit; embedded newlines would split the record
+static size_t IRAM_ATTR body(char* line, size_t n, const char* msg) {
+  while (*msg && n < LOG_LINE_MAX - 1) {
+    const char c = *msg++;
+    line[n++] = (c == '\n' || c == '\r') ? ' ' : c;
+  }
+  line[n++] = '\n';
+  return n;
+}
+
+void IRAM_ATTR logPut(const char* tag, const char* msg) {
+  if (!g_logReaders) return;
+  char line[LOG_LINE_MAX];
+  append(line, body(line, prefix(line, tag), msg));
+}
+
+void logPrintf(const char* tag, const char* fmt, ...) {
+  if (!g_logReaders) return;
+  char line[LOG_LINE_MAX];
+  char msg[LOG_LINE_MAX];
+  va_list ap;
+  va_start(ap, fmt);
+  vsnprintf(msg, sizeof(msg), fmt, ap);
+  va_end(ap);
+  append(line, body(line, prefix(line, tag), msg));
+}
+
+// ---- readers ----
+void logSetReader(LogReader r, bool on) {
+  if (r == LOG_RD_HTTP && on) s_httpMs = clockMs();
+  portENTER_CRITICAL(&s_mux);
+  g_logReaders = on ? (g_logReaders | r) : (g_logReaders & ~r);
+  portEXIT_CRITICAL(&s_mux);
+}
+
+void logTick() {
+  if ((g_logReaders & LOG_RD_HTTP) && clockMs() - s_httpMs >= LOG_HTTP_HOLD_MS) {
+    logSetReader(LOG_RD_HTTP, false);
+  }
+}
+
+uint32_t logHead() { return s_head; }
+
+// Lock-free: copy, then check the writer hasn't lapped the first copied
+// byte meanwhile; if it has (or the cursor was already stale), restart one
+// ring behind the head and drop the partial line there
+size_t logRead(uint32_t& cursor, char* out, size_t cap, uint32_t* lost) {
+  uint32_t skipped = 0;
+  bool resync = false;
+  size_t n = 0;
+  for (;;) {
+    const uint32_t head = s_head;
+    if (head - cursor > LOG_RING_BYTES) {
+      if (head <= LOG_RING_BYTES) {
+        cursor = 0;                                  // nothing overwritten yet (or a bogus cursor)
+      } else {
+        const uint32_t to = head - LOG_RING_BYTES + LOG_LINE_MAX;  // headroom for writes during the copy
+        if ((int32_t)(to - cursor) > 0) skipped += to - cursor;
+        cursor = to;
+        resync = true;
+      }
+    }
+    n = head - cursor;
+    if (n > cap) n = cap;
+    for (size_t i = 0; i < n; ++i) out[i] = s_ring[(cursor + i) & kMask];
+    if (s_head - cursor <= LOG_RING_BYTES) break;
+  }
+
+  size_t start = 0;
+  if (resync) {
+    while (start < n && out[start] != '\n') start++;
+    if (start < n) start++;
+    skipped += start;
+  }
+  size_t end = n;                                    // whole lines only
+  while (end > start && out[end - 1] != '\n') end--;
+  if (start) memmove(out, out + start, end - start);
+  cursor += end;
+  if (lost) *lost += skipped;
+  return end - start;
+}
+
+#endif // USE_LOG
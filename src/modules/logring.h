@@ -0,0 +1,37 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+
+// Log ring: text lines "<ms> <tag>: <msg>\n" in one byte ring. Tasks and
+// ISRs append under a short critical section; readers never lock, each
+// keeps its own cursor (a running byte count) and gets whole lines only.
+// A reader that falls a full ring behind skips to the oldest whole line
+// and is told how many bytes it lost.
+// Lines are formatted and stored only while somebody reads (the host link
+// with LOG_CDC, /log for LOG_HTTP_HOLD_MS after a request); otherwise
+// LOGF()/LOG_ISR() are a load and a branch.
+enum LogReader : uint8_t { LOG_RD_CDC = 1, LOG_RD_HTTP = 2 };
+
+#if USE_LOG
+  extern volatile uint8_t g_logReaders;
+  inline bool logActive() { return g_logReaders != 0; }
+  void     logSetReader(LogReader r, bool on);
+  void     logTick();                                  // once a second: /log reader timeout
+  void     logPut(const char* tag, const char* msg);   // any context, ISRs included
+  void     logPrintf(const char* tag, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+  uint32_t logHead();                                  // cursor just past the newest line
+  // Copies whole lines from cursor into out (cap ≥ LOG_LINE_MAX) and
+  // advances cursor; adds skipped bytes to *lost
+  size_t   logRead(uint32_t& cursor, char* out, size_t cap, uint32_t* lost = nullptr);
+#else
+  inline bool     logActive() { return false; }
+  inline void     logSetReader(LogReader, bool) {}
+  inline void     logTick() {}
+  inline void     logPut(const char*, const char*) {}
+  inline void     logPrintf(const char*, const char*, ...) {}
+  inline uint32_t logHead() { return 0; }
+  inline size_t   logRead(uint32_t&, char*, size_t, uint32_t* = nullptr) { return 0; }
+#endif
+
+#define LOGF(tag, ...)    do { if (logActive()) logPrintf(tag, __VA_ARGS__); } while (0)
+#define LOG_ISR(tag, msg) do { if (logActive()) logPut(tag, msg); } while (0)
@@ -0,0 +1,278 @@
+#include "config.h"
+#if USE_WIFI
+
+#include "metrics.h"
+#include "state.h"
+#include "display_manager.h"
+#include "serial_client.h"
+#include <WiFi.h>
+#include <stdarg.h>
+
+#include "modules/fans.h"
+#include "modules/sched.h"
+#include "modules/heaptrace.h"
+#if USE_DALLAS
+#include "modules/dallas.h"
+#endif
+#if USE_FANCTRL
+#include "modules/fanctrl.h"
+#endif
+
+// Chunk size of the streamed body; the longest line must fit
+#ifndef METRICS_BUF_BYTES
+#define METRICS_BUF_BYTES 1024
+#endif
+
+// Access to UI/display/host globals from main.cpp
+extern UiState        g_ui;
+extern HostState      g_host;
+extern DisplayManager g_disp;
+extern SerialClient   g_serial;
+#if USE_DALLAS
+extern DallasProbe    g_dallas;
+#endif
+
+// Reused for every scrape; only the loop task touches it
+static char        s_buf[METRICS_BUF_BYTES];
+static size_t      s_len   = 0;
+static size_t      s_total = 0;
+static MetricsSink s_sink  = nullptr;
+
+// ---- writers ----
+static void flush() {
+  if (s_len) s_sink(s_buf, s_len);
+  s_total += s_len;
+  s_len = 0;
+}
+
+// printf-append of whole lines: if one does not fit, the buffer goes to the
+// sink first and the line is formatted again at the start. A line longer
+// than the whole buffer is dropped, never cut.
+static void put(const char* fmt, ...) {
+  for (uint8_t pass = 0; pass < 2; ++pass) {
+    va_list ap;
+    va_start(ap, fmt);
+    const int w = vsnprintf(s_buf + s_len, sizeof(s_buf) - s_len, fmt, ap);
+    va_end(ap);
+    if (w < 0) return;
+    if ((size_t)w < sizeof(s_buf) - s_len) { s_len += (size_t)w; return; }
+    if (s_len == 0) return;
+    flush();
+  }
+}
+
+static void meta(const char* name, const char* type, const char* help) {
+  put("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+static void sampleF(const char* name, const char* labels, float v) {
+  if (isnan(v)) put("%s%s NaN\n", name, labels);
+  else          put("%s%s %.2f\n", name, labels, v);
+}
+
+static void sampleU(const char* name, const char* labels, uint32_t v) {
+  put("%s%s %lu\n", name, labels, (unsigned long)v);
+}
+
+static void sampleI(const char* name, const char* labels, int32_t v) {
+  put("%s%s %ld\n", name, labels, (long)v);
+}
+
+static void counter(const char* name, const char* help, uint32_t v) {
+  meta(name, "counter", help);
+  sampleU(name, "", v);
+}
+
+static void gaugeF(const char* name, const char* help, float v) {
+  meta(name, "gauge", help);
+  sampleF(name, "", v);
+}
+
+static void gaugeI(const char* name, const char* help, int32_t v) {
+  meta(name, "gauge", help);
+  sampleI(name, "", v);
+}
+
+// ---- fan channels ----
+enum FanField : uint8_t { FF_CMD, FF_FILT, FF_APPLIED, FF_ACTIVE, FF_TARGET, FF_RPM, FF_FAULT,
+                          FF_TOGGLES, FF_KICKS, FF_AVG_DUTY, FF_GLITCHES, FF_REJECTS };
+
+static const char* const kFanLabel[MAX_FANS] = {
+  "{fan=\"1\"}", "{fan=\"2\"}", "{fan=\"3\"}", "{fan=\"4\"}"
+};
+
+// Real-valued fields (NaN = unknown); everything else is a count or a state
+static bool fanIsReal(FanField f) {
+  return f == FF_CMD || f == FF_FILT || f == FF_TARGET || f == FF_AVG_DUTY;
+}
+
+static float fanValueF(uint8_t ch, FanField f) {
+  const FanTelemetry& t = g_host.fan[ch];
+  switch (f) {
+  case FF_CMD:     return t.duty_cmd;
+  case FF_FILT:    return t.duty_filt;
+  case FF_TARGET:  return t.rpm_target;
+#if USE_FANCTRL
+  case FF_AVG_DUTY: return fanCtrlStats(ch).avgDutyPct;
+#endif
+  default:         break;
+  }
+  return NAN;
+}
+
+static int64_t fanValueI(uint8_t ch, FanField f) {
+  const FanTelemetry& t = g_host.fan[ch];
+  switch (f) {
+  case FF_APPLIED:  return fanPwmGetPercent(ch);
+  case FF_ACTIVE:   return t.active;
+  case FF_RPM:      return fanTachGetRPM(ch);
+  case FF_FAULT:    return t.fault;
+  case FF_GLITCHES: return fanTachGlitches(ch);
+  case FF_REJECTS:  return fanTachRejects(ch);
+#if USE_FANCTRL
+  case FF_TOGGLES:  return fanCtrlStats(ch).toggles;
+  case FF_KICKS:    return fanCtrlStats(ch).kicks;
+#endif
+  default:          break;
+  }
+  return 0;
+}
+
+// One series per channel that has the needed hardware; nothing if none has
+static void fanSeries(const char* name, const char* type, const char* help, FanField f,
+                      bool needPwm, bool needTach) {
+  bool first = true;
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+    if ((needPwm && !fanHasPwm(ch)) || (needTach && !fanHasTach(ch))) continue;
+    if (first) { meta(name, type, help); first = false; }
+    if (fanIsReal(f))                    sampleF(name, kFanLabel[ch], fanValueF(ch, f));
+    else if (!strcmp(type, "counter"))   sampleU(name, kFanLabel[ch], (uint32_t)fanValueI(ch, f));
+    else                                 sampleI(name, kFanLabel[ch], (int32_t)fanValueI(ch, f));
+  }
+}
+
+static void fanGauge(const char* name, const char* help, FanField f, bool needPwm, bool needTach) {
+  fanSeries(name, "gauge", help, f, needPwm, needTach);
+}
+
+#if USE_DALLAS
+// ---- Dallas probes ----
+// Labelled by bus position and ROM code, so a swapped probe shows up as a new series
+static void probeLabels(uint8_t i, char* out, size_t cap) {
+  const uint8_t* r = g_dallas.rom(i);
+  snprintf(out, cap, "{probe=\"%u\",rom=\"%02x%02x%02x%02x%02x%02x%02x%02x\"}",
+           (unsigned)i, r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7]);
+}
+
+static void probeSeries() {
+  char lb[48];
+  gaugeI("thinklab_probe_fast_mode", "1 while probes are sampled fast at full resolution.", g_dallas.fastMode());
+  gaugeI("thinklab_onewire_rmt",     "1 when the 1-Wire bus runs on the RMT driver (DALLAS_RMT).", DALLAS_RMT);
+  counter("thinklab_onewire_busy_ms_total", "Time spent in 1-Wire bus transactions.", g_dallas.busyMs());
+  gaugeI("thinklab_onewire_block_us_max",  "Longest single 1-Wire step since boot.", (int32_t)g_dallas.maxStepUs());
+  meta("thinklab_probe_temp_celsius", "gauge", "Dallas probe temperature (NaN = last read failed).");
+  for (uint8_t i = 0; i < g_dallas.count(); ++i) {
+    probeLabels(i, lb, sizeof(lb));
+    sampleF("thinklab_probe_temp_celsius", lb, g_dallas.tempC(i));
+  }
+  meta("thinklab_probe_crc_errors_total", "counter", "Scratchpad reads with a bad CRC.");
+  for (uint8_t i = 0; i < g_dallas.count(); ++i) {
+    probeLabels(i, lb, sizeof(lb));
+    sampleU("thinklab_probe_crc_errors_total", lb, g_dallas.crcErrors(i));
+  }
+  meta("thinklab_probe_missing_total", "counter", "Reads without presence pulse or conversion.");
+  for (uint8_t i = 0; i < g_dallas.count(); ++i) {
+    probeLabels(i, lb, sizeof(lb));
+    sampleU("thinklab_probe_missing_total", lb, g_dallas.missing(i));
+  }
+}
+#endif
+
+#if HEAPTRACE
+// ---- heap tracer ----
+static void heapSeries(const char* name, const char* help, uint8_t field) {
+  char lb[24];
+  meta(name, "counter", help);
+  for (uint8_t t = 0; t < HEAP_TAG_COUNT; ++t) {
+    const HeapTagStats st = heapTraceStats((HeapTag)t);
+    const uint32_t v[] = { st.allocs, st.frees, st.allocBytes, st.freeBytes };
+    snprintf(lb, sizeof(lb), "{tag=\"%s\"}", heapTraceTagName((HeapTag)t));
+    sampleU(name, lb, v[field]);
+  }
+}
+#endif
+
+// ---- public ----
+size_t metricsRender(MetricsSink sink) {
+  s_sink  = sink;
+  s_len   = 0;
+  s_total = 0;
+
+  put("# HELP thinklab_build_info Firmware build.\n# TYPE thinklab_build_info gauge\n");
+  put("thinklab_build_info{fw=\"%s\",build=\"%s\"} 1\n", FW_VERSION, BUILD_VERSION);
+
+  // ---- host link / parser ----
+  counter("thinklab_parse_ok_total",    "Accepted host JSON frames.",        g_ui.parseOkCount);
+  counter("thinklab_parse_err_total",   "Host JSON frames that failed to parse.", g_ui.parseErrCount);
+  counter("thinklab_rx_overflow_total", "Frames dropped by RX buffer overflow.",  g_ui.rxOverflowCnt);
+  gaugeI("thinklab_host_link_up",       "1 while the USB serial link is connected.", g_serial.hostLinkUp());
+  gaugeI("thinklab_host_gets_missed",   "Unanswered GETs in a row (backoff exponent).", g_serial.getsMissed());
+  counter("thinklab_tx_dropped_total",  "Lines dropped because the host was not reading.", g_serial.txDrops());
+  gaugeI("thinklab_last_json_bytes",    "Length of the last received frame.", g_ui.lastJsonLen);
+  gaugeF("thinklab_link_age_seconds",   "Seconds since the last accepted frame.",
+         g_ui.lastParseOkMs ? (float)(clockMs() - g_ui.lastParseOkMs) / 1000.0f : NAN);
+
+  // ---- fan channels ----
+  fanGauge("thinklab_fan_duty_cmd_percent",     "Fan command from the curve.",       FF_CMD,     true,  false);
+  fanGauge("thinklab_fan_duty_filt_percent",    "Fan command after rate limit/EMA.", FF_FILT,    true,  false);
+  fanGauge("thinklab_fan_duty_applied_percent", "Duty written to the PWM output.",   FF_APPLIED, true,  false);
+  fanGauge("thinklab_fan_active",               "1 while the fan is commanded on.",  FF_ACTIVE,  true,  false);
+#if FAN_CTRL_MODE == 1
+  fanGauge("thinklab_fan_rpm_target",           "Closed-loop RPM target.",           FF_TARGET,  true,  true);
+#endif
+  fanGauge("thinklab_fan_rpm",                  "Tach RPM (-1 = unknown).",          FF_RPM,     false, true);
+  // Tach error: compare rate() of these with the 1-Wire busy time (DALLAS_RMT on/off)
+  fanSeries("thinklab_fan_tach_glitches_total", "counter", "Tach edges dropped by the ISR gate.",  FF_GLITCHES, false, true);
+  fanSeries("thinklab_fan_tach_rejects_total",  "counter", "Tach periods dropped as outliers.",    FF_REJECTS,  false, true);
+#if USE_FANMON
+  fanGauge("thinklab_fan_fault",                "0 ok, 1 no tach, 2 stall, 3 degraded.", FF_FAULT, true, true);
+#endif
+#if USE_FANCTRL && FAN_USE_FF
+  gaugeF("thinklab_fan_ff_percent", "Load-trend feed-forward added to every fan.", g_host.fan_ff_pct);
+#endif
+#if USE_FANCTRL
+  // Tuning: rate(toggles) over an hour is the flapping figure to keep near 0
+  fanSeries("thinklab_fan_toggles_total", "counter", "Controller ON/OFF transitions.", FF_TOGGLES, true, false);
+  fanSeries("thinklab_fan_kicks_total",   "counter", "Start and recovery kicks.",      FF_KICKS,   true, false);
+  fanGauge("thinklab_fan_duty_avg_percent", "Time-weighted applied duty since boot.", FF_AVG_DUTY, true, false);
+  gaugeI("thinklab_fanctrl_tick_cycles",     "CPU cycles of the last fan control tick.", (int32_t)fanCtrlTickCycles());
+  gaugeI("thinklab_fanctrl_tick_cycles_max", "Worst fan control tick since boot.",      (int32_t)fanCtrlTickCyclesMax());
+#endif
+
+  // ---- local sensors / system ----
+  gaugeF("thinklab_case_temp_celsius", "Dallas case temperature.", g_host.local_temp_c);
+#if USE_DALLAS
+  probeSeries();
+#endif
+  gaugeI("thinklab_wifi_rssi_dbm",     "Wi-Fi RSSI.", WiFi.isConnected() ? WiFi.RSSI() : -127);
+  gaugeI("thinklab_heap_free_bytes",   "Free heap.", (int32_t)ESP.getFreeHeap());
+#if HEAPTRACE
+  heapSeries("thinklab_heap_allocs_total",      "Allocations by subsystem.",       0);
+  heapSeries("thinklab_heap_frees_total",       "Frees by subsystem.",             1);
+  heapSeries("thinklab_heap_alloc_bytes_total", "Bytes allocated by subsystem.",   2);
+  heapSeries("thinklab_heap_free_bytes_total",  "Bytes freed by subsystem.",       3);
+  gaugeI("thinklab_heap_min_free_bytes",    "Lowest free heap since boot.",              (int32_t)heapTraceMinFree());
+  gaugeI("thinklab_heap_min_largest_bytes", "Smallest largest-free-block seen.",         (int32_t)heapTraceMinLargest());
+  counter("thinklab_heap_alloc_loops_total", "Loop iterations that allocated outside web handlers.", heapTraceAllocLoops());
+#endif
+  gaugeI("thinklab_cpu_idle_percent",  "Loop task idle share over the last second.", schedIdlePct());
+  gaugeI("thinklab_boot_pixels_ms",     "Boot to first dashboard on the panel (0 = not yet).", (int32_t)g_ui.bootPixelsMs);
+  gaugeI("thinklab_boot_live_ms",       "Boot to first dashboard with live host data (0 = not yet).", (int32_t)g_ui.bootLiveMs);
+  counter("thinklab_uptime_seconds",   "ESP uptime.", clockUptimeMs() / 1000UL);
+  counter("thinklab_renders_total",    "Full e-ink page renders.", g_disp.renderCount());
+
+  flush();
+  return s_total;
+}
+
+#endif // USE_WIFI
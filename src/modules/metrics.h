@@ -0,0 +1,9 @@
+#pragma once
+#include <Arduino.h>
+
+// Prometheus text exposition for /metrics.
+// Formats into a small module-owned buffer (no String / heap use) and hands
+// it to sink whenever the next line would not fit, so the body has no size
+// limit and the sink only ever sees whole lines. Returns the total length.
+typedef void (*MetricsSink)(const char* data, size_t len);
+size_t metricsRender(MetricsSink sink);
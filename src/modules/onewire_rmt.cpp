@@ -0,0 +1,151 @@
+#include "onewire_rmt.h"
+
+#if DALLAS_RMT
+#include <driver/rmt.h>
+#include <driver/gpio.h>
+#include <soc/rmt_periph.h>
+#include <esp_rom_gpio.h>
+
+// 1 µs ticks (APB 80 MHz / 80); standard-speed slot timings
+static constexpr rmt_channel_t kTx = RMT_CHANNEL_0;
+static constexpr rmt_channel_t kRx = RMT_CHANNEL_2;    // C3: RX-capable channels are 2..3
+static constexpr uint16_t kResetLowUs  = 480;
+static constexpr uint16_t kResetWaitUs = 70;
+static constexpr uint16_t kSlotUs      = 70;
+static constexpr uint16_t kW0LowUs     = 60;
+static constexpr uint16_t kW1LowUs     = 6;             // also the read-slot start
+static constexpr uint16_t kRead0Us     = 15;            // low longer than this = slave sent 0
+static constexpr uint16_t kRxIdleUs    = 100;           // line high this long = frame over
+
+static RingbufHandle_t s_rb = nullptr;
+
+bool OneWireRmt::begin() {
+  rmt_config_t tx = RMT_DEFAULT_CONFIG_TX((gpio_num_t)pin_, kTx);
+  tx.clk_div = 80;
+  tx.tx_config.idle_output_en = true;
+  tx.tx_config.idle_level     = RMT_IDLE_LEVEL_HIGH;   // released (open drain)
+  rmt_config_t rx = RMT_DEFAULT_CONFIG_RX((gpio_num_t)pin_, kRx);
+  rx.clk_div = 80;
+  rx.rx_config.idle_threshold      = kRxIdleUs;
+  rx.rx_config.filter_en           = true;
+  rx.rx_config.filter_ticks_thresh = 80;               // 1 µs (APB ticks)
+
+  if (rmt_config(&tx) != ESP_OK || rmt_driver_install(kTx, 0, 0) != ESP_OK) return false;
+  if (rmt_config(&rx) != ESP_OK || rmt_driver_install(kRx, 512, 0) != ESP_OK) return false;
+  rmt_get_ringbuf_handle(kRx, &s_rb);
+
+  // rmt_config() set the pin to plain output, then plain input: make it
+  // open drain with both signals routed (RX sees our own slots + the slave)
+  gpio_set_pull_mode((gpio_num_t)pin_, GPIO_PULLUP_ONLY);
+  gpio_set_direction((gpio_num_t)pin_, GPIO_MODE_INPUT_OUTPUT_OD);
+  esp_rom_gpio_connect_out_signal(pin_, rmt_periph_signals.groups[0].channels[kTx].tx_sig, false, false);
+  esp_rom_gpio_connect_in_signal(pin_, rmt_periph_signals.groups[0].channels[kRx].rx_sig, false);
+  ok_ = s_rb != nullptr;
+  return ok_;
+}
+
+// Send items, collect the low pulses the RX channel saw (ours stretched by the slave)
+static size_t xfer(const rmt_item32_t* items, size_t n, uint16_t* lows, size_t maxLows) {
+  size_t sz = 0;
+  void* stale;
+  while ((stale = xRingbufferReceive(s_rb, &sz, 0)) != nullptr) vRingbufferReturnItem(s_rb, stale);
+
+  rmt_rx_start(kRx, true);
+  rmt_write_items(kTx, items, n, true);                     // blocks on a semaphore, IRQs stay on
+  rmt_item32_t* rx = (rmt_item32_t*)xRingbufferReceive(s_rb, &sz, pdMS_TO_TICKS(3));
+  rmt_rx_stop(kRx);
+  if (!rx) return 0;
+
+  size_t k = 0;
+  for (size_t i = 0; i < sz / sizeof(rmt_item32_t) && k < maxLows; ++i) {
+    if (rx[i].level0 == 0 && rx[i].duration0) lows[k++] = rx[i].duration0;
+    if (k < maxLows && rx[i].level1 == 0 && rx[i].duration1) lows[k++] = rx[i].duration1;
+  }
+  vRingbufferReturnItem(s_rb, rx);
+  return k;
+}
+
+uint8_t OneWireRmt::reset() {
+  if (!ok_) return 0;
+  const rmt_item32_t it = {{{ kResetLowUs, 0, kResetWaitUs, 1 }}};
+  uint16_t lows[4];
+  const size_t k = xfer(&it, 1, lows, 4);
+  // our 480 µs low, then the presence pulse (60..240 µs)
+  return (k >= 2 && lows[1] >= 40 && lows[1] <= 300) ? 1 : 0;
+}
+
+bool OneWireRmt::slots(uint8_t n, uint32_t bits, uint32_t* rd) {
+  if (!ok_ || n > 32) return false;
+  rmt_item32_t items[32];
+  for (uint8_t i = 0; i < n; ++i) {
+    const uint16_t low = ((bits >> i) & 1) ? kW1LowUs : kW0LowUs;
+    items[i].level0    = 0;
+    items[i].duration0 = low;
+    items[i].level1    = 1;
+    items[i].duration1 = kSlotUs - low;
+  }
+  uint16_t lows[32];
+  const size_t k = xfer(items, n, lows, n);
+  if (k != n) return false;
+  if (rd) {
+    uint32_t v = 0;
+    for (uint8_t i = 0; i < n; ++i) {
+      if (lows[i] < kRead0Us) v |= (1UL << i);
+    }
+    *rd = v;
+  }
+  return true;
+}
+
+void OneWireRmt::write(uint8_t v) { slots(8, v, nullptr); }
+
+uint8_t OneWireRmt::read() {
+  uint32_t v = 0xFF;
+  slots(8, 0xFF, &v);                 // all read slots; a failed transfer reads as idle bus
+  return (uint8_t)v;
+}
+
+void OneWireRmt::skip() { write(0xCC); }
+
+void OneWireRmt::select(const uint8_t rom[8]) {
+  write(0x55);
+  for (uint8_t i = 0; i < 8; ++i) write(rom[i]);
+}
+
+void OneWireRmt::reset_search() {
+  memset(romNo_, 0, sizeof(romNo_));
+  lastDiscrep_ = -1;
+  lastDevice_  = false;
+}
+
+// One ROM per call; each bit is a two-slot read (bit, complement) and a write
+bool OneWireRmt::search(uint8_t* rom) {
+  if (lastDevice_ || !reset()) { reset_search(); return false; }
+  write(0xF0);
+
+  int8_t zeroDiscrep = -1;
+  for (uint8_t b = 0; b < 64; ++b) {
+    uint32_t two = 0;
+    if (!slots(2, 0x3, &two)) { reset_search(); return false; }
+    const bool bit = two & 1, cmp = two & 2;
+    if (bit && cmp) { reset_search(); return false; }      // nobody answered
+
+    const uint8_t mask = (uint8_t)(1u << (b & 7));
+    bool dir;
+    if (bit != cmp) {
+      dir = bit;                                           // all remaining ROMs agree
+    } else {
+      // conflict: follow the previous path, go 1 at the last branch point
+      dir = b < lastDiscrep_ ? (romNo_[b >> 3] & mask) != 0 : b == lastDiscrep_;
+      if (!dir) zeroDiscrep = (int8_t)b;
+    }
+    if (dir) romNo_[b >> 3] |= mask; else romNo_[b >> 3] &= (uint8_t)~mask;
+    slots(1, dir ? 1 : 0, nullptr);
+  }
+  lastDiscrep_ = zeroDiscrep;
+  lastDevice_  = zeroDiscrep < 0;
+  memcpy(rom, romNo_, 8);
+  return true;
+}
+
+#endif // DALLAS_RMT
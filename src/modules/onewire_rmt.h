@@ -0,0 +1,38 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+
+// 1-Wire master on the RMT peripheral (DALLAS_RMT=1): TX channel drives the
+// slots, RX channel on the same open-drain pin times them, so reset/read/write
+// never mask interrupts (tach ISRs keep their timestamps). The loop task
+// sleeps on the driver semaphore while a transfer runs.
+// Same calls as the OneWire library subset dallas.cpp uses. No parasite
+// power: probes need VDD.
+#if DALLAS_RMT
+class OneWireRmt {
+public:
+  explicit OneWireRmt(uint8_t pin) : pin_(pin) {}
+
+  bool    begin();                       // false: RMT channels unavailable
+  uint8_t reset();                       // 1 = presence pulse seen
+  void    select(const uint8_t rom[8]);
+  void    skip();
+  void    write(uint8_t v);
+  uint8_t read();
+
+  void    reset_search();
+  bool    search(uint8_t* rom);          // next ROM (CRC not checked here)
+
+private:
+  uint8_t pin_;
+  bool    ok_ = false;
+
+  // search state (Maxim AN187)
+  uint8_t romNo_[8]     = {0};
+  int8_t  lastDiscrep_  = -1;
+  bool    lastDevice_   = false;
+
+  // n slots (LSB first): write bits, or read when rd (slot = write-1)
+  bool    slots(uint8_t n, uint32_t bits, uint32_t* rd);
+};
+#endif
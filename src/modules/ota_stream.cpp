@@ -0,0 +1,276 @@
+#include "config.h"
+#if USE_WIFI
+
+#include "ota_stream.h"
+#include "clock.h"
+#include <Update.h>
+#include <mbedtls/sha256.h>
+#include <esp_rom_crc.h>
+#include <rom/miniz.h>   // ROM inflater (tinfl_*), no extra flash cost
+
+// Deflate back-references reach up to 32 KiB, so that is the output window.
+// Both buffers are heap-allocated for the duration of one upload only.
+static constexpr size_t kDictSize = TINFL_LZ_DICT_SIZE;
+
+// Flash writes are issued in slices of this size with a service call between
+#ifndef OTA_SLICE_BYTES
+#define OTA_SLICE_BYTES 4096
+#endif
+
+// ---- gzip framing (RFC 1952) ----
+enum GzState : uint8_t {
+  GZ_DETECT,      // first byte decides raw vs gzip
+  GZ_HEADER,      // 10 fixed bytes
+  GZ_EXTRA_LEN,
+  GZ_EXTRA,
+  GZ_NAME,
+  GZ_COMMENT,
+  GZ_HCRC,
+  GZ_INFLATE,
+  GZ_TRAILER,     // CRC32 + ISIZE: whatever tinfl left of the last 8 bytes
+  GZ_RAW
+};
+
+static constexpr uint8_t GZF_HCRC    = 0x02;
+static constexpr uint8_t GZF_EXTRA   = 0x04;
+static constexpr uint8_t GZF_NAME    = 0x08;
+static constexpr uint8_t GZF_COMMENT = 0x10;
+
+static bool      s_active = false;
+static GzState   s_gz     = GZ_DETECT;
+static uint8_t   s_hdr[10];
+static uint8_t   s_hdrN   = 0;
+static uint8_t   s_flags  = 0;
+static uint16_t  s_skip   = 0;       // bytes left in EXTRA/HCRC, TRAILER fill
+static uint8_t   s_xlenN  = 0;
+// The trailer is taken from the last 8 bytes received, not from the bytes
+// after the deflate end: the ROM tinfl reads ahead into its bit buffer and
+// may already have consumed part of it when it reports DONE
+static uint8_t   s_tail[8];
+
+static tinfl_decompressor* s_inf  = nullptr;
+static uint8_t*            s_dict = nullptr;
+static size_t              s_dictOfs = 0;
+static uint32_t            s_crc  = 0;
+
+static mbedtls_sha256_context s_sha;
+static bool        s_shaLive = false;
+static char        s_expect[65] = {0};
+static const char* s_err = "";
+static uint32_t    s_t0  = 0;
+static OtaStreamStats s_stats;
+
+// ---- helpers ----
+static void keepTail(const uint8_t* p, size_t n) {
+  if (n >= sizeof(s_tail)) { memcpy(s_tail, p + n - sizeof(s_tail), sizeof(s_tail)); return; }
+  memmove(s_tail, s_tail + n, sizeof(s_tail) - n);
+  memcpy(s_tail + sizeof(s_tail) - n, p, n);
+}
+
+static void releaseBuffers() {
+  free(s_inf);  s_inf  = nullptr;
+  free(s_dict); s_dict = nullptr;
+}
+
+static void shaRelease() {
+  if (s_shaLive) mbedtls_sha256_free(&s_sha);
+  s_shaLive = false;
+}
+
+static bool fail(const char* why) {
+  s_err = why;
+  if (s_active) Update.abort();
+  shaRelease();
+  releaseBuffers();
+  s_active = false;
+  s_stats.elapsedMs = clockMs() - s_t0;
+  return false;
+}
+
+// Every byte that reaches flash goes through here, one bounded slice at a time
+static bool emit(uint8_t* p, size_t n) {
+  while (n > 0) {
+    const size_t k = n < OTA_SLICE_BYTES ? n : OTA_SLICE_BYTES;
+    mbedtls_sha256_update(&s_sha, p, k);
+    if (s_gz != GZ_RAW) s_crc = esp_rom_crc32_le(s_crc, p, k);
+
+    const uint32_t t = clockUs();
+    const size_t w = Update.write(p, k);
+    s_stats.flashUs += clockUs() - t;
+    if (w != k) return fail("Flash write failed");
+    s_stats.bytesOut += k;
+    p += k; n -= k;
+
+    otaServiceCriticalTasks();
+  }
+  return true;
+}
+
+// Feed compressed bytes; consumes as much as possible, returns leftovers via *used
+static bool inflateSome(const uint8_t* in, size_t avail, size_t* used) {
+  *used = 0;
+  while (s_gz == GZ_INFLATE) {
+    size_t inBytes  = avail;
+    size_t outBytes = kDictSize - s_dictOfs;
+    const tinfl_status st = tinfl_decompress(s_inf, in, &inBytes,
+                                             s_dict, s_dict + s_dictOfs, &outBytes,
+                                             TINFL_FLAG_HAS_MORE_INPUT);
+    in += inBytes; avail -= inBytes; *used += inBytes;
+    if (inBytes == 0 && outBytes == 0 && st == TINFL_STATUS_NEEDS_MORE_INPUT) break;
+
+    if (!emit(s_dict + s_dictOfs, outBytes)) return false;
+    s_dictOfs = (s_dictOfs + outBytes) & (kDictSize - 1);
+
+    if (st == TINFL_STATUS_DONE) { s_gz = GZ_TRAILER; s_skip = 0; releaseBuffers(); break; }
+    if (st < 0) return fail("Corrupt gzip stream");
+    // HAS_MORE_OUTPUT → go again, even with no input left (the window was full)
+    if (st == TINFL_STATUS_NEEDS_MORE_INPUT && avail == 0) break;
+  }
+  return true;
+}
+
+// ---- public ----
+bool otaStreamBegin(const char* expectSha256Hex) {
+  if (s_active) otaStreamAbort();
+
+  s_stats   = OtaStreamStats();
+  s_err     = "";
+  s_gz      = GZ_DETECT;
+  s_hdrN    = 0;
+  s_flags   = 0;
+  s_skip    = 0;
+  s_xlenN   = 0;
+  s_dictOfs = 0;
+  s_crc     = 0;
+  s_t0      = clockMs();
+
+  s_expect[0] = 0;
+  if (expectSha256Hex && expectSha256Hex[0]) {
+    if (strlen(expectSha256Hex) != 64) { s_err = "SHA-256 must be 64 hex chars"; return false; }
+    for (uint8_t i = 0; i < 64; ++i) s_expect[i] = (char)tolower((unsigned char)expectSha256Hex[i]);
+    s_expect[64] = 0;
+  }
+
+  if (!Update.begin(UPDATE_SIZE_UNKNOWN)) { s_err = "Update begin failed"; return false; }
+
+  mbedtls_sha256_init(&s_sha);
+  mbedtls_sha256_starts(&s_sha, 0);
+  s_shaLive = true;
+  s_active  = true;
+  return true;
+}
+
+bool otaStreamWrite(uint8_t* data, size_t len) {
+  if (!s_active) return false;
+  s_stats.bytesIn += len;
+  keepTail(data, len);
+
+  size_t i = 0;
+  while (i < len) {
+    switch (s_gz) {
+    case GZ_DETECT:
+      if (data[i] != 0x1F) { s_gz = GZ_RAW; break; }   // plain .bin (starts 0xE9)
+      s_gz = GZ_HEADER;
+      s_stats.gzip = true;
+      break;
+
+    case GZ_HEADER:
+      s_hdr[s_hdrN++] = data[i++];
+      if (s_hdrN < sizeof(s_hdr)) break;
+      if (s_hdr[1] != 0x8B || s_hdr[2] != 8) return fail("Not a deflate gzip stream");
+      s_flags = s_hdr[3];
+      s_skip  = 0;
+      s_gz    = (s_flags & GZF_EXTRA) ? GZ_EXTRA_LEN : GZ_NAME;
+      break;
+
+    case GZ_EXTRA_LEN:             // XLEN, 2 bytes little-endian
+      s_skip |= (uint16_t)data[i++] << (8 * s_xlenN);
+      if (++s_xlenN == 2) s_gz = s_skip ? GZ_EXTRA : GZ_NAME;
+      break;
+
+    case GZ_EXTRA:
+      ++i;
+      if (--s_skip == 0) s_gz = GZ_NAME;
+      break;
+
+    case GZ_NAME:
+      if (!(s_flags & GZF_NAME)) { s_gz = GZ_COMMENT; break; }
+      if (data[i++] == 0) s_flags &= ~GZF_NAME;
+      break;
+
+    case GZ_COMMENT:
+      if (!(s_flags & GZF_COMMENT)) { s_gz = GZ_HCRC; s_skip = 2; break; }
+      if (data[i++] == 0) s_flags &= ~GZF_COMMENT;
+      break;
+
+    case GZ_HCRC:
+      if (!(s_flags & GZF_HCRC) || s_skip == 0) {
+        s_inf  = (tinfl_decompressor*)malloc(sizeof(tinfl_decompressor));
+        s_dict = (uint8_t*)malloc(kDictSize);
+        if (!s_inf || !s_dict) return fail("Out of memory for inflate");
+        tinfl_init(s_inf);
+        s_gz = GZ_INFLATE;
+        break;
+      }
+      ++i; --s_skip;
+      break;
+
+    case GZ_INFLATE: {
+      size_t used = 0;
+      if (!inflateSome(data + i, len - i, &used)) return false;
+      i += used;
+      break;
+    }
+
+    case GZ_TRAILER:
+      s_skip += len - i;
+      if (s_skip > sizeof(s_tail)) return fail("Trailing data after gzip stream");
+      i = len;
+      break;
+
+    case GZ_RAW:
+      if (!emit(data + i, len - i)) return false;
+      i = len;
+      break;
+    }
+  }
+  return true;
+}
+
+bool otaStreamEnd() {
+  if (!s_active) return false;
+
+  if (s_stats.gzip) {
+    // tinfl reads ahead at most 4 bytes, so at least half the trailer is left over
+    if (s_gz != GZ_TRAILER || s_skip < sizeof(s_tail) / 2) return fail("Truncated gzip stream");
+    const uint32_t crc   = s_tail[0] | (s_tail[1] << 8) | (s_tail[2] << 16) | ((uint32_t)s_tail[3] << 24);
+    const uint32_t isize = s_tail[4] | (s_tail[5] << 8) | (s_tail[6] << 16) | ((uint32_t)s_tail[7] << 24);
+    if (crc != s_crc || isize != s_stats.bytesOut) return fail("gzip CRC/size mismatch");
+  }
+
+  uint8_t digest[32];
+  mbedtls_sha256_finish(&s_sha, digest);
+  shaRelease();
+  for (uint8_t i = 0; i < 32; ++i) snprintf(&s_stats.sha256[i * 2], 3, "%02x", digest[i]);
+
+  if (s_expect[0] && strcmp(s_expect, s_stats.sha256) != 0) return fail("SHA-256 mismatch");
+
+  const uint32_t t = clockUs();
+  const bool ok = Update.end(true) && !Update.hasError();
+  s_stats.flashUs  += clockUs() - t;
+  s_stats.elapsedMs = clockMs() - s_t0;
+  s_active = false;
+  if (!ok) s_err = "Update failed";
+  return ok;
+}
+
+void otaStreamAbort() {
+  if (!s_active) return;
+  fail("Update aborted");
+}
+
+bool                  otaStreamActive() { return s_active; }
+const char*           otaStreamError()  { return s_err; }
+const OtaStreamStats& otaStreamStats()  { return s_stats; }
+
+#endif // USE_WIFI
@@ -0,0 +1,30 @@
+#pragma once
+#include <Arduino.h>
+
+// Streaming firmware writer for the HTTP /update path.
+// Accepts a raw .bin or a gzip-compressed one (auto-detected on the first
+// bytes), inflates on the fly into Update and hashes the *inflated* image
+// with SHA-256 so it can be checked before Update.end(true).
+
+struct OtaStreamStats {
+  bool     gzip       = false;
+  uint32_t bytesIn    = 0;   // as received (compressed if gzip)
+  uint32_t bytesOut   = 0;   // written to flash
+  uint32_t elapsedMs  = 0;   // begin → end
+  uint32_t flashUs    = 0;   // time spent inside Update.write()
+  char     sha256[65] = {0}; // hex of the written image (valid after end)
+};
+
+// expectSha256Hex: 64 hex chars, or nullptr/"" to skip verification
+bool otaStreamBegin(const char* expectSha256Hex);
+bool otaStreamWrite(uint8_t* data, size_t len);
+bool otaStreamEnd();          // gzip trailer + SHA-256 check, then Update.end(true)
+void otaStreamAbort();
+
+bool                  otaStreamActive();
+const char*           otaStreamError();   // last failure reason ("" if none)
+const OtaStreamStats& otaStreamStats();
+
+// Provided by main.cpp: ticks fan control, sensors and host ingest.
+// Called between flash-write slices so an upload never starves them.
+void otaServiceCriticalTasks();
@@ -0,0 +1,87 @@
+#include "prof.h"
+
+#if USE_PROFILER
+#include "clock.h"
+
+static constexpr uint8_t kBuckets = 32;
+
+struct ProfHist {
+  uint32_t n[kBuckets];
+  uint32_t count;
+  uint32_t maxCycles;
+};
+
+static const char* const kName[PROF_COUNT] = {
+  "loop", "wifi", "serial", "dallas", "tach", "fanctrl", "touch", "render"
+};
+
+static ProfHist s_h[PROF_COUNT];
+static uint32_t s_winUs     = 0;   // loop-rate window start
+static uint32_t s_winLoops  = 0;
+static uint32_t s_loopHz    = 0;
+
+static uint8_t bucketOf(uint32_t c) { return c ? (uint8_t)(31 - __builtin_clz(c)) : 0; }
+
+static uint32_t cyclesToUs(uint64_t c) { return (uint32_t)(c / getCpuFrequencyMhz()); }
+
+// ---- public ----
+void profAdd(ProfSlot s, uint32_t cycles) {
+  if (s >= PROF_COUNT) return;
+  ProfHist& h = s_h[s];
+  h.n[bucketOf(cycles)]++;
+  h.count++;
+  if (cycles > h.maxCycles) h.maxCycles = cycles;
+}
+
+void profLoopMark() {
+  const uint32_t now = clockUs();
+  s_winLoops++;
+  if (now - s_winUs >= 1000000UL) {
+    s_loopHz   = (uint32_t)((uint64_t)s_winLoops * 1000000ULL / (now - s_winUs));
+    s_winUs    = now;
+    s_winLoops = 0;
+  }
+}
+
+void profReset() {
+  memset(s_h, 0, sizeof(s_h));
+}
+
+ProfStats profStats(ProfSlot s) {
+  ProfStats r = {0, 0, 0, 0};
+  if (s >= PROF_COUNT) return r;
+  const ProfHist& h = s_h[s];
+  r.count = h.count;
+  r.maxUs = cyclesToUs(h.maxCycles);
+  if (!h.count) return r;
+
+  // First bucket whose running total reaches the rank; report its upper edge
+  // (capped at the exact max, which the top bucket can never exceed)
+  const uint32_t r50 = (h.count + 1) / 2;
+  const uint32_t r99 = h.count - h.count / 100;
+  uint32_t acc = 0;
+  bool have50 = false;
+  for (uint8_t b = 0; b < kBuckets; ++b) {
+    acc += h.n[b];
+    const uint32_t edge = cyclesToUs(2ULL << b);
+    if (!have50 && acc >= r50) { r.p50Us = edge; have50 = true; }
+    if (acc >= r99) { r.p99Us = edge; break; }
+  }
+  if (r.p50Us > r.maxUs) r.p50Us = r.maxUs;
+  if (r.p99Us > r.maxUs) r.p99Us = r.maxUs;
+  return r;
+}
+
+uint32_t profLoopHz() { return s_loopHz; }
+
+const char* profSlotName(ProfSlot s) { return s < PROF_COUNT ? kName[s] : "?"; }
+
+ProfSlot profWorst() {
+  ProfSlot w = PROF_WIFI;
+  for (uint8_t s = PROF_WIFI + 1; s < PROF_COUNT; ++s) {
+    if (s_h[s].maxCycles > s_h[w].maxCycles) w = (ProfSlot)s;
+  }
+  return w;
+}
+
+#endif // USE_PROFILER
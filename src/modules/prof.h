@@ -0,0 +1,57 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+
+// Loop-time profiler: each subsystem call in loop() is wrapped in a
+// PROF_SCOPE(slot), which adds its CPU-cycle duration to a log2 histogram
+// (bucket b holds 2^b..2^(b+1)-1 cycles). Percentiles are read back as the
+// upper edge of their bucket, so they err high by at most 2x. Scopes nest
+// (a render from a web handler counts for both). The 32-bit cycle counter
+// wraps after ~26 s at 160 MHz; longer calls are clamped to that.
+enum ProfSlot : uint8_t {
+  PROF_LOOP,        // one loop() iteration, without the scheduler idle wait
+  PROF_WIFI,        // wifiOtaLoop (web handlers, OTA)
+  PROF_SERIAL,      // host link read/parse/GET
+  PROF_DALLAS,
+  PROF_TACH,        // fansTick (tach windows)
+  PROF_FANCTRL,     // calibration, controller, health monitor
+  PROF_TOUCH,
+  PROF_RENDER,      // e-ink page renders
+  PROF_COUNT
+};
+
+struct ProfStats {
+  uint32_t count;
+  uint32_t maxUs;
+  uint32_t p50Us;
+  uint32_t p99Us;
+};
+
+#if USE_PROFILER
+  void        profAdd(ProfSlot s, uint32_t cycles);
+  void        profLoopMark();                 // top of loop(): counts iterations (loop Hz)
+  void        profReset();
+  ProfStats   profStats(ProfSlot s);
+  uint32_t    profLoopHz();                   // iterations in the last full second
+  const char* profSlotName(ProfSlot s);
+  ProfSlot    profWorst();                    // subsystem with the largest max (not PROF_LOOP)
+
+  struct ProfScope {
+    explicit ProfScope(ProfSlot s) : slot(s), c0(ESP.getCycleCount()) {}
+    ~ProfScope() { profAdd(slot, ESP.getCycleCount() - c0); }
+    ProfSlot slot;
+    uint32_t c0;
+  };
+  #define PROF_CAT2(a, b) a##b
+  #define PROF_CAT(a, b)  PROF_CAT2(a, b)
+  #define PROF_SCOPE(s)   ProfScope PROF_CAT(_prof_, __LINE__)(s)
+#else
+  inline void        profAdd(ProfSlot, uint32_t) {}
+  inline void        profLoopMark() {}
+  inline void        profReset() {}
+  inline ProfStats   profStats(ProfSlot) { return ProfStats{0, 0, 0, 0}; }
+  inline uint32_t    profLoopHz() { return 0; }
+  inline const char* profSlotName(ProfSlot) { return ""; }
+  inline ProfSlot    profWorst() { return PROF_LOOP; }
+  #define PROF_SCOPE(s) do {} while (0)
+#endif
@@ -0,0 +1,109 @@
+#include "sched.h"
+
+struct SchedJob {
+  SchedFn  fn;
+  uint32_t periodMs;                // 0 = one-shot
+  uint32_t dueMs;
+  bool     armed;
+};
+
+static SchedJob s_job[SCHED_MAX_JOBS];
+static uint8_t  s_n = 0;
+#if !CLOCK_VIRTUAL
+static TaskHandle_t s_task = nullptr; // loop task, set by the first schedIdle()
+#endif
+
+// Idle accounting over 1 s windows
+static uint32_t s_winUs  = 0;
+static uint32_t s_idleUs = 0;
+static uint8_t  s_idlePct = 0;
+
+static SchedId add(SchedFn fn, uint32_t periodMs, bool armed) {
+  if (s_n >= SCHED_MAX_JOBS || !fn) return -1;
+  SchedJob& j = s_job[s_n];
+  j.fn       = fn;
+  j.periodMs = periodMs;
+  j.dueMs    = clockMs() + periodMs;
+  j.armed    = armed;
+  return (SchedId)s_n++;
+}
+
+// ---- public ----
+SchedId schedEvery(uint32_t periodMs, SchedFn fn) { return add(fn, periodMs ? periodMs : 1, true); }
+
+SchedId schedOnce(SchedFn fn) { return add(fn, 0, false); }
+
+void schedArm(SchedId id, uint32_t delayMs) {
+  if (id < 0 || id >= (SchedId)s_n) return;
+  s_job[id].dueMs = clockMs() + delayMs;
+  s_job[id].armed = true;
+}
+
+void schedCancel(SchedId id) {
+  if (id >= 0 && id < (SchedId)s_n) s_job[id].armed = false;
+}
+
+void schedRun() {
+  for (uint8_t i = 0; i < s_n; ++i) {
+    SchedJob& j = s_job[i];
+    const uint32_t now = clockMs();
+    if (!j.armed || !schedDue(now, j.dueMs)) continue;
+    if (j.periodMs) {
+      // Keep the phase; after a long stall resync instead of running a burst
+      j.dueMs += j.periodMs;
+      if (schedDue(now, j.dueMs)) j.dueMs = now + j.periodMs;
+    } else {
+      j.armed = false;               // before the call: the job may re-arm itself
+    }
+    j.fn();
+  }
+}
+
+void schedIdle(uint32_t capMs) {
+  const uint32_t now = clockMs();
+  uint32_t waitMs = capMs;
+  for (uint8_t i = 0; i < s_n && waitMs; ++i) {
+    const SchedJob& j = s_job[i];
+    if (!j.armed) continue;
+    const int32_t left = (int32_t)(j.dueMs - now);
+    if (left <= 0) waitMs = 0;
+    else if ((uint32_t)left < waitMs) waitMs = (uint32_t)left;
+  }
+
+  const uint32_t t0 = clockUs();
+#if CLOCK_VIRTUAL
+  clockAdvanceMs(waitMs);            // virtual time: skip straight to the deadline
+#else
+  // Blocks on a notification: the FreeRTOS idle task runs (WFI) meanwhile
+  if (!s_task) s_task = xTaskGetCurrentTaskHandle();
+  ulTaskNotifyTake(pdTRUE, waitMs ? pdMS_TO_TICKS(waitMs) : 0);
+  if (!waitMs) taskYIELD();
+#endif
+  const uint32_t t1 = clockUs();
+  s_idleUs += t1 - t0;
+
+  if (t1 - s_winUs >= 1000000UL) {
+    const uint32_t win = t1 - s_winUs;
+    s_idlePct = (uint8_t)((uint64_t)(s_idleUs > win ? win : s_idleUs) * 100U / win);
+    s_winUs   = t1;
+    s_idleUs  = 0;
+  }
+}
+
+#if CLOCK_VIRTUAL
+void schedWake() {}
+void schedWakeFromISR() {}
+#else
+void schedWake() {
+  if (s_task) xTaskNotifyGive(s_task);
+}
+
+void IRAM_ATTR schedWakeFromISR() {
+  if (!s_task) return;
+  BaseType_t hp = pdFALSE;
+  vTaskNotifyGiveFromISR(s_task, &hp);
+  if (hp) portYIELD_FROM_ISR();
+}
+#endif
+
+uint8_t schedIdlePct() { return s_idlePct; }
@@ -0,0 +1,28 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+#include "clock.h"
+
+// Cooperative job table for loop(): periodic and one-shot jobs with
+// wrap-safe deadlines. schedRun() calls every due job; schedIdle() then
+// blocks the loop task until the next deadline (or the cap, or a
+// schedWake() from USB RX / touch / Wi-Fi) so the CPU idles instead of
+// spinning. Everything runs on the loop task; only the wake calls are
+// safe from other tasks/ISRs.
+typedef void (*SchedFn)();
+typedef int8_t SchedId;             // -1 = table full
+
+// Wrap-safe "deadline has passed" (valid while |now - deadline| < 24.8 days)
+inline bool schedDue(uint32_t now, uint32_t deadline) { return (int32_t)(now - deadline) >= 0; }
+
+SchedId  schedEvery(uint32_t periodMs, SchedFn fn);  // first run after one period
+SchedId  schedOnce(SchedFn fn);                      // disarmed until schedArm()
+void     schedArm(SchedId id, uint32_t delayMs);     // (re)start: due in delayMs
+void     schedCancel(SchedId id);                    // disarm (periodic too)
+
+void     schedRun();
+void     schedIdle(uint32_t capMs);   // wait min(next deadline, capMs); 0 = just yield
+void     schedWake();                 // from any task
+void     schedWakeFromISR();          // IRAM; from GPIO ISRs
+
+uint8_t  schedIdlePct();              // share of the last second spent in schedIdle()
@@ -0,0 +1,139 @@
+#include "snapshot.h"
+
+#if USE_SNAPSHOT
+#include <Preferences.h>
+#include <esp_attr.h>
+#include <esp_rom_crc.h>
+
+static const char*        kNvsNs  = "snap";
+static const char*        kNvsKey = "host";
+static constexpr uint32_t kMagic  = 0x50414E53;  // "SNAP"
+static constexpr uint16_t kVersion = 1;
+
+// Plain copy of the host-side HostState fields (no String, fixed layout)
+struct HostSnap {
+  uint32_t  magic;
+  uint16_t  version;
+  uint16_t  size;            // sizeof(HostSnap) of the writer
+  uint32_t  crc;             // over everything after this field
+
+  uint8_t   page;
+  uint8_t   mode;
+  uint8_t   vmCount, lxcCount, diskCount;
+  uint8_t   _pad[3];
+  uint32_t  uptime;
+  char      hostname[HOSTNAME_LEN];
+  float     cpu, load1, load5, load15;
+  uint64_t  ramTotal, ramUsed, fsTotal, fsUsed;
+  int32_t   vmsRunning, vmsTotal, lxcsRunning, lxcsTotal;
+  GuestInfo vms[MAX_GUESTS];
+  GuestInfo lxcs[MAX_GUESTS];
+  DiskInfo  disks[MAX_DISKS];
+  char      ifname[IFNAME_LEN];
+  char      ipv4[IPV4_LEN];
+  char      gateway[IPV4_LEN];
+  char      ipStatus[STATUS_LEN];
+  float     rxKbps, txKbps;
+  uint16_t  netWindow;
+};
+
+static constexpr size_t kCrcOff = offsetof(HostSnap, crc) + sizeof(uint32_t);
+
+// Raw bytes: HostSnap has member initialisers (GuestInfo/DiskInfo), and a
+// constructor run at startup would wipe the copy we are trying to keep.
+// Garbage after power-on; magic + CRC decide.
+alignas(8) static RTC_NOINIT_ATTR uint8_t s_rtc[sizeof(HostSnap)];
+static HostSnap s_buf;
+static uint32_t s_lastNvsMs = 0;         // first NVS write one period after boot
+
+static uint32_t crcOf(const HostSnap& s) {
+  return esp_rom_crc32_le(0, (const uint8_t*)&s + kCrcOff, sizeof(HostSnap) - kCrcOff);
+}
+
+static bool valid(const HostSnap& s) {
+  return s.magic == kMagic && s.version == kVersion && s.size == sizeof(HostSnap) && s.crc == crcOf(s);
+}
+
+static void pack(HostSnap& s, const HostState& h, const UiState& ui) {
+  memset((void*)&s, 0, sizeof(s));        // padding too: it is part of the CRC
+  s.magic     = kMagic;
+  s.version   = kVersion;
+  s.size      = sizeof(HostSnap);
+  s.page      = ui.currentPage;
+  s.mode      = ui.mode;
+  s.vmCount   = h.vm_list_count;
+  s.lxcCount  = h.lxc_list_count;
+  s.diskCount = h.disk_count;
+  s.uptime    = h.uptime_sec;
+  memcpy(s.hostname, h.hostname, sizeof(s.hostname));
+  s.cpu = h.cpu_percent; s.load1 = h.load1; s.load5 = h.load5; s.load15 = h.load15;
+  s.ramTotal = h.ram_total;     s.ramUsed = h.ram_used;
+  s.fsTotal  = h.fs_root_total; s.fsUsed  = h.fs_root_used;
+  s.vmsRunning  = h.vms_running;  s.vmsTotal  = h.vms_total;
+  s.lxcsRunning = h.lxcs_running; s.lxcsTotal = h.lxcs_total;
+  memcpy(s.vms,   h.vm_list,  sizeof(s.vms));
+  memcpy(s.lxcs,  h.lxc_list, sizeof(s.lxcs));
+  memcpy(s.disks, h.disks,    sizeof(s.disks));
+  memcpy(s.ifname,   h.primary_ifname, sizeof(s.ifname));
+  memcpy(s.ipv4,     h.primary_ipv4,   sizeof(s.ipv4));
+  memcpy(s.gateway,  h.gateway_ipv4,   sizeof(s.gateway));
+  memcpy(s.ipStatus, h.ip_status,      sizeof(s.ipStatus));
+  s.rxKbps = h.net_rx_kbps; s.txKbps = h.net_tx_kbps; s.netWindow = h.net_window_s;
+  s.crc = crcOf(s);
+}
+
+static void unpack(const HostSnap& s, HostState& h, UiState& ui) {
+  ui.currentPage   = s.page;
+  ui.mode          = s.mode == MODE_AUTO ? MODE_AUTO : MODE_TOUCH;
+  h.vm_list_count  = s.vmCount   <= MAX_GUESTS ? s.vmCount   : MAX_GUESTS;
+  h.lxc_list_count = s.lxcCount  <= MAX_GUESTS ? s.lxcCount  : MAX_GUESTS;
+  h.disk_count     = s.diskCount <= MAX_DISKS  ? s.diskCount : MAX_DISKS;
+  h.uptime_sec     = s.uptime;
+  memcpy(h.hostname, s.hostname, sizeof(h.hostname));
+  h.cpu_percent = s.cpu; h.load1 = s.load1; h.load5 = s.load5; h.load15 = s.load15;
+  h.ram_total     = s.ramTotal; h.ram_used     = s.ramUsed;
+  h.fs_root_total = s.fsTotal;  h.fs_root_used = s.fsUsed;
+  h.vms_running  = s.vmsRunning;  h.vms_total  = s.vmsTotal;
+  h.lxcs_running = s.lxcsRunning; h.lxcs_total = s.lxcsTotal;
+  memcpy(h.vm_list,  s.vms,   sizeof(h.vm_list));
+  memcpy(h.lxc_list, s.lxcs,  sizeof(h.lxc_list));
+  memcpy(h.disks,    s.disks, sizeof(h.disks));
+  memcpy(h.primary_ifname, s.ifname,   sizeof(h.primary_ifname));
+  memcpy(h.primary_ipv4,   s.ipv4,     sizeof(h.primary_ipv4));
+  memcpy(h.gateway_ipv4,   s.gateway,  sizeof(h.gateway_ipv4));
+  memcpy(h.ip_status,      s.ipStatus, sizeof(h.ip_status));
+  h.net_rx_kbps = s.rxKbps; h.net_tx_kbps = s.txKbps; h.net_window_s = s.netWindow;
+}
+
+// ---- public ----
+bool snapshotRestore(HostState& host, UiState& ui) {
+  s_lastNvsMs = clockMs();
+  memcpy(&s_buf, s_rtc, sizeof(s_buf));
+  if (valid(s_buf)) {
+    unpack(s_buf, host, ui);
+    return true;
+  }
+  Preferences p;
+  if (!p.begin(kNvsNs, true)) return false;
+  const bool ok = p.getBytesLength(kNvsKey) == sizeof(s_buf) &&
+                  p.getBytes(kNvsKey, &s_buf, sizeof(s_buf)) == sizeof(s_buf) && valid(s_buf);
+  p.end();
+  if (!ok) return false;
+  unpack(s_buf, host, ui);
+  memcpy(s_rtc, &s_buf, sizeof(s_rtc));  // next soft reset needs no flash read
+  return true;
+}
+
+void snapshotSave(const HostState& host, const UiState& ui) {
+  pack(s_buf, host, ui);
+  memcpy(s_rtc, &s_buf, sizeof(s_rtc));
+  const uint32_t now = clockMs();
+  if (now - s_lastNvsMs < SNAPSHOT_NVS_MS) return;
+  s_lastNvsMs = now;
+  Preferences p;
+  if (!p.begin(kNvsNs, false)) return;
+  p.putBytes(kNvsKey, &s_buf, sizeof(s_buf));
+  p.end();
+}
+
+#endif // USE_SNAPSHOT
@@ -0,0 +1,19 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+#include "state.h"
+
+// Last known host dashboard, kept across reboots so the panel can show it
+// at once instead of the splash. Host-side fields only (local sensors and
+// fan telemetry are re-measured within seconds). Two copies:
+// - RTC memory: refreshed on every accepted frame, survives soft resets
+//   (OTA, watchdog, panic) but not power loss;
+// - NVS: the same blob at most every SNAPSHOT_NVS_MS (flash wear), for
+//   power-on and brownout boots.
+#if USE_SNAPSHOT
+  bool snapshotRestore(HostState& host, UiState& ui); // RTC copy, else NVS; false = none valid
+  void snapshotSave(const HostState& host, const UiState& ui); // after each accepted frame
+#else
+  inline bool snapshotRestore(HostState&, UiState&) { return false; }
+  inline void snapshotSave(const HostState&, const UiState&) {}
+#endif
@@ -0,0 +1,111 @@
+#include "tach_core.h"
+
+#if FAN_COUNT > 0
+
+// Slots the ISR may be refilling while we read; older edges are dropped on overflow
+static constexpr uint32_t kSlack = 4;
+
+static void sortSmall(uint32_t* a, uint8_t n) {
+  for (uint8_t i = 1; i < n; ++i) {
+    const uint32_t v = a[i];
+    uint8_t j = i;
+    while (j > 0 && a[j - 1] > v) { a[j] = a[j - 1]; --j; }
+    a[j] = v;
+  }
+}
+
+static void stopped(TachCore& t) {
+  t.rpm      = 0;
+  t.periodUs = 0;
+  t.havePrev = false;
+  t.gateUs   = TACH_DEBOUNCE_US;
+}
+
+void tachCoreBegin(TachCore& t, uint8_t ppr, uint32_t maxWinMs, uint32_t timeoutMs) {
+  memset((void*)&t, 0, sizeof(t));
+  t.gateUs     = TACH_DEBOUNCE_US;
+  t.ppr        = ppr ? ppr : 1;
+  t.maxWinMs   = maxWinMs;
+  t.timeoutMs  = timeoutMs;
+  t.lastCalcMs = clockMs();
+  t.rpm        = -1;
+}
+
+bool tachCoreTick(TachCore& t) {
+  const uint32_t now = clockMs();
+  const uint32_t el  = now - t.lastCalcMs;
+  if (el < TACH_MIN_WIN_MS) return false;
+
+  const uint32_t head = __atomic_load_n(&t.head, __ATOMIC_ACQUIRE);
+  uint32_t n = head - t.tail;
+  const uint32_t periods = t.havePrev ? n : (n ? n - 1 : 0);
+  if (periods < TACH_MIN_PERIODS && el < t.maxWinMs) return false;
+
+  // ---- drain ----
+  if (n > TACH_RING_LEN - kSlack) {
+    t.tail     = head - (TACH_RING_LEN - kSlack);
+    t.havePrev = false;               // gap: the first kept edge starts fresh
+    n = TACH_RING_LEN - kSlack;
+  }
+  uint32_t per[TACH_RING_LEN];
+  uint8_t  k = 0;
+  for (uint32_t i = t.tail; i != head; ++i) {
+    const uint32_t ts = t.ring[i & (TACH_RING_LEN - 1)];
+    if (t.havePrev) per[k++] = ts - t.prevUs;
+    t.prevUs   = ts;
+    t.havePrev = true;
+  }
+  // ISR lapped us while copying → slots are mixed, drop the window
+  if (__atomic_load_n(&t.head, __ATOMIC_ACQUIRE) - t.tail > TACH_RING_LEN) k = 0;
+  t.tail       = head;
+  t.lastCalcMs = now;
+  t.winMs      = el;
+
+  // ---- no complete period this window ----
+  if (k == 0) {
+    const uint32_t sinceUs = clockUs() - t.lastEdgeUs;
+    if (n == 0 && sinceUs / 1000U > t.timeoutMs) {
+      stopped(t);
+    } else if (n == 0 && t.rpm > 0) {
+      // Fan is at most as fast as one pulse per 'sinceUs' → lets a slowing fan decay
+      const uint32_t bound = 60000000UL / (sinceUs * t.ppr);
+      if ((uint32_t)t.rpm > bound) t.rpm = (int)bound;
+    } else {
+      return false;
+    }
+    t.seq++;
+    return true;
+  }
+
+  // ---- median as the expected period, mean of the inliers ----
+  uint32_t sorted[TACH_RING_LEN];
+  memcpy(sorted, per, k * sizeof(per[0]));
+  sortSmall(sorted, k);
+  uint32_t ref = sorted[k / 2];
+  if (k < 3 && t.periodUs) ref = t.periodUs; // too few for a median, trust history
+
+  const uint32_t tol = ref * TACH_OUTLIER_PCT / 100U;
+  uint64_t sum = 0;
+  uint8_t  cnt = 0;
+  for (uint8_t i = 0; i < k; ++i) {
+    const uint32_t d = per[i] > ref ? per[i] - ref : ref - per[i];
+    if (d <= tol) { sum += per[i]; cnt++; }
+  }
+  t.rejects += k - cnt;
+  if (cnt == 0) {                             // speed really changed: take the median
+    sum = sorted[k / 2];
+    cnt = 1;
+  }
+
+  const uint32_t meanUs = (uint32_t)(sum / cnt);
+  t.periodUs = meanUs;
+  t.rpm      = (int)((60000000ULL + (uint64_t)meanUs * t.ppr / 2) / ((uint64_t)meanUs * t.ppr));
+  // Glitch gate: a third of the expected period. If the fan outruns it, the
+  // dropped edges lengthen the measured period and the gate converges back.
+  const uint32_t gate = meanUs / 3U;
+  t.gateUs = gate > TACH_DEBOUNCE_US ? gate : TACH_DEBOUNCE_US;
+  t.seq++;
+  return true;
+}
+
+#endif // FAN_COUNT > 0
@@ -0,0 +1,65 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+#include "clock.h"
+
+// Period-based tach measurement, one TachCore per fan channel (fans.cpp).
+// The ISR only timestamps edges into a single-producer ring. tachCoreTick()
+// (loop task) drains it, rejects periods that disagree with the expected one
+// (window median) and turns the mean of the rest into RPM. A window closes
+// as soon as TACH_MIN_PERIODS are in, so fast fans update quickly while slow
+// ones still get every edge of the full window.
+
+#ifndef TACH_RING_LEN
+#define TACH_RING_LEN 32 // edge timestamps buffered between ticks (power of two)
+#endif
+#ifndef TACH_MIN_PERIODS
+#define TACH_MIN_PERIODS 12 // close the window early once this many periods are in
+#endif
+#ifndef TACH_MIN_WIN_MS
+#define TACH_MIN_WIN_MS 100 // ...but never more often than this
+#endif
+#ifndef TACH_DEBOUNCE_US
+#define TACH_DEBOUNCE_US 500 // hard floor for the ISR edge gate
+#endif
+#ifndef TACH_OUTLIER_PCT
+#define TACH_OUTLIER_PCT 30 // periods further than this from the median are rejected
+#endif
+
+static_assert((TACH_RING_LEN & (TACH_RING_LEN - 1)) == 0, "TACH_RING_LEN must be a power of two");
+
+struct TachCore {
+  // ISR side
+  volatile uint32_t ring[TACH_RING_LEN];
+  volatile uint32_t head;        // edges accepted so far (only the ISR writes it)
+  volatile uint32_t lastEdgeUs;
+  volatile uint32_t gateUs;      // edges closer than this are glitches (follows the period)
+  volatile uint32_t glitches;    // edges dropped by the gate
+
+  // loop side
+  uint32_t tail;                 // next ring index to consume
+  uint32_t prevUs;               // last consumed edge (periods span windows)
+  bool     havePrev;
+  uint8_t  ppr;
+  uint32_t maxWinMs;
+  uint32_t timeoutMs;
+  uint32_t lastCalcMs;
+  uint32_t periodUs;             // last accepted mean period, 0 = none
+  uint32_t rejects;              // periods dropped as outliers
+  uint32_t winMs;                // length of the last window
+  uint32_t seq;                  // bumps per new RPM value
+  int      rpm;                  // -1 unknown, 0 stopped, >0 rpm
+};
+
+// Body of the per-fan ISR; forced inline so it lives in the caller's IRAM
+static inline __attribute__((always_inline)) void tachCoreEdge(TachCore& t) {
+  const uint32_t now = clockUs();
+  if (now - t.lastEdgeUs < t.gateUs) { t.glitches = t.glitches + 1; return; }
+  t.lastEdgeUs = now;
+  const uint32_t h = t.head;
+  t.ring[h & (TACH_RING_LEN - 1)] = now;
+  __atomic_store_n(&t.head, h + 1, __ATOMIC_RELEASE); // slot before index
+}
+
+void tachCoreBegin(TachCore& t, uint8_t ppr, uint32_t maxWinMs, uint32_t timeoutMs);
+bool tachCoreTick(TachCore& t); // true when t.rpm/t.seq were updated
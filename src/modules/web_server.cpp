@@ -4,13 +4,25 @@
 #include "web_server.h"
 #include "state.h"              // HostState / DiskInfo
 #include "display_manager.h"    // DisplayManager, renderCurrent()
+#include "metrics.h"            // /metrics exposition
+#include "ota_stream.h"         // /update writer (raw or gzip)
+#include "fans.h"               // fan channel table, PWM/tach readouts
+#include "fancal.h"             // fan characterization sweep
+#include "fanmon.h"             // fan health (stall/degraded/no tach)
+#include "prof.h"               // loop-time profiler
+#include "sched.h"              // CPU idle share
+#include "heaptrace.h"          // allocation counts per subsystem
+#include "logring.h"            // /log
 #include <WiFi.h>
 #include <WebServer.h>
-#include <Update.h>
 
 #ifndef WEB_TITLE
 #define WEB_TITLE "ThinkLab Dash"
 #endif
+// status.json carries uptime/RSSI, which move without a state change
+#ifndef WEB_CACHE_MAX_AGE_MS
+#define WEB_CACHE_MAX_AGE_MS 10000
+#endif
 
 // Access to UI/display/host globals from main.cpp
 extern UiState        g_ui;
@@ -39,6 +51,54 @@ static int rssiToBars(int rssi){
     if (rssi >= -85) return 1;
     return 0;
 }
+// ETag helpers (If-None-Match is collected in webServerSetup)
+static uint32_t fnv1a(const uint8_t* p, size_t n, uint32_t h = 2166136261UL){
+    while (n--){ h ^= *p++; h *= 16777619UL; }
+    return h;
+}
+static bool etagMatches(const char* etag){
+    return server.hasHeader("If-None-Match") && server.header("If-None-Match") == etag;
+}
+
+// ---- Response cache ----
+// A JSON document is serialized once per g_ui.stateGen (or max age) and
+// then reused for every client/poll; ETag is a hash of the body.
+template <size_t N>
+struct JsonCache {
+    bool     valid = false;
+    uint32_t gen   = 0;
+    uint32_t atMs  = 0;
+    size_t   len   = 0;
+    char     etag[12];
+    char     body[N];
+};
+
+template <size_t N>
+static void serveCached(JsonCache<N>& c, uint32_t maxAgeMs, size_t (*build)(char*, size_t)){
+    const uint32_t now = clockMs();
+    if (!c.valid || c.gen != g_ui.stateGen || (maxAgeMs && now - c.atMs >= maxAgeMs)){
+        c.len   = build(c.body, N);
+        c.gen   = g_ui.stateGen;
+        c.atMs  = now;
+        c.valid = true;
+        snprintf(c.etag, sizeof(c.etag), "\"%08lx\"",
+                 (unsigned long)fnv1a((const uint8_t*)c.body, c.len));
+    }
+    server.sendHeader("Cache-Control", "no-cache");
+    server.sendHeader("ETag", c.etag);
+    if (etagMatches(c.etag)){
+        server.send(304);
+        return;
+    }
+    server.send_P(200, PSTR("application/json"), c.body, c.len);
+}
+
+// snprintf result clamped to what actually landed in the buffer
+static size_t clampLen(int w, size_t cap){
+    if (w < 0) return 0;
+    return ((size_t)w < cap) ? (size_t)w : cap - 1;
+}
+
 static bool checkAuth(){
     if (!server.authenticate(WEB_USER, WEB_PASS)){
         server.requestAuthentication();
@@ -49,17 +109,18 @@ static bool checkAuth(){
 
 // --- UI control endpoints (JSON) ---
 
+static JsonCache<96> s_uiCache;
+
+static size_t buildUiStatus(char* buf, size_t cap){
+    return clampLen(snprintf(buf, cap, "{\"mode\":\"%s\",\"in_debug\":%s,\"page\":%u}",
+                             g_ui.mode == MODE_AUTO ? "AUTO" : "TOUCH",
+                             g_ui.inDebugMode ? "true" : "false",
+                             (unsigned)g_ui.currentPage), cap);
+}
+
 static void handleUiStatus(){
     if (!checkAuth()) return;
-    String out;
-    out.reserve(128);
-    out += "{";
-    out += "\"mode\":\""; out += (g_ui.mode == MODE_AUTO ? "AUTO" : "TOUCH"); out += "\",";
-    out += "\"in_debug\":"; out += (g_ui.inDebugMode ? "true" : "false"); out += ",";
-    out += "\"page\":"; out += String(g_ui.currentPage);
-    out += "}";
-    server.sendHeader("Cache-Control", "no-store");
-    server.send(200, "application/json", out);
+    serveCached(s_uiCache, 0, buildUiStatus);
 }
 
 // Single-tap equivalent: re-render current page and arm advance window
@@ -68,7 +129,7 @@ static void handleUiPageUpdate(){
 
     if (!g_ui.inDebugMode){
         g_disp.renderCurrent(g_host, g_ui); // refresh current page now
-        g_ui.advanceArmUntilMs = millis() + TOUCH_ADVANCE_ARM_MS; // arm double-press window
+        g_ui.advanceArmUntilMs = clockMs() + TOUCH_ADVANCE_ARM_MS; // arm double-press window
     } else {
         // In debug, just nudge the debug refresh to happen soon
         g_ui.lastDebugRefresh = 0;
@@ -84,6 +145,7 @@ static void handleUiPageNext(){
         uint8_t n = g_disp.pageCount(g_ui);
         if (n > 0){
             g_ui.currentPage = (g_ui.currentPage + 1) % n;
+            g_ui.stateGen++;
         }
         g_disp.renderCurrent(g_host, g_ui);
         g_ui.advanceArmUntilMs = 0; // explicit next cancels the arm window
@@ -94,6 +156,7 @@ static void handleUiPageNext(){
 static void handleUiToggleMode(){
     if (!checkAuth()) return;
     g_ui.mode = (g_ui.mode == MODE_TOUCH) ? MODE_AUTO : MODE_TOUCH;
+    g_ui.stateGen++;
     handleUiStatus();
 }
 
@@ -101,6 +164,7 @@ static void handleUiShowDebug(){
     if (!checkAuth()) return;
     g_ui.inDebugMode = true;
     g_ui.lastDebugRefresh = 0; // loop will draw debug promptly
+    g_ui.stateGen++;
     handleUiStatus();
 }
 
@@ -111,11 +175,149 @@ static void handleUiHideDebug(){
     g_ui.inDebugMode       = false;
     g_ui.tapPending        = false;
     g_ui.advanceArmUntilMs = 0;
+    g_ui.stateGen++;
     g_disp.renderCurrent(g_host, g_ui);
 
     handleUiStatus();
 }
 
+// --- Fan calibration (JSON) ---
+
+// One entry per channel that can be swept (PWM + tach)
+static void handleFanCal(){
+    if (!checkAuth()) return;
+    char out[1024];
+    size_t n = clampLen(snprintf(out, sizeof(out),
+        "{\"status\":\"%s\",\"active\":%s,\"progress\":%u,\"fans\":[",
+        fanCalStatus(), fanCalActive() ? "true" : "false", (unsigned)fanCalProgressPct()), sizeof(out));
+    bool first = true;
+    for (uint8_t ch = 0; ch < FAN_COUNT; ++ch){
+        if (!fanHasPwm(ch) || !fanHasTach(ch)) continue;
+        const FanCalData &c = fanCalData(ch);
+        n += clampLen(snprintf(out + n, sizeof(out) - n,
+            "%s{\"fan\":%u,\"stored\":%s,\"start_pct\":%u,\"stall_pct\":%u,\"spinup_ms\":%u,\"rpm\":[",
+            first ? "" : ",", (unsigned)(ch + 1), c.version ? "true" : "false",
+            (unsigned)c.startPct, (unsigned)c.stallPct, (unsigned)c.spinUpMs), sizeof(out) - n);
+        for (uint8_t i = 0; i < 11; ++i){
+            n += clampLen(snprintf(out + n, sizeof(out) - n, i ? ",%u" : "%u", (unsigned)c.rpm[i]), sizeof(out) - n);
+        }
+        n += clampLen(snprintf(out + n, sizeof(out) - n, "]}"), sizeof(out) - n);
+        first = false;
+    }
+    clampLen(snprintf(out + n, sizeof(out) - n, "]}"), sizeof(out) - n);
+    server.sendHeader("Cache-Control", "no-store");
+    server.send(200, "application/json", out);
+}
+
+static void handleFanCalStart(){
+    if (!checkAuth()) return;
+    fanCalStart();
+    handleFanCal();
+}
+
+// --- Fan health (JSON) ---
+// One entry per channel; "fault" is ok / no_tach / stall / degraded
+static void handleFanHealth(){
+    if (!checkAuth()) return;
+    char out[384];
+    size_t n = clampLen(snprintf(out, sizeof(out), "{\"alert\":%s,\"shown\":%s,\"fans\":[",
+        fanMonAnyFault(g_host) ? "true" : "false", g_ui.alertShown ? "true" : "false"), sizeof(out));
+    for (uint8_t ch = 0; ch < FAN_COUNT; ++ch){
+        n += clampLen(snprintf(out + n, sizeof(out) - n,
+            "%s{\"fan\":%u,\"fault\":\"%s\",\"duty\":%d,\"rpm\":%d}",
+            ch ? "," : "", (unsigned)(ch + 1), fanFaultName(g_host.fan[ch].fault),
+            fanHasPwm(ch) ? (int)fanPwmGetPercent(ch) : -1, fanTachGetRPM(ch)), sizeof(out) - n);
+    }
+    clampLen(snprintf(out + n, sizeof(out) - n, "]}"), sizeof(out) - n);
+    server.sendHeader("Cache-Control", "no-store");
+    server.send(200, "application/json", out);
+}
+
+// --- Loop profiler (JSON) ---
+// Per subsystem: calls, max and bucketed p50/p99 in µs since the last reset
+static void handleProf(){
+    if (!checkAuth()) return;
+    char out[1024];
+    size_t n = clampLen(snprintf(out, sizeof(out), "{\"loop_hz\":%lu,\"idle_pct\":%u,\"slots\":{",
+        (unsigned long)profLoopHz(), (unsigned)schedIdlePct()), sizeof(out));
+    for (uint8_t s = 0; s < PROF_COUNT; ++s){
+        const ProfStats st = profStats((ProfSlot)s);
+        n += clampLen(snprintf(out + n, sizeof(out) - n,
+            "%s\"%s\":{\"count\":%lu,\"max_us\":%lu,\"p50_us\":%lu,\"p99_us\":%lu}",
+            s ? "," : "", profSlotName((ProfSlot)s), (unsigned long)st.count,
+            (unsigned long)st.maxUs, (unsigned long)st.p50Us, (unsigned long)st.p99Us), sizeof(out) - n);
+    }
+    clampLen(snprintf(out + n, sizeof(out) - n, "}}"), sizeof(out) - n);
+    server.sendHeader("Cache-Control", "no-store");
+    server.send(200, "application/json", out);
+}
+
+static void handleProfReset(){
+    if (!checkAuth()) return;
+    profReset();
+    handleProf();
+}
+
+#if HEAPTRACE
+// --- Heap tracer (JSON) ---
+// Totals per tag since boot; free/largest are low-water marks
+static void handleHeap(){
+    if (!checkAuth()) return;
+    char out[640];
+    size_t n = clampLen(snprintf(out, sizeof(out),
+        "{\"free\":%lu,\"min_free\":%lu,\"min_largest\":%lu,\"alloc_loops\":%lu,\"tags\":{",
+        (unsigned long)ESP.getFreeHeap(), (unsigned long)heapTraceMinFree(),
+        (unsigned long)heapTraceMinLargest(), (unsigned long)heapTraceAllocLoops()), sizeof(out));
+    for (uint8_t t = 0; t < HEAP_TAG_COUNT; ++t){
+        const HeapTagStats st = heapTraceStats((HeapTag)t);
+        n += clampLen(snprintf(out + n, sizeof(out) - n,
+            "%s\"%s\":{\"allocs\":%lu,\"frees\":%lu,\"alloc_bytes\":%lu,\"free_bytes\":%lu}",
+            t ? "," : "", heapTraceTagName((HeapTag)t), (unsigned long)st.allocs,
+            (unsigned long)st.frees, (unsigned long)st.allocBytes, (unsigned long)st.freeBytes), sizeof(out) - n);
+    }
+    clampLen(snprintf(out + n, sizeof(out) - n, "}}"), sizeof(out) - n);
+    server.sendHeader("Cache-Control", "no-store");
+    server.send(200, "application/json", out);
+}
+#endif
+
+#if USE_LOG
+// --- Log ring (text) ---
+// Lines after ?since=<cursor> (0 or absent: all still in the ring); the
+// cursor for the next request comes back in X-Log-Next. Each request keeps
+// the ring recording for LOG_HTTP_HOLD_MS, so a follower polls faster than that.
+static void handleLog(){
+    if (!checkAuth()) return;
+    logSetReader(LOG_RD_HTTP, true);
+    const uint32_t end = logHead();
+    uint32_t cursor = server.hasArg("since") ? strtoul(server.arg("since").c_str(), nullptr, 10) : 0;
+    if ((int32_t)(cursor - end) > 0) cursor = 0;    // cursor from before a reboot
+
+    char next[12];
+    snprintf(next, sizeof(next), "%lu", (unsigned long)end);
+    server.sendHeader("Cache-Control", "no-store");
+    server.sendHeader("X-Log-Next", next);
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "text/plain", "");
+
+    char chunk[512];
+    uint32_t lost = 0;
+    while ((int32_t)(end - cursor) > 0){
+        const uint32_t left = end - cursor;
+        const size_t n = logRead(cursor, chunk, left < sizeof(chunk) ? left : sizeof(chunk), &lost);
+        if (lost){
+            char note[40];
+            server.sendContent(note, clampLen(snprintf(note, sizeof(note), "-- %lu bytes lost\n",
+                                                       (unsigned long)lost), sizeof(note)));
+            lost = 0;
+        }
+        if (!n) break;
+        server.sendContent(chunk, n);
+    }
+    server.sendContent("");
+}
+#endif
+
 // ================= HTML PAGES =================
 static void handleRoot(){
     if (!checkAuth()) return;
@@ -196,7 +398,7 @@ static void handleRoot(){
 
     // ESP uptime (Xd Yh Zm)
     {
-        uint32_t up_s  = millis() / 1000UL;
+        uint32_t up_s  = clockUptimeMs() / 1000UL;
         uint32_t days  = up_s / 86400UL;
         uint32_t hours = (up_s % 86400UL) / 3600UL;
         uint32_t mins  = (up_s % 3600UL) / 60UL;
@@ -206,6 +408,21 @@ static void handleRoot(){
 
     html += "<div class=row><div>Build</div><div class=tag>" + String(BUILD_VERSION) + "</div></div>";
 
+    // Fans: one row per channel (duty where there is a PWM, rpm where there is a tach)
+    for (uint8_t ch = 0; ch < FAN_COUNT; ++ch){
+        html += "<div class=row><div>Fan " + String(ch + 1) + "</div><div class=tag>";
+        if (fanHasPwm(ch)) html += String(fanPwmGetPercent(ch)) + "%";
+        if (fanHasPwm(ch) && fanHasTach(ch)) html += " · ";
+        if (fanHasTach(ch)){
+            const int rpm = fanTachGetRPM(ch);
+            html += rpm < 0 ? String("-") : String(rpm) + " rpm";
+        }
+        if (g_host.fan[ch].fault != FAN_OK){
+            html += String(" · <b>") + fanFaultName(g_host.fan[ch].fault) + "</b>";
+        }
+        html += "</div></div>";
+    }
+
     // --- E-Ink controls (buttons) ---
     html += "<hr style='border:none;border-top:1px solid #eee;margin:10px 0'>";
     html += "<div style='display:flex;gap:8px;align-items:center;flex-wrap:wrap'>";
@@ -215,6 +432,9 @@ static void handleRoot(){
     html += "<button id='btnNextPage'    class='btn btn-ghost'>Next Page</button>";
     html += "<span id='modeBadge' class='tag'>mode: …</span>";
     html += "</div>";
+    html += "<div class=row><div>Fan calibration</div><div>"
+            "<span id='calBadge' class='tag'>-</span> "
+            "<button id='btnFanCal' class='btn btn-ghost'>Calibrate Fans</button></div></div>";
 
     html += R"JS(
 <script>
@@ -228,7 +448,7 @@ function uiApplyModeVisibility(j){
 }
 
 async function uiFetchStatus(){
-  const r = await fetch('/api/ui', {cache:'no-store'});
+  const r = await fetch('/api/ui', {cache:'no-cache'});
   const j = await r.json();
   const badge = document.getElementById('modeBadge');
   const btnDbg = document.getElementById('btnToggleDebug');
@@ -258,7 +478,25 @@ document.getElementById('btnNextPage').addEventListener('click', async ()=>{
   uiFetchStatus();
 });
 
+async function calFetch(){
+  const r = await fetch('/api/fan/cal', {cache:'no-store'});
+  const j = await r.json();
+  const stored = j.fans.filter(f => f.stored);
+  document.getElementById('calBadge').textContent = j.active
+    ? ('running ' + j.progress + '%')
+    : (stored.length
+        ? stored.map(f => 'F' + f.fan + ' start ' + f.start_pct + '% / stall ' + f.stall_pct + '% / max ' + f.rpm[10] + ' rpm').join(', ')
+        : j.status);
+}
+
+document.getElementById('btnFanCal').addEventListener('click', async ()=>{
+  if (!confirm('Run a ~1.5 min fan sweep (fan goes 0..100%)?')) return;
+  await fetch('/api/fan/cal/start', {method:'POST'});
+  calFetch();
+});
+
 uiFetchStatus();
+calFetch();
 </script>
 )JS";
 
@@ -315,84 +553,204 @@ uiFetchStatus();
     }
     html += "</div>"; // end Proxmox card
 
+    // --- E-Ink mirror (exact panel content) ---
+    html += "<div class=card><b>E-Ink</b><div style='text-align:center;margin-top:8px'>"
+            "<img src='/screen.bmp' width=200 height=200 alt='panel' "
+            "style='image-rendering:pixelated;border:1px solid #ddd'></div></div>";
+
     // --- Actions ---
     html += "<div class=card><b>Actions</b>";
     html += "<div class=row><div>Firmware</div><div><a href='/update'>Upload</a></div></div>";
     html += "<div class=row><div>API</div><div><a href='/status.json'>status.json</a></div></div>";
+    html += "<div class=row><div>Metrics</div><div><a href='/metrics'>metrics</a></div></div>";
     html += "</div>";
 
     html += "<script>setTimeout(()=>location.reload(),5000)</script>";
     server.send(200, "text/html", html);
 }
 
+static JsonCache<320> s_statusCache;
+
+static size_t buildStatusJson(char* buf, size_t cap){
+    const bool linkUp = WiFi.isConnected();
+    char ip[16] = "";
+    if (linkUp){
+        const IPAddress a = WiFi.localIP();
+        snprintf(ip, sizeof(ip), "%u.%u.%u.%u", a[0], a[1], a[2], a[3]);
+    }
+    return clampLen(snprintf(buf, cap,
+        "{\"hostname\":\"%s\",\"ip\":\"%s\",\"ssid\":\"%s\",\"rssi_dbm\":%d,"
+        "\"esp_uptime_sec\":%lu,\"build\":\"%s\"}",
+        HOSTNAME, ip, linkUp ? WiFi.SSID().c_str() : "", linkUp ? (int)WiFi.RSSI() : -127,
+        (unsigned long)(clockUptimeMs() / 1000UL), BUILD_VERSION), cap);
+}
+
 static void handleStatusJson(){
     if (!checkAuth()) return;
-    const bool linkUp = WiFi.isConnected();
-    String out;
-    out.reserve(256);
-    out += "{";
-    out += "\"hostname\":\"" + String(HOSTNAME) + "\",";
-    out += "\"ip\":\"" + (linkUp ? WiFi.localIP().toString() : String("")) + "\",";
-    out += "\"ssid\":\"" + String(linkUp ? WiFi.SSID() : "") + "\",";
-    out += "\"rssi_dbm\":" + String(linkUp ? WiFi.RSSI() : -127) + ",";
-    out += "\"esp_uptime_sec\":" + String(millis() / 1000UL) + ",";
-    out += "\"build\":\"" + String(BUILD_VERSION) + "\"";
-    out += "}";
-    server.send(200, "application/json", out);
+    serveCached(s_statusCache, WEB_CACHE_MAX_AGE_MS, buildStatusJson);
+}
+
+// Prometheus scrape target; streamed in METRICS_BUF_BYTES chunks (no String)
+static void metricsChunk(const char* data, size_t len){
+    server.sendContent(data, len);
+}
+
+static void handleMetrics(){
+    if (!checkAuth()) return;
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "text/plain; version=0.0.4", "");
+    metricsRender(metricsChunk);
+    server.sendContent("");
+}
+
+// ---- Live e-ink mirror ----
+// Streams the DisplayManager frame mirror as-is; ETag = hash of the frame.
+static bool screenPrologue(char kind, char* etag, size_t etagSz){
+    if (!checkAuth()) return false;
+    const uint32_t h = fnv1a(g_disp.display().frame(), EpdMirror::FRAME_BYTES);
+    snprintf(etag, etagSz, "\"%c%08lx\"", kind, (unsigned long)h);
+    server.sendHeader("Cache-Control", "no-cache");
+    server.sendHeader("ETag", etag);
+    if (etagMatches(etag)){
+        server.send(304);
+        return false;
+    }
+    return true;
+}
+
+// Netpbm P4: header + raw frame (layout already matches), no copy
+static void handleScreenPbm(){
+    char etag[16];
+    if (!screenPrologue('p', etag, sizeof(etag))) return;
+
+    char hdr[24];
+    const int hdrLen = snprintf(hdr, sizeof(hdr), "P4\n%d %d\n",
+                                EpdMirror::FRAME_W, EpdMirror::FRAME_H);
+    server.setContentLength(hdrLen + EpdMirror::FRAME_BYTES);
+    server.send(200, "image/x-portable-bitmap", "");
+    server.sendContent(hdr, hdrLen);
+    server.sendContent((const char*)g_disp.display().frame(), EpdMirror::FRAME_BYTES);
+}
+
+// 1bpp BMP for browsers (no PBM support there). Top-down (negative height),
+// palette 0 = white / 1 = black so frame bits go out unchanged; only the
+// 4-byte row padding needs a small staging chunk.
+static void handleScreenBmp(){
+    char etag[16];
+    if (!screenPrologue('b', etag, sizeof(etag))) return;
+
+    const uint16_t W = EpdMirror::FRAME_W, H = EpdMirror::FRAME_H;
+    const uint16_t SRC = EpdMirror::STRIDE;
+    const uint16_t ROW = (SRC + 3) & ~3u;
+    const uint32_t OFF = 14 + 40 + 8;
+    const uint32_t SIZE = OFF + (uint32_t)ROW * H;
+
+    uint8_t hdr[OFF] = {0};
+    auto le16 = [&](size_t at, uint16_t v){ hdr[at] = v & 0xFF; hdr[at + 1] = v >> 8; };
+    auto le32 = [&](size_t at, uint32_t v){ le16(at, v & 0xFFFF); le16(at + 2, v >> 16); };
+    hdr[0] = 'B'; hdr[1] = 'M';
+    le32(2, SIZE);
+    le32(10, OFF);
+    le32(14, 40);                    // BITMAPINFOHEADER
+    le32(18, W);
+    le32(22, (uint32_t)(-(int32_t)H)); // top-down
+    le16(26, 1);                     // planes
+    le16(28, 1);                     // bpp
+    le32(46, 2);                     // palette entries
+    hdr[54] = hdr[55] = hdr[56] = 0xFF; // [0] white, [1] black (zeros)
+
+    server.setContentLength(SIZE);
+    server.send(200, "image/bmp", "");
+    server.sendContent((const char*)hdr, OFF);
+
+    const uint8_t* src = g_disp.display().frame();
+    static constexpr uint16_t ROWS = 16;
+    uint8_t chunk[ROWS * ((EpdMirror::STRIDE + 3) & ~3u)];
+    for (uint16_t y = 0; y < H; y += ROWS){
+        const uint16_t n = (H - y < ROWS) ? (H - y) : ROWS;
+        memset(chunk, 0, sizeof(chunk));
+        for (uint16_t r = 0; r < n; ++r) memcpy(chunk + r * ROW, src + (y + r) * SRC, SRC);
+        server.sendContent((const char*)chunk, (size_t)n * ROW);
+    }
 }
 
 static void handleUpdatePage(){
     if (!checkAuth()) return;
     String html;
-    html.reserve(800);
+    html.reserve(1000);
     html += "<!doctype html><meta name=viewport content='width=device-width,initial-scale=1'>"
-            "<h2>Upload .bin</h2>"
-            "<form method='POST' action='/update' enctype='multipart/form-data'>"
-            "<input type='file' name='firmware' accept='.bin' required>"
+            "<h2>Upload .bin / .bin.gz</h2>"
+            "<form method='POST' action='/update' enctype='multipart/form-data' "
+            "onsubmit=\"var s=this.sha256.value.trim();this.action='/update'+(s?'?sha256='+s:'')\">"
+            "<p><input type='file' name='firmware' accept='.bin,.gz' required></p>"
+            "<p><input name='sha256' size=66 placeholder='SHA-256 of the .bin (optional)'></p>"
             "<button type='submit'>Update</button>"
             "</form>";
     server.send(200, "text/html", html);
 }
 
+// Upload errors are reported once; later chunks of a failed upload are dropped
+static bool s_uploadFailed = false;
+
+static void uploadFail(const char* why){
+    if (!s_uploadFailed) server.send(500, "text/plain", why);
+    s_uploadFailed = true;
+    wifiOta_SetInUpload(false);
+    g_ui.otaActive = false;
+}
+
 static void handleUpdateUpload(){
     if (!checkAuth()) return;
     HTTPUpload &upload = server.upload();
 
     switch (upload.status){
     case UPLOAD_FILE_START:
+        s_uploadFailed = false;
         wifiOta_SetInUpload(true);
-        if (!Update.begin(UPDATE_SIZE_UNKNOWN)){
-            server.send(500, "text/plain", "Update begin failed");
-            wifiOta_SetInUpload(false);
-            return;
+        g_ui.otaActive     = true;
+        g_ui.otaDoneBytes  = 0;
+        g_ui.otaTotalBytes = server.hasHeader("Content-Length") ? server.header("Content-Length").toInt() : 0;
+        // Expected hash comes from the query string (?sha256=...), parsed before the body
+        if (!otaStreamBegin(server.arg("sha256").c_str())){
+            uploadFail(otaStreamError());
         }
         break;
 
     case UPLOAD_FILE_WRITE:
-        if (Update.write(upload.buf, upload.currentSize) != upload.currentSize){
-            Update.end();
-            server.send(500, "text/plain", "Flash write failed");
-            wifiOta_SetInUpload(false);
-            return;
+        if (s_uploadFailed) break;
+        if (!otaStreamWrite(upload.buf, upload.currentSize)){
+            uploadFail(otaStreamError());
         }
+        g_ui.otaDoneBytes = upload.totalSize;
         break;
 
     case UPLOAD_FILE_END:
-        if (Update.end(true) && !Update.hasError()){
+        if (s_uploadFailed) break;
+        if (otaStreamEnd()){
+            const OtaStreamStats &st = otaStreamStats();
+            const float secs  = st.elapsedMs / 1000.0f;
+            const float kibps = secs > 0 ? (st.bytesIn / 1024.0f) / secs : 0.0f;
+            char msg[320];
+            snprintf(msg, sizeof(msg),
+                     "<h3>Update successful.</h3>"
+                     "<p>%lu B received%s, %lu B written in %.1f s (%.1f KiB/s); flash %.1f s.</p>"
+                     "<p><code>sha256 %s</code></p>"
+                     "<p>Rebooting… you can close this tab.</p>",
+                     (unsigned long)st.bytesIn, st.gzip ? " (gzip)" : "",
+                     (unsigned long)st.bytesOut, secs, kibps, st.flashUs / 1e6f, st.sha256);
             server.sendHeader("Connection", "close");
-            server.send(200, "text/html",
-                        "<h3>Update successful.</h3><p>Rebooting… you can close this tab.</p>");
+            server.send(200, "text/html", msg);
             wifiOta_RequestReboot();
         }else{
-            server.send(500, "text/plain", "Update failed");
+            server.send(500, "text/plain", otaStreamError());
         }
         wifiOta_SetInUpload(false);
+        g_ui.otaActive = false;
         break;
 
     case UPLOAD_FILE_ABORTED:
-        Update.end();
-        server.send(500, "text/plain", "Update aborted");
-        wifiOta_SetInUpload(false);
+        otaStreamAbort();
+        uploadFail("Update aborted");
         break;
 
     default:
@@ -404,6 +762,9 @@ static void handleUpdateUpload(){
 void webServerSetup(){
     server.on("/",           HTTP_GET,  handleRoot);
     server.on("/status.json",HTTP_GET,  handleStatusJson);
+    server.on("/metrics",    HTTP_GET,  handleMetrics);
+    server.on("/screen.pbm", HTTP_GET,  handleScreenPbm);
+    server.on("/screen.bmp", HTTP_GET,  handleScreenBmp);
 
     // UI control endpoints
     server.on("/api/ui",               HTTP_GET,  handleUiStatus);
@@ -412,6 +773,17 @@ void webServerSetup(){
     server.on("/api/ui/debug/hide",    HTTP_POST, handleUiHideDebug);
     server.on("/api/ui/page/update",   HTTP_POST, handleUiPageUpdate);
     server.on("/api/ui/page/next",     HTTP_POST, handleUiPageNext);
+    server.on("/api/fan/cal",          HTTP_GET,  handleFanCal);
+    server.on("/api/fan/cal/start",    HTTP_POST, handleFanCalStart);
+    server.on("/api/fan/health",       HTTP_GET,  handleFanHealth);
+    server.on("/api/prof",             HTTP_GET,  handleProf);
+    server.on("/api/prof/reset",       HTTP_POST, handleProfReset);
+#if HEAPTRACE
+    server.on("/api/heap",             HTTP_GET,  handleHeap);
+#endif
+#if USE_LOG
+    server.on("/log",                  HTTP_GET,  handleLog);
+#endif
 
     server.on("/update", HTTP_GET,  handleUpdatePage);
     server.on("/update", HTTP_POST, [](){}, handleUpdateUpload);
@@ -425,6 +797,10 @@ void webServerSetup(){
         server.send(404, "text/plain", "Not found");
     });
 
+    // Request headers we need beyond the defaults (conditional GETs)
+    static const char* kCollect[] = { "If-None-Match", "Content-Length" };
+    server.collectHeaders(kCollect, 2);
+
     server.begin();
 }
 
@@ -3,6 +3,10 @@
 
 #include "wifi_ota.h"
 #include "web_server.h"     // new
+#include "ota_stream.h"     // otaServiceCriticalTasks()
+#include "state.h"
+#include "sched.h"          // wake loop() on link changes
+#include "logring.h"        // link up/down lines
 
 #include <WiFi.h>
 #include <ESPmDNS.h>
@@ -27,6 +31,8 @@
 #endif
 // ============================================================================
 
+extern UiState g_ui;   // upload progress for the Debug page
+
 // ---- state -----------------------------------------------------------------
 static bool     wifiConnected     = false;
 static bool     otaInit           = false;
@@ -57,9 +63,6 @@ static void startMDNS() {
     MDNS.addService("http", "tcp", 80);
   }
 }
-static void stopMDNS() {
-  MDNS.end();
-}
 
 static void ensureArduinoOTA() {
   if (otaInit) return;
@@ -71,18 +74,28 @@ static void ensureArduinoOTA() {
   ArduinoOTA
     .onStart([]() {
       inUpload = true;           // block watchdog/backoff
-      stopMDNS();
-      server.stop();             // from web_server.cpp
+      g_ui.otaActive     = true;
+      g_ui.otaDoneBytes  = 0;
+      g_ui.otaTotalBytes = 0;
+      // Web server and mDNS stay up; requests queue until handle() returns.
       // Keep Wi-Fi awake & stable
       WiFi.setSleep(false);
       esp_wifi_set_ps(WIFI_PS_NONE);
     })
+    .onProgress([](unsigned int done, unsigned int total) {
+      // ArduinoOTA.handle() runs the whole transfer; this is our only slot
+      g_ui.otaDoneBytes  = done;
+      g_ui.otaTotalBytes = total;
+      otaServiceCriticalTasks();
+    })
     .onEnd([]() {
       pendingReboot = true;
       inUpload = false;
+      g_ui.otaActive = false;
     })
     .onError([](ota_error_t) {
       inUpload = false;
+      g_ui.otaActive = false;
     });
 
   ArduinoOTA.begin();
@@ -99,7 +112,7 @@ static void stopArduinoOTA() {
 static void scheduleNextAttempt(uint32_t baseMs = 3000UL) {
   uint32_t delayMs = baseMs << (retryExp <= 4 ? retryExp : 4); // 3s..48s
   if (delayMs > 60000UL) delayMs = 60000UL;
-  nextAttemptMs = millis() + delayMs;
+  nextAttemptMs = clockMs() + delayMs;
   if (retryExp < 10) retryExp++;
 }
 
@@ -117,9 +130,11 @@ static void wifiBeginFresh() {
 
 // ---- Wi-Fi events -----------------------------------------------------------
 static void onWiFiEvent(WiFiEvent_t event) {
+  schedWake();
   switch (event) {
     case ARDUINO_EVENT_WIFI_STA_GOT_IP:
       wifiConnected  = true;
+      LOGF("wifi", "up %s rssi=%d", WiFi.localIP().toString().c_str(), (int)WiFi.RSSI());
       retryExp       = 0;
       quickKickTries = 0;
       failStreak     = 0;
@@ -129,8 +144,9 @@ static void onWiFiEvent(WiFiEvent_t event) {
 
     case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
       wifiConnected = false;
+      LOGF("wifi", "down (streak %u)", (unsigned)(failStreak + 1));
       stopArduinoOTA();
-      lastDisconnectMs = millis();
+      lastDisconnectMs = clockMs();
       failStreak++;
       if (quickKickTries < 3) {
         esp_wifi_connect();
@@ -148,16 +164,16 @@ static void wifiMaintain() {
   if (inUpload) return; // never tamper during uploads
 
   // If link is up, periodically verify real connectivity via DNS (30s)
-  if (wifiConnected && (millis() - lastInetCheckMs) > 30000UL) {
-    lastInetCheckMs = millis();
+  if (wifiConnected && (clockMs() - lastInetCheckMs) > 30000UL) {
+    lastInetCheckMs = clockMs();
     if (!checkInternetSimple()) {
       // DNS unreachable → full Wi-Fi shutdown + delayed restart
       WiFi.disconnect(true, true);
       WiFi.mode(WIFI_OFF);
       wifiConnected = false;
       stopArduinoOTA();
-      lastDisconnectMs = millis();
-      nextAttemptMs = millis() + 30000UL;
+      lastDisconnectMs = clockMs();
+      nextAttemptMs = clockMs() + 30000UL;
       retryExp = 0;
       return;
     }
@@ -166,7 +182,7 @@ static void wifiMaintain() {
   if (wifiConnected) return;
 
   // Time for a scheduled reconnect?
-  if ((int32_t)(millis() - nextAttemptMs) >= 0) {
+  if ((int32_t)(clockMs() - nextAttemptMs) >= 0) {
     WiFi.mode(WIFI_STA);
     WiFi.persistent(false);
     WiFi.setSleep(false);
@@ -184,6 +200,8 @@ void wifiOtaSetup() {
   webServerSetup();     // new: website lives in its own module
 }
 
+bool wifiOtaConnected() { return wifiConnected; }
+
 void wifiOtaLoop() {
   wifiMaintain();
   server.handleClient();           // web module’s server
@@ -3,6 +3,7 @@
 
 void wifiOtaSetup();    // call once from setup()
 void wifiOtaLoop();     // call each loop
+bool wifiOtaConnected(); // STA has an IP (loop() keeps its idle waits short then)
 
 // Exposed for web_server.cpp to coordinate uploads and safe reboot
 void wifiOta_SetInUpload(bool on);
@@ -0,0 +1,53 @@
+#include "page_alert.h"
+#include "ui_theme.h"
+#include "state.h"
+#include "config.h"
+#include <Fonts/FreeMono9pt7b.h>
+#include <Fonts/FreeMonoBold9pt7b.h>
+
+#include "modules/fans.h"
+
+void PageAlert::render(Epd_t &d, const HostState &host, const UiState & /*ui*/)
+{
+  d.firstPage();
+  do
+  {
+    d.fillScreen(GxEPD_WHITE);
+
+    ui::header(d, F("FAN ALERT"));
+
+    const int16_t LINE_H = 20;
+    const int16_t labelX = 4;
+    const int16_t valueR = d.width() - 4;
+
+    int16_t y = ui::content_top();
+
+    // Per faulted channel: "FanN  STALL" (bold), then "duty% rpm"
+    for (uint8_t ch = 0; ch < FAN_COUNT; ++ch)
+    {
+      const uint8_t f = host.fan[ch].fault;
+      if (f == FAN_OK) continue;
+
+      d.setFont(&FreeMonoBold9pt7b);
+      d.setCursor(labelX, y);
+      d.print(F("Fan"));
+      d.print(ch + 1);
+      String kind(fanFaultName(f));
+      kind.toUpperCase();
+      ui::printRight(d, valueR, y, kind);
+      y += LINE_H;
+
+      d.setFont(&FreeMono9pt7b);
+      d.setCursor(labelX, y);
+      d.print(F("at"));
+      const int rpm = fanTachGetRPM(ch);
+      ui::printRight(d, valueR, y, String(fanPwmGetPercent(ch)) + "% " +
+                                   (rpm < 0 ? String("-") : String(rpm)) + " rpm");
+      y += LINE_H;
+    }
+
+    d.setFont(&FreeMono9pt7b);
+    d.setCursor(labelX, d.height() - 6);
+    d.print(F("Tap to dismiss"));
+  } while (d.nextPage());
+}
@@ -0,0 +1,9 @@
+#pragma once
+#include "display_manager.h"
+
+// Fan fault alert; shown instead of the current page (UiState::alertShown)
+class PageAlert : public IPage {
+public:
+  const char* title() const override { return "Alert"; }
+  void render(Epd_t& d, const HostState& host, const UiState& ui) override;
+};
@@ -4,14 +4,15 @@
 #include "config.h"
 #include <Fonts/FreeMono9pt7b.h>
 
-#if USE_FAN1
-#include "modules/fan1_pwm.h"
-#include "modules/fan1_tach.h"
-#endif
-#if USE_FAN2_TACH
-#include "modules/fan2_tach.h"
+#include "modules/fans.h"
+#include "modules/fancal.h"
+#if USE_FANCTRL
+  #include "modules/fanctrl.h"
 #endif
 
+#include "modules/prof.h"
+#include "modules/sched.h"
+
 #if USE_DALLAS
   #include "modules/dallas.h"   // provides dallasGetTempC() or similar
 #endif
@@ -35,6 +36,9 @@ void PageDebug::render(Epd_t &d, const HostState &host, const UiState &ui)
     const int16_t labelX = 4;
     const int16_t valueR = d.width() - 4;
     int16_t y = ui::content_top();
+    // Last baseline that keeps the descenders on the panel; optional rows
+    // past it are dropped (OTA, FanCal, several probes on a full page)
+    const int16_t yLast = d.height() - 4;
 
     // FW version
     d.setCursor(labelX, y);
@@ -42,16 +46,11 @@ void PageDebug::render(Epd_t &d, const HostState &host, const UiState &ui)
     ui::printRight(d, valueR, y, String(FW_VERSION));
     y += LINE_H;
 
-    // RX age
-    d.setCursor(labelX, y);
-    d.print(F("RX age:"));
-    ui::printRight(d, valueR, y, ui.lastParseOkMs ? String(secsSince(ui.lastParseOkMs)) + "s" : String("-"));
-    y += LINE_H;
-
-    // OK/ERR
+    // RX age + OK/ERR
     d.setCursor(labelX, y);
-    d.print(F("OK/ERR:"));
-    ui::printRight(d, valueR, y, String(ui.parseOkCount) + "/" + String(ui.parseErrCount));
+    d.print(F("RX:"));
+    ui::printRight(d, valueR, y, (ui.lastParseOkMs ? String(secsSince(ui.lastParseOkMs)) + "s " : String("- ")) +
+                   String(ui.parseOkCount) + "/" + String(ui.parseErrCount));
     y += LINE_H;
 
     // JSON len
@@ -60,112 +59,204 @@ void PageDebug::render(Epd_t &d, const HostState &host, const UiState &ui)
     ui::printRight(d, valueR, y, String(ui.lastJsonLen) + " B");
     y += LINE_H;
 
-    // Poll
-    d.setCursor(labelX, y);
-    d.print(F("Poll:"));
-    ui::printRight(d, valueR, y, String(POLL_INTERVAL_MS / 1000.0f, 1) + "s");
-    y += LINE_H;
-
-    // Mode
+    // Mode + poll interval
     d.setCursor(labelX, y);
     d.print(F("Mode:"));
-    ui::printRight(d, valueR, y, ui.mode == MODE_TOUCH ? String("TOUCH") : String("AUTO"));
+    ui::printRight(d, valueR, y, (ui.mode == MODE_TOUCH ? String("TOUCH ") : String("AUTO ")) +
+                   String(POLL_INTERVAL_MS / 1000.0f, 1) + "s");
     y += LINE_H;
 
+    // Firmware upload progress (only while one runs)
+    if (ui.otaActive && y <= yLast)
+    {
+      d.setCursor(labelX, y);
+      d.print(F("OTA:"));
+      if (ui.otaTotalBytes)
+      {
+        uint32_t pct = (uint32_t)((uint64_t)ui.otaDoneBytes * 100U / ui.otaTotalBytes);
+        ui::printRight(d, valueR, y, String(pct > 99 ? 99 : pct) + "%");
+      }
+      else
+      {
+        ui::printRight(d, valueR, y, String(ui.otaDoneBytes / 1024U) + " KiB");
+      }
+      y += LINE_H;
+    }
+
     // Debug enabled
     // d.setCursor(labelX, y); d.print(F("Debug:"));
     // ui::printRight(d, valueR, y, ui.debugEnabled ? String("ON") : String("OFF"));
     // y += LINE_H;
 
-    // --- ADD: Fan PWM / RPM (right-aligned) ---
-#if USE_FAN1 && DBG_SHOW_FAN1_PWM
-  d.setCursor(labelX, y);
-  d.print(F("Fan1 PWM:"));
-  ui::printRight(d, valueR, y, String(fan1PwmGetPercent()) + "%");
-  y += LINE_H;
+    // --- Fans: one line per channel, "duty% rpm" (duty/rpm only where wired) ---
+#if DBG_SHOW_FANS
+  for (uint8_t ch = 0; ch < FAN_COUNT && y <= yLast; ++ch) {
+    d.setCursor(labelX, y);
+    d.print(F("Fan"));
+    d.print(ch + 1);
+    d.print(':');
+    String v;
+    if (fanHasPwm(ch)) v = String(fanPwmGetPercent(ch)) + "%";
+    if (fanHasTach(ch)) {
+      const int rpm = fanTachGetRPM(ch);
+      if (v.length()) v += ' ';
+      if (host.fan[ch].fault != FAN_OK) {   // health monitor verdict instead of the rpm
+        String f(fanFaultName(host.fan[ch].fault));
+        f.toUpperCase();
+        v += f;
+      } else {
+        v += rpm < 0 ? String("—") : String(rpm);
+      }
+    }
+    ui::printRight(d, valueR, y, v);
+    y += LINE_H;
+  }
 #endif
 
-#if USE_FAN1 && DBG_SHOW_FAN1_RPM
-  d.setCursor(labelX, y);
-  d.print(F("Fan1 RPM:"));
-  {
-    int rpm1 = fan1TachGetRPM();
-    ui::printRight(d, valueR, y, rpm1 < 0 ? String("—") : String(rpm1));
+#if USE_FANCAL && FAN_COUNT > 0
+  if (fanCalActive() && y <= yLast) {
+    d.setCursor(labelX, y);
+    d.print(F("FanCal"));
+    ui::printRight(d, valueR, y, String(fanCalProgressPct()) + "%");
+    y += LINE_H;
   }
-  y += LINE_H;
 #endif
 
-#if USE_FAN2_TACH && DBG_SHOW_FAN2_RPM
-  d.setCursor(labelX, y);
-  d.print(F("Fan2 RPM:"));
-  {
-    int rpm2 = fan2TachGetRPM();
-    ui::printRight(d, valueR, y, rpm2 < 0 ? String("—") : String(rpm2));
-  }
-  y += LINE_H;
+#if DBG_SHOW_FAN_BLOCK
+  // Controller detail for the first PWM channel
+  uint8_t fc = 0;
+  while (fc < FAN_COUNT && !fanHasPwm(fc)) ++fc;
+  const FanTelemetry& ft = host.fan[fc < MAX_FANS ? fc : 0];
 #endif
 
 #if DBG_SHOW_FAN_BLOCK && DBG_SHOW_FAN_CMD
-  d.setCursor(labelX, y);
-  d.print(F("FanCmd"));
-  ui::printRight(d, valueR, y, isnan(host.fan_duty_cmd) ? String("-") : String(host.fan_duty_cmd, 1) + "%");
-  y += LINE_H;
+  if (y <= yLast) {
+    d.setCursor(labelX, y);
+    d.print(F("FanCmd"));
+    {
+      // which input set the command: case / disk / cpu
+      static const char* const kSrc[] = {"case", "disk", "cpu"};
+      ui::printRight(d, valueR, y, isnan(ft.duty_cmd) ? String("-")
+                     : String(ft.duty_cmd, 1) + "% " + kSrc[ft.source < 3 ? ft.source : 0]);
+    }
+    y += LINE_H;
+  }
 #endif
 
 #if DBG_SHOW_FAN_BLOCK && DBG_SHOW_FAN_OUT
-  d.setCursor(labelX, y);
-  d.print(F("FanOut"));
-  ui::printRight(d, valueR, y, isnan(host.fan_duty_filt) ? String("-") : String(host.fan_duty_filt, 1) + "%");
-  y += LINE_H;
+  if (y <= yLast) {
+    d.setCursor(labelX, y);
+    d.print(F("FanOut"));
+    ui::printRight(d, valueR, y, isnan(ft.duty_filt) ? String("-") : String(ft.duty_filt, 1) + "%");
+    y += LINE_H;
+  }
+#endif
+
+#if DBG_SHOW_FAN_BLOCK && FAN_CTRL_MODE == 1
+  if (y <= yLast) {
+    d.setCursor(labelX, y);
+    d.print(F("FanTgt"));
+    ui::printRight(d, valueR, y, isnan(ft.rpm_target) ? String("-") : String((int)ft.rpm_target));
+    y += LINE_H;
+  }
 #endif
 
 #if DBG_SHOW_FAN_BLOCK && DBG_SHOW_FAN_ACT
-  d.setCursor(labelX, y);
-  d.print(F("FanAct"));
-  ui::printRight(d, valueR, y, host.fan_active ? String("ON") : String("OFF"));
-  y += LINE_H;
+  if (y <= yLast) {
+    d.setCursor(labelX, y);
+    d.print(F("FanAct"));
+    ui::printRight(d, valueR, y, ft.active ? String("ON") : String("OFF"));
+    y += LINE_H;
+  }
+#endif
+
+#if DBG_SHOW_FAN_BLOCK && DBG_SHOW_FAN_STATS && USE_FANCTRL
+  if (y <= yLast) {
+    d.setCursor(labelX, y);
+    d.print(F("FanSt"));
+    {
+      const FanCtrlStats st = fanCtrlStats(fc);
+      ui::printRight(d, valueR, y, isnan(st.avgDutyPct) ? String("-")
+                     : String(st.togglesPerHour, 1) + "/h " + String(st.kicks) + "k " +
+                       String((int)(st.avgDutyPct + 0.5f)) + "%");
+    }
+    y += LINE_H;
+  }
 #endif
 
 // Wi‑Fi status + IP (single line): shows local IP if connected, otherwise "OFF"
 #if USE_WIFI && DBG_SHOW_WIFI
-  d.setCursor(labelX, y);
-  d.print(F("W:"));
-  String wifiStr;
-  if (WiFi.isConnected()) {                 // ESP32 Arduino core helper
-    IPAddress ip = WiFi.localIP();
-    wifiStr = ip.toString();                // e.g., "192.168.1.42"
-  } else {
-    wifiStr = F("OFF");
+  if (y <= yLast) {
+    d.setCursor(labelX, y);
+    d.print(F("W:"));
+    String wifiStr;
+    if (WiFi.isConnected()) {                 // ESP32 Arduino core helper
+      IPAddress ip = WiFi.localIP();
+      wifiStr = ip.toString();                // e.g., "192.168.1.42"
+    } else {
+      wifiStr = F("OFF");
+    }
+    ui::printRight(d, valueR, y, wifiStr);
+    y += LINE_H;
   }
-  ui::printRight(d, valueR, y, wifiStr);
-  y += LINE_H;
 #endif
 
 // Wi-Fi RSSI (signal strength in dBm)
 #if USE_WIFI && DBG_SHOW_WIFI_RSSI
-  d.setCursor(labelX, y);
-  d.print(F("RSSI:"));
-  String rssiStr;
-  if (WiFi.isConnected()) {
-    rssiStr = String(WiFi.RSSI()) + " dBm";
-  } else {
-    rssiStr = F("—");
+  if (y <= yLast) {
+    d.setCursor(labelX, y);
+    d.print(F("RSSI:"));
+    String rssiStr;
+    if (WiFi.isConnected()) {
+      rssiStr = String(WiFi.RSSI()) + " dBm";
+    } else {
+      rssiStr = F("—");
+    }
+    ui::printRight(d, valueR, y, rssiStr);
+    y += LINE_H;
   }
-  ui::printRight(d, valueR, y, rssiStr);
-  y += LINE_H;
 #endif
 
 // Dallas / Case temperature (selectable)
 #if USE_DALLAS && DBG_SHOW_DALLAS
-  d.setCursor(labelX, y);
-  d.print(F("Case:"));
-  float tC = host.local_temp_c;  
-  if (isnan(tC)) {
-    ui::printRight(d, valueR, y, String("—"));
-  } else {
-    ui::printRight(d, valueR, y, String(tC, 1) + "°C");
+  if (y <= yLast) {
+    d.setCursor(labelX, y);
+    d.print(F("Case:"));
+    float tC = host.local_temp_c;  
+    if (isnan(tC)) {
+      ui::printRight(d, valueR, y, String("—"));
+    } else {
+      ui::printRight(d, valueR, y, String(tC, 1) + "°C");
+    }
+    y += LINE_H;
+
+    // Every probe (bus/ROM order) when there is more than one
+    if (host.local_temp_count > 1 && y <= yLast) {
+      d.setCursor(labelX, y);
+      d.print(F("T:"));
+      String v;
+      for (uint8_t i = 0; i < host.local_temp_count && i < MAX_LOCAL_TEMPS; ++i) {
+        if (i) v += ' ';
+        v += isnan(host.local_temps_c[i]) ? String("-") : String(host.local_temps_c[i], 1);
+      }
+      ui::printRight(d, valueR, y, v);
+      y += LINE_H;
+    }
+  }
+#endif
+
+// Idle share + the subsystem with the longest single call since the last reset
+#if USE_PROFILER && DBG_SHOW_PROF
+  if (y <= yLast) {
+    d.setCursor(labelX, y);
+    d.print(F("Loop"));
+    {
+      const ProfSlot w = profWorst();
+      ui::printRight(d, valueR, y, String(schedIdlePct()) + "%idle " + profSlotName(w) + " " +
+                     String(profStats(w).maxUs / 1000U) + "ms");
+    }
+    y += LINE_H;
   }
-  y += LINE_H;
 #endif
 
   } while (d.nextPage());
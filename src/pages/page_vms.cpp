@@ -134,9 +134,9 @@ void PageVMs::render(Epd_t& d, const HostState& host, const UiState& /*ui*/) {
     const uint16_t dashW = textW(d, String(F("- ")));
     const int16_t  nameStartX = bulletX + dashW;
 
-    // Section caps: total 7 names on screen -> 3 VMs + 4 LXCs
+    // Section caps: 2 headers + 6 names at LINE_H fill the panel -> 3 VMs + 3 LXCs
     const uint8_t VM_CAP  = 3;
-    const uint8_t LXC_CAP = 4;
+    const uint8_t LXC_CAP = 3;
 
     int16_t y = ui::content_top();
 
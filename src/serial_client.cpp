@@ -3,6 +3,7 @@
 #include "config.h"
 #include "state.h"
 #include "serial_client.h"
+#include "modules/logring.h"
 
 // ---------- JSON doc capacity (can be overridden in config.h / build_flags) ----------
 #ifndef JSON_DOC_CAP
@@ -28,20 +29,56 @@ void SerialClient::begin() {
   n = 0;
   depth = 0;
   inObj = false;
-  lastPollMs = 0;
   infoSent = false;
+  linkUp   = false;
+  awaiting = false;
+  missed   = 0;
   resetStringState();
 }
 
-void SerialClient::tick(HostState& host, UiState& ui) {
-  const uint32_t now = millis();
+// Whole line or nothing: a host that isn't reading must never stall loop()
+bool SerialClient::writeLine(const char* s) {
+  const size_t len = strlen(s);
+  if ((size_t)Serial.availableForWrite() < len + 2) { txDrops_++; return false; }
+  Serial.write((const uint8_t*)s, len);
+  Serial.write((const uint8_t*)"\r\n", 2);
+  return true;
+}
 
-  // TX: INFO once, then GET at POLL_INTERVAL_MS
-  if (!infoSent) {
-    if (Serial) { sendINFO(); infoSent = true; lastPollMs = now; }
-  } else if (now - lastPollMs >= POLL_INTERVAL_MS) {
+bool SerialClient::sendGET() {
+  if (!writeLine("GET")) return false;
+  if (awaiting && missed < 255) missed++;
+  awaiting  = true;
+  lastGetMs = clockMs();
+  return true;
+}
+
+// Host answering: the normal poll period. Silent: retry after
+// SERIAL_RETRY_MS, doubling per unanswered GET up to SERIAL_RETRY_MAX_MS.
+uint32_t SerialClient::getIntervalMs() const {
+  if (!awaiting) return POLL_INTERVAL_MS;
+  const uint32_t d = (uint32_t)SERIAL_RETRY_MS << (missed < 16 ? missed : 16);
+  return d < SERIAL_RETRY_MAX_MS ? d : SERIAL_RETRY_MAX_MS;
+}
+
+void SerialClient::tick(HostState& host, UiState& ui) {
+  // Connection edges (DTR on USB-OTG CDC, SOF on USB-Serial-JTAG): resync
+  // at once on connect instead of waiting for the next poll
+  const bool up = (bool)Serial;
+  if (up != linkUp) {
+    linkUp   = up;
+    infoSent = false;
+    awaiting = false;
+    missed   = 0;
+#if USE_LOG && LOG_CDC
+    logCursor = logHead();             // a new session starts with new lines
+    logSetReader(LOG_RD_CDC, up);
+#endif
+    LOGF("host", "link %s", up ? "up" : "down");
+  }
+  if (linkUp && !infoSent && writeLine("INFO")) {
+    infoSent = true;
     sendGET();
-    lastPollMs = now;
   }
 
   // RX: brace-framed reader (tolerates newlines)
@@ -78,11 +115,68 @@ void SerialClient::tick(HostState& host, UiState& ui) {
 
     // end of object?
     if (!s_inString && depth == 0) {
+      awaiting = false;                // any complete frame: the host is there
+      missed   = 0;
       buf[n] = '\0';
       (void)parseAndStore(buf, n, host, ui);
       inObj = false; n = 0; depth = 0; resetStringState();
     }
   }
+
+  drainLog();
+}
+
+// Log lines share the link as "\x1e<line>" frames: 0x1E lets the host split
+// them from protocol lines, and "{", "}" and "\\" go out as "\(", "\)" and
+// "\\\\" so no brace framer (the host's, or ours on an echoing host) can
+// take one for JSON. A chunk is only read from the ring once the TX buffer
+// has room for all of it escaped.
+void SerialClient::drainLog() {
+#if USE_LOG && LOG_CDC
+  if (!linkUp) return;
+  char in[LOG_LINE_MAX];
+  char frame[2 * LOG_LINE_MAX + 2];
+  uint32_t lost = 0;
+  while ((size_t)Serial.availableForWrite() >= 3 * LOG_LINE_MAX) {
+    const size_t len = logRead(logCursor, in, sizeof(in), &lost);
+    if (lost) {
+      snprintf(frame, sizeof(frame), "\x1e-- %lu log bytes lost", (unsigned long)lost);
+      writeLine(frame);
+      lost = 0;
+    }
+    if (!len) break;
+    size_t f = 0;
+    frame[f++] = '\x1e';
+    for (size_t i = 0; i < len; ++i) {
+      const char c = in[i];
+      if (c == '\n') {
+        frame[f] = '\0';
+        writeLine(frame);
+        f = 0;
+        frame[f++] = '\x1e';
+      } else if (c == '{' || c == '}' || c == '\\') {
+        frame[f++] = '\\';
+        frame[f++] = c == '{' ? '(' : c == '}' ? ')' : '\\';
+      } else {
+        frame[f++] = c;
+      }
+    }
+  }
+#endif
+}
+
+// GET when due; nothing until INFO went out (tick() does that on connect)
+void SerialClient::pollHost() {
+  if (!linkUp || !infoSent) return;
+  if (clockMs() - lastGetMs >= getIntervalMs()) sendGET();
+}
+
+// Upstream event line (same line protocol as INFO/GET); fault "ok" clears
+void SerialClient::sendAlert(uint8_t fan, const char* fault, uint8_t dutyPct, int rpm) {
+  char line[64];
+  snprintf(line, sizeof(line), "ALERT fan=%u fault=%s duty=%u rpm=%d",
+           (unsigned)fan, fault, (unsigned)dutyPct, rpm);
+  writeLine(line);
 }
 
 // Helper: map disk state string -> active flag
@@ -128,7 +222,11 @@ bool SerialClient::parseAndStore(const char* json, size_t len, HostState& host,
 
   s_doc.clear();
   DeserializationError err = deserializeJson(s_doc, json, len);
-  if (err) { ui.parseErrCount++; return false; }
+  if (err) {
+    ui.parseErrCount++;
+    LOGF("host", "bad frame (%u B): %s", (unsigned)len, err.c_str());
+    return false;
+  }
 
   JsonVariantConst root = s_doc.as<JsonVariantConst>();
 
@@ -145,11 +243,14 @@ bool SerialClient::parseAndStore(const char* json, size_t len, HostState& host,
 
   // From here on, it’s a valid v1 payload we care about
   ui.parseOkCount++;
-  ui.lastParseOkMs = millis();
+  ui.stateGen++;
+  ui.lastParseOkMs = clockMs();
   ui.firstDataReady = true;
 
-  // Keep preview for Debug page (only for accepted payloads)
-  host.last_json = String(json, len);
+  // Keep preview for Debug page (only for accepted payloads); copied into
+  // the existing buffer, so it only allocates when a frame is the longest yet
+  host.last_json = "";
+  host.last_json.concat(json, len);
 
   // ---- top-level we use ----
   host.uptime_sec = root["uptime_s"] | 0;
@@ -4,19 +4,34 @@
 
 class SerialClient {
 public:
-  void begin();                      // sends INFO once
-  void tick(HostState& host, UiState& ui);  // polls GET and parses
+  void begin();                      // resets RX and link state
+  void tick(HostState& host, UiState& ui);  // link edges (INFO+GET on connect), reads and parses
+  void pollHost();                   // GET when due (call about once a second)
+  void sendAlert(uint8_t fan, const char* fault, uint8_t dutyPct, int rpm); // "ALERT fan=N fault=..." line
+
+  bool     hostLinkUp() const { return linkUp; }   // USB host has the port open
+  uint8_t  getsMissed() const { return missed; }
+  uint32_t txDrops() const    { return txDrops_; } // lines dropped on a full TX buffer
 
 private:
   char     buf[RX_LINEBUF_BYTES];
   size_t   n = 0;
   int      depth = 0;
   bool     inObj = false;
-  uint32_t lastPollMs = 0;
   bool     infoSent = false;
 
-  void sendINFO() { Serial.println("INFO"); }
-  void sendGET()  { Serial.println("GET");  }
+  // transport: connection edges, GET pacing, writes that never block
+  bool     linkUp    = false;
+  bool     awaiting  = false;        // GET sent, no frame since
+  uint8_t  missed    = 0;            // unanswered GETs in a row (backoff exponent)
+  uint32_t lastGetMs = 0;
+  uint32_t txDrops_  = 0;
+  uint32_t logCursor = 0;            // log ring position (LOG_CDC)
+
+  bool     writeLine(const char* s);
+  void     drainLog();
+  bool     sendGET();
+  uint32_t getIntervalMs() const;
 
   bool parseAndStore(const char* json, size_t len, HostState& host, UiState& ui);
 };
@@ -2,6 +2,7 @@
 #include <Arduino.h>
 #include <cstdint>
 #include <math.h>
+#include "clock.h"
 
 // ------------ small fixed sizes for strings ------------
 static constexpr size_t HOSTNAME_LEN = 32;
@@ -11,6 +12,8 @@ static constexpr size_t STATUS_LEN   = 20;
 
 static constexpr uint8_t MAX_DISKS   = 6;
 static constexpr uint8_t MAX_GUESTS  = 6;
+static constexpr uint8_t MAX_FANS    = 4;
+static constexpr uint8_t MAX_LOCAL_TEMPS = 4;   // Dallas probes
 
 // ------------ helpers used by pages ------------
 inline float bytesToGiB(uint64_t b) { return (float)b / 1073741824.0f; } // binary GiB
@@ -29,9 +32,9 @@ inline String fmtUptime(uint32_t s) {
   return String(buf);
 }
 
-// Input is a millis() timestamp; returns whole seconds since then (0 if unset)
+// Input is a clockMs() timestamp; returns whole seconds since then (0 if unset)
 inline uint32_t secsSince(uint32_t t_ms) {
-  return t_ms ? (millis() - t_ms) / 1000U : 0U;
+  return t_ms ? (clockMs() - t_ms) / 1000U : 0U;
 }
 
 // ------------ structs ------------
@@ -47,6 +50,27 @@ struct GuestInfo {
   bool    running    = false;   // status == "running"
 };
 
+// Per-channel fan controller telemetry (index = channel, 0-based)
+struct FanTelemetry {
+  float   duty_cmd   = NAN;   // pre-smoothing command (%)
+  float   duty_filt  = NAN;   // post-smoothing (%)
+  uint8_t active     = 0;     // 1 while kick or duty>0
+  float   rpm_target = NAN;   // closed-loop mode only (FAN_CTRL_MODE=1)
+  uint8_t source     = 0;     // input that set duty_cmd (FanInput)
+  uint8_t fault      = 0;     // health monitor verdict (FanFault)
+};
+
+// Controller inputs (FanTelemetry::source)
+enum FanInput : uint8_t { FAN_IN_CASE = 0, FAN_IN_DISK = 1, FAN_IN_CPU = 2 };
+
+// Fan health (FanTelemetry::fault); names go to the web API and the host
+enum FanFault : uint8_t { FAN_OK = 0, FAN_NO_TACH = 1, FAN_STALL = 2, FAN_DEGRADED = 3 };
+
+inline const char* fanFaultName(uint8_t f) {
+  static const char* const kNames[] = {"ok", "no_tach", "stall", "degraded"};
+  return f < 4 ? kNames[f] : "ok";
+}
+
 enum DisplayMode : uint8_t {
   MODE_TOUCH = 0,
   MODE_AUTO  = 1
@@ -100,12 +124,13 @@ struct HostState {
   uint16_t net_window_s               = 0;
 
   // Local sensors (ESP-side)
-  float    local_temp_c               = NAN;
+  float    local_temp_c               = NAN;  // case probe (DALLAS_CASE_PROBE), drives the fans
+  uint8_t  local_temp_count           = 0;    // probes found on the bus
+  float    local_temps_c[MAX_LOCAL_TEMPS] = {NAN, NAN, NAN, NAN}; // per probe, ROM order; NAN = read failed
 
   // ---- Fan telemetry / command (Dallas-only controller) ----
-  float   fan_duty_cmd   = NAN;   // pre-smoothing command (%)
-  float   fan_duty_filt  = NAN;   // post-smoothing (%)
-  uint8_t fan_active     = 0;     // 1 while kick or duty>0
+  FanTelemetry fan[MAX_FANS];
+  float    fan_ff_pct = NAN;      // load-trend feed-forward added to every fan (%)
   uint32_t fan_last_valid_ms = 0; // last time Dallas was valid
 
   // Debug/preview
@@ -119,22 +144,37 @@ struct UiState {
   DisplayMode mode               = MODE_TOUCH;  // TOUCH ↔ AUTO
   bool        firstDataReady     = false;
   bool        firstRenderDone    = false;
+  bool        stale              = false;       // showing the boot snapshot until the first frame
+
+  // boot timing (clockUptimeMs when the render finished; 0 = not yet)
+  uint32_t    bootPixelsMs       = 0;           // first dashboard on the panel (snapshot or live)
+  uint32_t    bootLiveMs         = 0;           // first dashboard with live host data
   bool        debugEnabled       = true;        // debug page compiled
 
   // dedicated Debug mode (not in rotation)
   bool        inDebugMode        = false;
-  uint32_t    lastDebugRefresh   = 0;           // millis() of last Debug redraw
+  uint32_t    lastDebugRefresh   = 0;           // clockMs() of last Debug redraw
 
   // tap behavior: defer single-tap until double-tap window passes
   bool        tapPending         = false;
-  uint32_t    tapDeadlineMs      = 0;           // when to commit single-tap
   uint32_t    advanceArmUntilMs  = 0;           // >now: next tap advances
 
+  // fan alert page preempts the normal pages until a tap or the fault clears
+  bool        alertShown         = false;
+
   // serial / parsing diagnostics
   uint32_t    lastParseOkMs      = 0;
   uint16_t    lastJsonLen        = 0;
   uint32_t    parseOkCount       = 0;
   uint32_t    parseErrCount      = 0;
   uint32_t    rxOverflowCnt      = 0;
+
+  // bumped on accepted frames, UI changes and sensor updates (keys web response caches)
+  uint32_t    stateGen           = 0;
+
+  // firmware upload progress (HTTP /update or ArduinoOTA)
+  bool        otaActive          = false;
+  uint32_t    otaDoneBytes       = 0;
+  uint32_t    otaTotalBytes      = 0;           // 0 = unknown
 };
 
@@ -15,7 +15,7 @@ void TouchInput::begin() {
   pinMode(TOUCH_PIN, INPUT_PULLDOWN);
 #endif
   lastLevel = digitalRead(TOUCH_PIN);
-  lastChange = millis();
+  lastChange = clockMs();
   pressT0 = 0;
   pressed = false;
   lastTapMs = 0;
@@ -23,7 +23,7 @@ void TouchInput::begin() {
 }
 
 ButtonEvent TouchInput::poll() {
-  const uint32_t now = millis();
+  const uint32_t now = clockMs();
   int lvl = digitalRead(TOUCH_PIN);
 
   if (lvl != lastLevel) {
@@ -41,6 +41,13 @@ ButtonEvent TouchInput::poll() {
           pressed = false;
           const uint32_t held = now - pressT0;
 
+          // Very long press? (fan calibration)
+          if (held >= TOUCH_VERY_LONG_MS) {
+            waitingSecondTap = false;
+            lastTapMs = 0;
+            return ButtonEvent::VeryLongPress;
+          }
+
           // Long-press?
           if (held >= TOUCH_LONG_MS) {
             waitingSecondTap = false;
@@ -1,8 +1,9 @@
 #pragma once
 #include <Arduino.h>
 #include "config.h"
+#include "clock.h"
 
-enum class ButtonEvent : uint8_t { None, Tap, DoubleTap, LongPress };
+enum class ButtonEvent : uint8_t { None, Tap, DoubleTap, LongPress, VeryLongPress };
 
 class TouchInput {
 public:
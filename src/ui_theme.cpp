@@ -5,10 +5,24 @@
 // =======================
 // Header (centered title)
 // =======================
+static bool s_stale = false;
+
+void ui::setStale(bool on) { s_stale = on; }
+
 void ui::header(Epd_t& d, const __FlashStringHelper* title) {
   const int16_t W = d.width();
   d.fillRect(0, 0, W, HEADER_H, GxEPD_WHITE);
 
+  if (s_stale) {
+    // Small inverted tag, top-left (classic 5x7 font)
+    d.fillRect(0, 0, 6 * 5 + 3, 11, GxEPD_BLACK);
+    d.setFont();
+    d.setTextSize(1);
+    d.setTextColor(GxEPD_WHITE);
+    d.setCursor(2, 2);
+    d.print(F("STALE"));
+  }
+
   d.setTextColor(GxEPD_BLACK);
   d.setFont(&FreeMonoBold9pt7b);
 
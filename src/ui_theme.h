@@ -15,6 +15,10 @@ namespace ui {
   // Draw centered bold header + 1px underline
   void header(Epd_t& d, const __FlashStringHelper* title);
 
+  // Header shows a "stale" tag (data restored at boot, host not heard yet);
+  // DisplayManager sets it before every render
+  void setStale(bool on);
+
   // --- Text helpers ---
   // Right-aligned text at xRight (with current font)
   inline void printRight(Epd_t& d, int16_t xRight, int16_t y, const String& s) {
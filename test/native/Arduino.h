@@ -0,0 +1,189 @@
+#pragma once
+// Minimal Arduino-ESP32 surface for host-side tests (pio test -e native).
+// Only what the control-path modules and the pages use: GPIO + interrupts,
+// LEDC, Serial, String, ESP, and the FreeRTOS critical-section macros (Update, SHA-256,
+// ROM CRC/tinfl for the OTA path live in their own headers). millis()/micros()
+// read the virtual clock; nothing here sleeps.
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <ctype.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <string>
+#include "hal_native.h"
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define PROGMEM
+#define PSTR(s) (s)
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+
+#define LOW          0
+#define HIGH         1
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+#define RISING       0x01
+#define FALLING      0x02
+#define CHANGE       0x03
+
+#ifndef constrain
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#endif
+
+// ---- time (virtual) ----
+inline unsigned long millis() { return (unsigned long)(uint32_t)(halNowUs() / 1000U); }
+inline unsigned long micros() { return (unsigned long)(uint32_t)halNowUs(); }
+inline void delayMicroseconds(uint32_t us) { g_clockVirtUs = g_clockVirtUs + us; }
+inline void delay(uint32_t ms) { delayMicroseconds(ms * 1000U); }
+inline uint32_t getCpuFrequencyMhz() { return 160; }
+inline void yield() {}
+
+// ---- GPIO ----
+inline void pinMode(int pin, uint8_t mode) { halPin(pin).mode = mode; }
+inline int  digitalRead(int pin) { return halPin(pin).level; }
+inline void digitalWrite(int pin, uint8_t v) { halPin(pin).level = v ? 1 : 0; }
+inline int  digitalPinToInterrupt(int pin) { return pin; }
+
+inline void attachInterruptArg(int pin, void (*fn)(void*), void* arg, int mode) {
+  HalPin& p = halPin(pin);
+  p.isr  = fn;
+  p.arg  = arg;
+  p.edge = mode;
+}
+inline void detachInterrupt(int pin) { halPin(pin).isr = nullptr; }
+
+// ---- LEDC (Arduino core 2.x API) ----
+inline double ledcSetup(uint8_t ch, double freq, uint8_t bits) {
+  halLedc(ch).bits = bits;
+  return freq;
+}
+inline void ledcAttachPin(int pin, uint8_t ch) { halLedc(ch).pin = pin; }
+inline void ledcWrite(uint8_t ch, uint32_t duty) { halLedcSet(ch, duty, 0); }
+
+// ---- FreeRTOS bits the modules touch (single-threaded here) ----
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(m)        ((void)(m))
+#define portEXIT_CRITICAL(m)         ((void)(m))
+#define portENTER_CRITICAL_ISR(m)    ((void)(m))
+#define portEXIT_CRITICAL_ISR(m)     ((void)(m))
+#define portENTER_CRITICAL_SAFE(m)   ((void)(m))
+#define portEXIT_CRITICAL_SAFE(m)    ((void)(m))
+
+// ---- ESP ----
+class EspClass {
+public:
+  uint32_t getCycleCount() { return (uint32_t)(halNowUs() * 160U); } // 160 MHz
+  uint32_t getFreeHeap() { return 200000; }
+  uint32_t getMinFreeHeap() { return 180000; }
+  uint32_t getMaxAllocHeap() { return 100000; }
+  void     restart() {}
+};
+inline EspClass ESP;
+
+// ---- String (what state.h and the pages use) ----
+class String {
+public:
+  String(const char* s = "") : s_(s ? s : "") {}
+  String(const char* s, size_t n) : s_(s, n) {}
+  String(const __FlashStringHelper* s) : String(reinterpret_cast<const char*>(s)) {}
+  explicit String(char c) : s_(1, c) {}
+  explicit String(int v)           { fmt("%d", v); }
+  explicit String(unsigned v)      { fmt("%u", v); }
+  explicit String(long v)          { fmt("%ld", v); }
+  explicit String(unsigned long v) { fmt("%lu", v); }
+  explicit String(float v, unsigned digits = 2)  { fmt("%.*f", (int)digits, (double)v); }
+  explicit String(double v, unsigned digits = 2) { fmt("%.*f", (int)digits, v); }
+
+  const char* c_str() const { return s_.c_str(); }
+  unsigned    length() const { return (unsigned)s_.size(); }
+  bool        isEmpty() const { return s_.empty(); }
+  char        operator[](unsigned i) const { return i < s_.size() ? s_[i] : 0; }
+  char        charAt(unsigned i) const { return (*this)[i]; }
+  bool        reserve(unsigned n) { s_.reserve(n); return true; }
+  bool        concat(const char* s, unsigned n) { s_.append(s, n); return true; }
+
+  String& operator=(const char* s) { s_ = s ? s : ""; return *this; }
+  String& operator+=(const String& s) { s_ += s.s_; return *this; }
+  String& operator+=(const char* s) { s_ += s; return *this; }
+  String& operator+=(char c) { s_ += c; return *this; }
+  bool operator==(const char* s) const { return s_ == s; }
+  bool operator==(const String& s) const { return s_ == s.s_; }
+  bool operator!=(const char* s) const { return s_ != s; }
+
+  int indexOf(char c, unsigned from = 0) const { return find(s_.find(c, from)); }
+  int indexOf(const char* t, unsigned from = 0) const { return find(s_.find(t, from)); }
+  String substring(unsigned a) const { return a < s_.size() ? String(s_.c_str() + a) : String(); }
+  String substring(unsigned a, unsigned b) const {
+    if (a > b) { const unsigned t = a; a = b; b = t; }
+    if (a >= s_.size()) return String();
+    return String(s_.c_str() + a, (b < s_.size() ? b : s_.size()) - a);
+  }
+  void remove(unsigned i) { if (i < s_.size()) s_.erase(i); }
+  void remove(unsigned i, unsigned n) { if (i < s_.size()) s_.erase(i, n); }
+  void toUpperCase() { for (char& c : s_) c = (char)toupper((unsigned char)c); }
+  void toLowerCase() { for (char& c : s_) c = (char)tolower((unsigned char)c); }
+  void trim() {
+    const size_t a = s_.find_first_not_of(" \t\r\n");
+    s_ = a == std::string::npos ? "" : s_.substr(a, s_.find_last_not_of(" \t\r\n") - a + 1);
+  }
+  long  toInt() const { return atol(s_.c_str()); }
+  float toFloat() const { return (float)atof(s_.c_str()); }
+
+private:
+  static int find(size_t p) { return p == std::string::npos ? -1 : (int)p; }
+  void fmt(const char* f, ...) __attribute__((format(printf, 2, 3))) {
+    char b[40];
+    va_list ap;
+    va_start(ap, f);
+    vsnprintf(b, sizeof(b), f, ap);
+    va_end(ap);
+    s_ = b;
+  }
+  std::string s_;
+};
+
+inline String operator+(String a, const String& b) { return a += b; }
+inline String operator+(String a, const char* b) { return a += b; }
+inline String operator+(String a, char b) { return a += b; }
+inline String operator+(String a, const __FlashStringHelper* b) { return a += String(b); }
+inline String operator+(const char* a, const String& b) { return String(a) += b; }
+
+// ---- Serial (HWCDC) ----
+class HalSerialPort {
+public:
+  void begin(unsigned long) {}
+  void setRxBufferSize(size_t) {}
+  void setTxBufferSize(size_t) {}
+  explicit operator bool() const { return halSerial().connected; }
+  int available() { return (int)halSerial().rx.size(); }
+  int read() {
+    std::string& rx = halSerial().rx;
+    if (rx.empty()) return -1;
+    const int c = (uint8_t)rx[0];
+    rx.erase(0, 1);
+    return c;
+  }
+  int availableForWrite() { return (int)halSerial().txRoom; }
+  size_t write(uint8_t c) { halSerial().tx += (char)c; return 1; }
+  size_t write(const uint8_t* p, size_t n) { halSerial().tx.append((const char*)p, n); return n; }
+  size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+  size_t println(const char* s = "") { return print(s) + print("\r\n"); }
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+  void flush() {}
+};
+
+inline size_t HalSerialPort::printf(const char* fmt, ...) {
+  char buf[256];
+  va_list ap;
+  va_start(ap, fmt);
+  const int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  return n > 0 ? write((const uint8_t*)buf, (size_t)n < sizeof(buf) ? (size_t)n : sizeof(buf) - 1) : 0;
+}
+
+inline HalSerialPort Serial;
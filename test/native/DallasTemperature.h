@@ -0,0 +1,33 @@
+#pragma once
+// DallasTemperature subset dallas.cpp uses on the bit-banged bus: begin()
+// counts the probes with a ROM search, requestTemperatures() is SKIP ROM +
+// CONVERT T (returning at once with setWaitForConversion(false)).
+#include "OneWire.h"
+
+class DallasTemperature {
+public:
+  explicit DallasTemperature(OneWire* w) : w_(w) {}
+
+  void begin() {
+    uint8_t rom[8];
+    devices_ = 0;
+    w_->reset_search();
+    while (w_->search(rom)) {
+      if (OneWire::crc8(rom, 7) == rom[7]) devices_++;
+    }
+  }
+  uint8_t getDeviceCount() const { return devices_; }
+  void setWaitForConversion(bool wait) { wait_ = wait; }
+
+  void requestTemperatures() {
+    w_->reset();
+    w_->skip();
+    w_->write(0x44, 0);
+    if (wait_) halBusyUs(750000, false);
+  }
+
+private:
+  OneWire* w_;
+  uint8_t  devices_ = 0;
+  bool     wait_    = true;
+};
@@ -0,0 +1,3 @@
+#pragma once
+#include "gfxfont.h"
+inline const GFXfont FreeMono9pt7b = {11, 13, 18};
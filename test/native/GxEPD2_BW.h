@@ -0,0 +1,142 @@
+#pragma once
+// GxEPD2_BW / Adafruit_GFX surface for host-side page renders. Text is drawn
+// as one outlined cell per character in the font's metrics (classic font
+// 6x8 per size step, GFX fonts from Fonts/*.h), so layout, clipping and
+// overlap can be checked without the glyph bitmaps. Pixels off the panel are
+// counted (offscreen) instead of drawn.
+#include <stdint.h>
+#include <string.h>
+#include "Arduino.h"
+#include "gfxfont.h"
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+
+class GxEPD2_154_D67 {
+public:
+  static constexpr int16_t WIDTH  = 200;
+  static constexpr int16_t HEIGHT = 200;
+  GxEPD2_154_D67(int16_t, int16_t, int16_t, int16_t) {}
+};
+
+class Adafruit_GFX {
+public:
+  Adafruit_GFX(int16_t w, int16_t h) : w_(w), h_(h) {}
+  virtual ~Adafruit_GFX() {}
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+  virtual void fillScreen(uint16_t color) { fillRect(0, 0, w_, h_, color); }
+
+  int16_t width() const { return w_; }
+  int16_t height() const { return h_; }
+  void setRotation(uint8_t r) { rot_ = r & 3; }
+  uint8_t getRotation() const { return rot_; }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) {
+    for (int16_t j = y; j < y + h; ++j)
+      for (int16_t i = x; i < x + w; ++i) drawPixel(i, j, c);
+  }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c) { fillRect(x, y, w, 1, c); }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t c) { fillRect(x, y, 1, h, c); }
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) {
+    drawFastHLine(x, y, w, c);
+    drawFastHLine(x, y + h - 1, w, c);
+    drawFastVLine(x, y, h, c);
+    drawFastVLine(x + w - 1, y, h, c);
+  }
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t c) {
+    const int16_t n = abs(x1 - x0) > abs(y1 - y0) ? abs(x1 - x0) : abs(y1 - y0);
+    for (int16_t i = 0; i <= n; ++i)
+      drawPixel(x0 + (n ? (x1 - x0) * i / n : 0), y0 + (n ? (y1 - y0) * i / n : 0), c);
+  }
+
+  // ---- text ----
+  void setFont(const GFXfont* f = nullptr) { font_ = f; }
+  void setTextSize(uint8_t s) { size_ = s ? s : 1; }
+  void setTextColor(uint16_t c) { color_ = c; }
+  void setTextColor(uint16_t c, uint16_t) { color_ = c; }
+  void setTextWrap(bool) {}
+  void setCursor(int16_t x, int16_t y) { cx_ = x; cy_ = y; }
+  int16_t getCursorX() const { return cx_; }
+  int16_t getCursorY() const { return cy_; }
+
+  void getTextBounds(const char* s, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+    const size_t n = strlen(s);
+    *x1 = x;
+    *y1 = font_ ? (int16_t)(y - font_->ascent) : y;
+    *w  = (uint16_t)(n * advance());
+    *h  = n ? (uint16_t)(font_ ? font_->ascent : 8 * size_) : 0;
+  }
+  void getTextBounds(const String& s, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+    getTextBounds(s.c_str(), x, y, x1, y1, w, h);
+  }
+  void getTextBounds(const __FlashStringHelper* s, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+    getTextBounds(reinterpret_cast<const char*>(s), x, y, x1, y1, w, h);
+  }
+
+  size_t print(const char* s) {
+    size_t n = 0;
+    for (; *s; ++s, ++n) putChar(*s);
+    return n;
+  }
+  size_t print(const String& s) { return print(s.c_str()); }
+  size_t print(const __FlashStringHelper* s) { return print(reinterpret_cast<const char*>(s)); }
+  size_t print(char c) { putChar(c); return 1; }
+  size_t print(int v) { return print(String(v)); }
+  size_t print(unsigned v) { return print(String(v)); }
+  size_t print(long v) { return print(String(v)); }
+  size_t print(unsigned long v) { return print(String(v)); }
+  size_t print(double v, int digits = 2) { return print(String(v, digits)); }
+  size_t println(const char* s = "") { const size_t n = print(s); putChar('\n'); return n + 1; }
+
+  uint32_t glyphs = 0;   // characters drawn since construction
+
+protected:
+  int16_t advance() const { return font_ ? font_->xAdvance : 6 * size_; }
+
+  // One outlined cell per visible character; GFX fonts sit on the baseline,
+  // the classic font hangs below the cursor
+  void putChar(char c) {
+    if (c == '\n') {
+      cx_ = 0;
+      cy_ += font_ ? font_->yAdvance : 8 * size_;
+      return;
+    }
+    const int16_t a = advance();
+    if (c != ' ') {
+      const int16_t top = font_ ? (int16_t)(cy_ - font_->ascent) : cy_;
+      const int16_t h   = font_ ? font_->ascent : 7 * size_;
+      drawRect(cx_, top, a - 1, h, color_);
+      glyphs++;
+    }
+    cx_ += a;
+  }
+
+  int16_t        w_, h_;
+  uint8_t        rot_   = 0;
+  const GFXfont* font_  = nullptr;
+  uint8_t        size_  = 1;
+  uint16_t       color_ = GxEPD_BLACK;
+  int16_t        cx_ = 0, cy_ = 0;
+};
+
+template <typename Panel, int16_t PageH>
+class GxEPD2_BW : public Adafruit_GFX {
+public:
+  explicit GxEPD2_BW(const Panel&) : Adafruit_GFX(Panel::WIDTH, Panel::HEIGHT) {}
+
+  void init(uint32_t = 0, bool = true, uint16_t = 10, bool = false) {}
+  void setFullWindow() {}
+  void setPartialWindow(int16_t, int16_t, int16_t, int16_t) {}
+  void firstPage() { pages++; }
+  bool nextPage() { return false; }        // full-height page buffer: one pass
+  void hibernate() {}
+  void powerOff() {}
+
+  void drawPixel(int16_t x, int16_t y, uint16_t) override {
+    if (x < 0 || y < 0 || x >= width() || y >= height()) offscreen++;
+  }
+
+  uint32_t pages     = 0;   // firstPage() calls (one per render)
+  uint32_t offscreen = 0;   // pixels drawn outside the panel
+};
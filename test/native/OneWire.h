@@ -0,0 +1,114 @@
+#pragma once
+// OneWire library (2.3.x) stand-in on the onewire_bus.h slaves, with the
+// library's slot timing: each reset/bit masks interrupts for the part of the
+// slot the master must time exactly (70 µs presence sample, 10/65 µs write
+// low, 13 µs read sample) and busy-waits the rest with interrupts on.
+#include <stdint.h>
+#include "hal_native.h"
+#include "onewire_bus.h"
+
+class OneWire {
+public:
+  explicit OneWire(uint8_t pin) : pin_(pin) {}
+
+  uint8_t reset() {
+    halBusyUs(480, false);                  // low
+    halBusyUs(70, true);                    // release, sample presence
+    const bool p = owBus().reset();
+    halBusyUs(410, false);
+    return p ? 1 : 0;
+  }
+
+  void write_bit(uint8_t v) {
+    owBus().slot(v & 1);
+    if (v & 1) { halBusyUs(10, true); halBusyUs(55, false); }
+    else       { halBusyUs(65, true); halBusyUs(5, false); }
+  }
+
+  uint8_t read_bit() {
+    const uint8_t r = owBus().slot(1);
+    halBusyUs(13, true);                    // 3 µs low, sample 10 µs later
+    halBusyUs(53, false);
+    return r;
+  }
+
+  void write(uint8_t v, uint8_t power = 0) {
+    (void)power;
+    for (uint8_t m = 0x01; m; m <<= 1) write_bit((v & m) ? 1 : 0);
+  }
+  void write_bytes(const uint8_t* buf, uint16_t n, bool power = 0) {
+    for (uint16_t i = 0; i < n; ++i) write(buf[i], power);
+  }
+  uint8_t read() {
+    uint8_t r = 0;
+    for (uint8_t m = 0x01; m; m <<= 1) if (read_bit()) r |= m;
+    return r;
+  }
+  void read_bytes(uint8_t* buf, uint16_t n) {
+    for (uint16_t i = 0; i < n; ++i) buf[i] = read();
+  }
+
+  void select(const uint8_t rom[8]) {
+    write(0x55);
+    for (uint8_t i = 0; i < 8; ++i) write(rom[i]);
+  }
+  void skip() { write(0xCC); }
+  void depower() {}
+
+  void reset_search() {
+    lastDiscrepancy_ = 0;
+    lastDevice_      = false;
+    memset(romNo_, 0, sizeof(romNo_));
+  }
+
+  // The library's search (Maxim AN187)
+  bool search(uint8_t* newAddr, bool searchMode = true) {
+    uint8_t idBit = 1, lastZero = 0, romByte = 0;
+    uint8_t mask = 1;
+    bool    ok = false;
+    if (!lastDevice_) {
+      if (!reset()) {
+        reset_search();
+        return false;
+      }
+      write(searchMode ? 0xF0 : 0xEC);
+      do {
+        const uint8_t b  = read_bit();
+        const uint8_t cb = read_bit();
+        if (b && cb) break;
+        uint8_t dir;
+        if (b != cb) {
+          dir = b;
+        } else {
+          if (idBit < lastDiscrepancy_) dir = (romNo_[romByte] & mask) > 0;
+          else                          dir = idBit == lastDiscrepancy_;
+          if (!dir) lastZero = idBit;
+        }
+        if (dir) romNo_[romByte] |= mask; else romNo_[romByte] &= (uint8_t)~mask;
+        write_bit(dir);
+        idBit++;
+        mask <<= 1;
+        if (!mask) { romByte++; mask = 1; }
+      } while (romByte < 8);
+      if (idBit >= 65) {
+        lastDiscrepancy_ = lastZero;
+        if (!lastDiscrepancy_) lastDevice_ = true;
+        ok = true;
+      }
+    }
+    if (!ok || !romNo_[0]) {
+      reset_search();
+      return false;
+    }
+    memcpy(newAddr, romNo_, 8);
+    return true;
+  }
+
+  static uint8_t crc8(const uint8_t* addr, uint8_t len) { return owCrc8(addr, len); }
+
+private:
+  uint8_t pin_;
+  uint8_t romNo_[8] = {0};
+  uint8_t lastDiscrepancy_ = 0;
+  bool    lastDevice_ = false;
+};
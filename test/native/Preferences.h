@@ -0,0 +1,52 @@
+#pragma once
+// In-memory NVS for host-side tests (per namespace/key byte blobs)
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+class Preferences {
+public:
+  static std::map<std::string, std::vector<uint8_t>>& store() {
+    static std::map<std::string, std::vector<uint8_t>> s;
+    return s;
+  }
+
+  bool begin(const char* ns, bool readOnly = false) {
+    ns_ = ns;
+    ro_ = readOnly;
+    return true;
+  }
+  void end() {}
+  bool clear() {
+    for (auto it = store().begin(); it != store().end();) {
+      it = it->first.compare(0, ns_.size() + 1, ns_ + "/") == 0 ? store().erase(it) : std::next(it);
+    }
+    return true;
+  }
+
+  size_t getBytesLength(const char* key) {
+    auto it = store().find(k(key));
+    return it == store().end() ? 0 : it->second.size();
+  }
+  size_t getBytes(const char* key, void* buf, size_t len) {
+    auto it = store().find(k(key));
+    if (it == store().end() || it->second.size() > len) return 0;
+    memcpy(buf, it->second.data(), it->second.size());
+    return it->second.size();
+  }
+  size_t putBytes(const char* key, const void* buf, size_t len) {
+    if (ro_) return 0;
+    const uint8_t* p = static_cast<const uint8_t*>(buf);
+    store()[k(key)].assign(p, p + len);
+    return len;
+  }
+
+private:
+  std::string k(const char* key) const { return ns_ + "/" + key; }
+  std::string ns_;
+  bool        ro_ = false;
+};
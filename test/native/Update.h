@@ -0,0 +1,36 @@
+#pragma once
+// Update (OTA flash writer) on the host: the image lands in a byte vector
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+
+class UpdateClass {
+public:
+  std::vector<uint8_t> image;
+  bool   active   = false;
+  bool   ended    = false;   // end(true) succeeded
+  size_t failAt   = 0;       // write() fails once the image would exceed this (0 = never)
+
+  bool begin(size_t) {
+    image.clear();
+    active = true;
+    ended  = false;
+    return true;
+  }
+  size_t write(const uint8_t* p, size_t n) {
+    if (!active || (failAt && image.size() + n > failAt)) return 0;
+    image.insert(image.end(), p, p + n);
+    return n;
+  }
+  bool end(bool) {
+    ended  = active;
+    active = false;
+    return ended;
+  }
+  void abort() { active = false; }
+  bool hasError() const { return false; }
+};
+
+inline UpdateClass Update;
@@ -0,0 +1,32 @@
+#pragma once
+// Station state for the pages and footer; tests set WiFi.connected / WiFi.rssi
+#include "Arduino.h"
+
+typedef enum { WL_IDLE_STATUS = 0, WL_DISCONNECTED = 6, WL_CONNECTED = 3 } wl_status_t;
+
+class IPAddress {
+public:
+  IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : o_{a, b, c, d} {}
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", o_[0], o_[1], o_[2], o_[3]);
+    return String(buf);
+  }
+  uint8_t operator[](int i) const { return o_[i & 3]; }
+private:
+  uint8_t o_[4];
+};
+
+class WiFiClass {
+public:
+  bool      connected = false;
+  int8_t    rssi      = -60;
+  IPAddress ip        = IPAddress(192, 168, 1, 50);
+
+  wl_status_t status() const { return connected ? WL_CONNECTED : WL_DISCONNECTED; }
+  bool        isConnected() const { return connected; }
+  int8_t      RSSI() const { return connected ? rssi : 0; }
+  IPAddress   localIP() const { return connected ? ip : IPAddress(); }
+};
+
+inline WiFiClass WiFi;
@@ -0,0 +1,150 @@
+#pragma once
+// Tach accuracy with and without Dallas reads, for the 1-Wire backend the
+// suite was built with (DALLAS_RMT). Include after the module sources:
+// clock, sched, tach_core, fans, dallas (+ onewire_rmt) and fan_sim.h.
+// Three probes on the bus (2x DS18B20, MAX31850), Dallas in fast mode
+// (12 bit every DALLAS_FAST_MS, ROM search every DALLAS_RESCAN_MS), Fan1
+// at 100 % and Fan2 (tach only) at 40 %.
+#include <stdio.h>
+#include "onewire_bus.h"
+
+static FanSim*     g_sim;
+static DallasProbe g_dallas;
+static bool        s_dallasOn;
+
+static const float kProbeC[3] = {30.5f, 41.25f, -5.0f};
+
+// One run: RPM error against the plant per tach window, edges the ISR saw
+// late (interrupts masked) or never, and what the tach filter dropped
+struct TachRun {
+  float    errMaxPct  = 0;
+  float    errMeanPct = 0;
+  uint32_t windows    = 0;
+  uint32_t edges      = 0;
+  uint32_t delayed    = 0;
+  uint32_t lost       = 0;
+  uint64_t maxDelayUs = 0;
+  uint32_t glitches   = 0;
+  uint32_t rejects    = 0;
+  float    busPct     = 0;   // loop time spent in bus I/O
+  float    maskedPct  = 0;   // time with interrupts masked
+  uint32_t samples    = 0;   // Dallas read-outs
+};
+
+static uint32_t s_seq[FAN_COUNT];
+static double   s_errSum;
+static TachRun  s_cur;
+
+static void jobSensors() {
+  if (s_dallasOn) g_dallas.tick(true);       // fan "settling": fast mode
+  fansTick();
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+    if (fanTachSeq(ch) == s_seq[ch]) continue;
+    s_seq[ch] = fanTachSeq(ch);
+    const float truth = g_sim->fan[ch].plant.rpm;
+    const float err = fabsf((float)fanTachGetRPM(ch) - truth) * 100.0f / truth;
+    if (err > s_cur.errMaxPct) s_cur.errMaxPct = err;
+    s_errSum += err;
+    s_cur.windows++;
+  }
+}
+
+static TachRun runTach(bool dallasOn, uint32_t ms) {
+  s_dallasOn = dallasOn;
+  g_sim->run(10000);                          // settle (and a first Dallas round)
+  s_cur   = TachRun();
+  s_errSum = 0;
+  uint32_t edges0[FAN_COUNT], delayed0[FAN_COUNT], lost0[FAN_COUNT], gl0[FAN_COUNT], rej0[FAN_COUNT];
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+    edges0[ch]   = g_sim->fan[ch].edges;
+    delayed0[ch] = g_sim->fan[ch].delayed;
+    lost0[ch]    = g_sim->fan[ch].lost;
+    gl0[ch]      = fanTachGlitches(ch);
+    rej0[ch]     = fanTachRejects(ch);
+    g_sim->fan[ch].maxDelayUs = 0;
+  }
+  const uint64_t busy0 = halIrq().busyUs, masked0 = halIrq().maskedUs;
+  const uint32_t seq0  = g_dallas.sampleSeq();
+
+  g_sim->run(ms);
+
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+    const SimFan& f = g_sim->fan[ch];
+    s_cur.edges   += f.edges - edges0[ch];
+    s_cur.delayed += f.delayed - delayed0[ch];
+    s_cur.lost    += f.lost - lost0[ch];
+    s_cur.glitches += fanTachGlitches(ch) - gl0[ch];
+    s_cur.rejects  += fanTachRejects(ch) - rej0[ch];
+    if (f.maxDelayUs > s_cur.maxDelayUs) s_cur.maxDelayUs = f.maxDelayUs;
+  }
+  s_cur.errMeanPct = s_cur.windows ? (float)(s_errSum / s_cur.windows) : 0.0f;
+  s_cur.busPct     = (float)(halIrq().busyUs - busy0) * 100.0f / ((float)ms * 1000.0f);
+  s_cur.maskedPct  = (float)(halIrq().maskedUs - masked0) * 100.0f / ((float)ms * 1000.0f);
+  s_cur.samples    = g_dallas.sampleSeq() - seq0;
+  return s_cur;
+}
+
+static void reportTach(const char* name, const TachRun& r) {
+  char msg[240];
+  snprintf(msg, sizeof msg,
+           "%-15s RPM error max %.3f %% mean %.4f %% (%u windows), %u edges: %u late (max %u us), "
+           "%u lost, %u glitches, %u rejects; bus %.2f %% of the time, masked %.2f %%, %u reads",
+           name, r.errMaxPct, r.errMeanPct, (unsigned)r.windows, (unsigned)r.edges,
+           (unsigned)r.delayed, (unsigned)r.maxDelayUs, (unsigned)r.lost, (unsigned)r.glitches,
+           (unsigned)r.rejects, r.busPct, r.maskedPct, (unsigned)r.samples);
+  TEST_MESSAGE(msg);
+}
+
+static void benchBegin(FanSim& sim) {
+  g_sim = &sim;
+  owBus().add(0x28, 1, kProbeC[0]);
+  owBus().add(0x28, 2, kProbeC[1]);
+  owBus().add(0x3B, 3, kProbeC[2]);
+  sim.fan[1].fixedPct = 40.0f;                // tach-only fan on its own supply
+  fansBegin();
+  fanPwmSetPercent(0, 100);
+  g_dallas.begin();
+  schedEvery(SCHED_SENSORS_MS, jobSensors);
+}
+
+// ---- shared checks ----
+
+// Every probe found and read at the fast resolution; no WRITE SCRATCHPAD
+// ever reaches the MAX31850
+static void checkProbesRead() {
+  s_dallasOn = true;
+  g_sim->run(20000);
+  TEST_ASSERT_EQUAL_UINT8(3, g_dallas.count());
+  for (uint8_t i = 0; i < 3; ++i) {
+    const uint8_t* rom = g_dallas.rom(i);
+    float want = NAN;
+    for (uint8_t s = 0; s < owBus().n; ++s) {
+      if (!memcmp(owBus().slave[s].rom, rom, 8)) want = owBus().slave[s].tempC;
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.07f, want, g_dallas.tempC(i));
+    TEST_ASSERT_EQUAL_UINT32(0, g_dallas.crcErrors(i));
+  }
+  TEST_ASSERT_EQUAL_UINT8(DALLAS_FAST_RESOLUTION, owBus().slave[0].bits());
+  TEST_ASSERT_EQUAL_UINT8(DALLAS_FAST_RESOLUTION, owBus().slave[1].bits());
+  TEST_ASSERT_EQUAL_UINT32(0, owBus().slave[2].configWrites);
+}
+
+// A probe that lost power comes back at its EEPROM resolution (9 bit here):
+// that read is dropped, the config rewritten, the next one is good again
+static void checkResolutionResync() {
+  s_dallasOn = true;
+  OwSlave& s = owBus().slave[0];
+  s.eepromConfig = 0x1F;
+  s.powerUp();
+  s.tempC = 33.3125f;
+  const uint32_t writes = s.configWrites;
+  g_sim->run(3u * DALLAS_FAST_MS);
+  TEST_ASSERT_EQUAL_UINT8(DALLAS_FAST_RESOLUTION, s.bits());
+  TEST_ASSERT_EQUAL_UINT32(writes + 1, s.configWrites);
+  uint8_t i = 0;
+  while (i < g_dallas.count() && memcmp(g_dallas.rom(i), s.rom, 8)) ++i;
+  TEST_ASSERT_TRUE(i < g_dallas.count());
+  TEST_ASSERT_EQUAL_UINT32(0, g_dallas.crcErrors(i));
+  g_sim->run(3u * DALLAS_FAST_MS);            // median-of-3 catches up
+  TEST_ASSERT_FLOAT_WITHIN(0.07f, 33.3125f, g_dallas.tempC(i));
+}
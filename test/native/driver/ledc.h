@@ -0,0 +1,46 @@
+#pragma once
+// LEDC fade service (IDF 4.4 API) on the host. Duty changes land in
+// hal_native.h; fades run against the virtual clock. Like the real driver,
+// ledc_set_duty_and_update() and ledc_set_fade_with_time() wait for a fade
+// that is still running on the channel; the shim counts those stalls
+// (HalLedc::blocked) instead of sleeping.
+#include <stdint.h>
+#include "esp_idf_version.h"
+#include "hal_native.h"
+
+typedef int esp_err_t;
+#ifndef ESP_OK
+#define ESP_OK 0
+#endif
+
+typedef enum { LEDC_LOW_SPEED_MODE = 0, LEDC_SPEED_MODE_MAX } ledc_mode_t;
+typedef int ledc_channel_t;
+typedef enum { LEDC_FADE_NO_WAIT = 0, LEDC_FADE_WAIT_DONE } ledc_fade_mode_t;
+
+inline esp_err_t ledc_fade_func_install(int) { return ESP_OK; }
+
+inline esp_err_t ledc_set_duty_and_update(ledc_mode_t, ledc_channel_t ch, uint32_t duty, uint32_t) {
+  halLedcAcquire(ch);
+  halLedcSet(ch, duty, 0);
+  return ESP_OK;
+}
+
+inline esp_err_t ledc_set_fade_with_time(ledc_mode_t, ledc_channel_t ch, uint32_t duty, int ms) {
+  halLedcAcquire(ch);
+  halLedc(ch).pending   = duty;
+  halLedc(ch).pendingMs = (uint32_t)ms;
+  return ESP_OK;
+}
+
+inline esp_err_t ledc_fade_start(ledc_mode_t, ledc_channel_t ch, ledc_fade_mode_t) {
+  halLedcSet(ch, halLedc(ch).pending, halLedc(ch).pendingMs);
+  return ESP_OK;
+}
+
+// IDF >= 4.4: freeze a running fade at its current duty
+inline esp_err_t ledc_fade_stop(ledc_mode_t, ledc_channel_t ch) {
+  if (halLedcFading(ch)) halLedcSet(ch, halLedcDuty(ch), 0);
+  return ESP_OK;
+}
+
+inline uint32_t ledc_get_duty(ledc_mode_t, ledc_channel_t ch) { return halLedcDuty(ch); }
@@ -0,0 +1,155 @@
+#pragma once
+// RMT driver (IDF 4.4 API) on the onewire_bus.h slaves, for the 1-Wire
+// backend in onewire_rmt.cpp. A TX transfer plays its items on the bus: a
+// low of 400 µs or more is a reset, a short low (< 15 µs) a 1/read slot,
+// anything else a 0 slot. The RX channel on the same pin collects the low
+// pulses as the line showed them (our reset + the presence pulse; a read
+// slot stretched to 30 µs by a slave sending 0) into one ring buffer frame.
+// The loop task blocks for the transfer with interrupts on.
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_idf_version.h"
+#include "hal_native.h"
+#include "onewire_bus.h"
+#include "driver/gpio.h"
+
+typedef int esp_err_t;
+#ifndef ESP_OK
+#define ESP_OK 0
+#endif
+
+// ---- FreeRTOS ring buffer (freertos/ringbuf.h) ----
+typedef void*    RingbufHandle_t;
+typedef uint32_t TickType_t;
+#ifndef pdMS_TO_TICKS
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#endif
+
+typedef enum { RMT_CHANNEL_0 = 0, RMT_CHANNEL_1, RMT_CHANNEL_2, RMT_CHANNEL_3, RMT_CHANNEL_MAX } rmt_channel_t;
+typedef enum { RMT_MODE_TX = 0, RMT_MODE_RX } rmt_mode_t;
+typedef enum { RMT_IDLE_LEVEL_LOW = 0, RMT_IDLE_LEVEL_HIGH } rmt_idle_level_t;
+
+typedef struct {
+  union {
+    struct {
+      uint32_t duration0 : 15;
+      uint32_t level0    : 1;
+      uint32_t duration1 : 15;
+      uint32_t level1    : 1;
+    };
+    uint32_t val;
+  };
+} rmt_item32_t;
+
+typedef struct {
+  bool             idle_output_en;
+  rmt_idle_level_t idle_level;
+} rmt_tx_config_t;
+
+typedef struct {
+  uint16_t idle_threshold;
+  bool     filter_en;
+  uint8_t  filter_ticks_thresh;
+} rmt_rx_config_t;
+
+typedef struct {
+  rmt_mode_t      rmt_mode;
+  rmt_channel_t   channel;
+  gpio_num_t      gpio_num;
+  uint8_t         clk_div;
+  uint8_t         mem_block_num;
+  rmt_tx_config_t tx_config;
+  rmt_rx_config_t rx_config;
+} rmt_config_t;
+
+inline rmt_config_t halRmtConfig(rmt_mode_t mode, gpio_num_t gpio, rmt_channel_t ch) {
+  rmt_config_t c = {};
+  c.rmt_mode = mode;
+  c.channel  = ch;
+  c.gpio_num = gpio;
+  c.clk_div  = 80;
+  c.mem_block_num = 1;
+  c.rx_config.idle_threshold = 12000;
+  return c;
+}
+#define RMT_DEFAULT_CONFIG_TX(gpio, ch) halRmtConfig(RMT_MODE_TX, (gpio), (ch))
+#define RMT_DEFAULT_CONFIG_RX(gpio, ch) halRmtConfig(RMT_MODE_RX, (gpio), (ch))
+
+// RX side: one channel, one frame
+struct HalRmt {
+  uint16_t     idleUs = 12000;
+  bool         rxOn   = false;
+  bool         frame  = false;      // a received frame waits in the ring buffer
+  rmt_item32_t rx[64];
+  size_t       rxN    = 0;
+  uint32_t     transfers = 0;
+};
+
+inline HalRmt& halRmt() {
+  static HalRmt r;
+  return r;
+}
+
+inline esp_err_t rmt_config(const rmt_config_t* c) {
+  if (c->rmt_mode == RMT_MODE_RX) halRmt().idleUs = c->rx_config.idle_threshold;
+  return ESP_OK;
+}
+inline esp_err_t rmt_driver_install(rmt_channel_t, size_t, int) { return ESP_OK; }
+inline esp_err_t rmt_get_ringbuf_handle(rmt_channel_t, RingbufHandle_t* h) {
+  *h = &halRmt();
+  return ESP_OK;
+}
+
+inline esp_err_t rmt_rx_start(rmt_channel_t, bool) {
+  halRmt().rxOn = true;
+  halRmt().rxN  = 0;
+  return ESP_OK;
+}
+inline esp_err_t rmt_rx_stop(rmt_channel_t) {
+  halRmt().rxOn = false;
+  return ESP_OK;
+}
+
+inline void halRmtLow(uint32_t us) {
+  HalRmt& r = halRmt();
+  if (!r.rxOn || r.rxN >= sizeof(r.rx) / sizeof(r.rx[0])) return;
+  rmt_item32_t& it = r.rx[r.rxN++];
+  it.duration0 = us;
+  it.level0    = 0;
+  it.duration1 = 1;
+  it.level1    = 1;
+}
+
+inline esp_err_t rmt_write_items(rmt_channel_t, const rmt_item32_t* items, int n, bool) {
+  HalRmt& r = halRmt();
+  uint32_t us = 0;
+  for (int i = 0; i < n; ++i) {
+    const uint32_t low = items[i].level0 ? 0 : items[i].duration0;
+    us += items[i].duration0 + items[i].duration1;
+    if (!low) continue;
+    if (low >= 400) {
+      halRmtLow(low);
+      if (owBus().reset()) halRmtLow(120);   // presence pulse
+    } else {
+      const uint8_t bit  = low < 15 ? 1 : 0;
+      const uint8_t line = owBus().slot(bit);
+      halRmtLow(bit && !line ? 30 : low);
+    }
+  }
+  r.transfers++;
+  halBusyUs(us + r.idleUs, false);            // TX, then RX idle: interrupts stay on
+  if (r.rxOn) {
+    if (r.rxN) r.rx[r.rxN - 1].duration1 = 0; // end of frame
+    r.frame = true;
+  }
+  return ESP_OK;
+}
+
+inline void* xRingbufferReceive(RingbufHandle_t h, size_t* size, TickType_t) {
+  HalRmt& r = *static_cast<HalRmt*>(h);
+  if (!r.frame) return nullptr;
+  r.frame = false;
+  *size = r.rxN * sizeof(rmt_item32_t);
+  return r.rx;
+}
+inline void vRingbufferReturnItem(RingbufHandle_t, void*) {}
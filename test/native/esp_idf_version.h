@@ -0,0 +1,4 @@
+#pragma once
+// The native shims model ESP-IDF 4.4 (Arduino-ESP32 2.0.x)
+#define ESP_IDF_VERSION_VAL(major, minor, patch) (((major) << 16) | ((minor) << 8) | (patch))
+#define ESP_IDF_VERSION ESP_IDF_VERSION_VAL(4, 4, 0)
@@ -0,0 +1,9 @@
+#pragma once
+// ROM CRC32 (little-endian, as used for gzip) backed by zlib on the host
+#include <stddef.h>
+#include <stdint.h>
+#include <zlib.h>
+
+inline uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t* buf, uint32_t len) {
+  return (uint32_t)crc32(crc, buf, len);
+}
@@ -0,0 +1,6 @@
+#pragma once
+// GPIO matrix routing (ROM); the host bus needs no routing
+#include <stdint.h>
+
+inline void esp_rom_gpio_connect_out_signal(uint32_t, uint32_t, bool, bool) {}
+inline void esp_rom_gpio_connect_in_signal(uint32_t, uint32_t, bool) {}
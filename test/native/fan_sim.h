@@ -0,0 +1,190 @@
+#pragma once
+// Plant models and a loop() stand-in for the fan suites. Include it after
+// the module sources (clock/sched/fans/tach_core/...), then register the
+// firmware jobs with schedEvery() like main.cpp and call FanSim::run().
+// Busy-waiting firmware code (halBusyUs) lets the sim run meanwhile; edges
+// that come due with interrupts masked reach the ISR late (see busy()).
+#include <math.h>
+#include <stdint.h>
+#include "hal_native.h"
+
+// First-order fan: RPM follows the duty with time constant tauMs. A spinning
+// fan keeps turning down to stallPct; from standstill it needs startPct.
+// Between stallPct and 100% the speed is linear from minRpm to maxRpm.
+struct FanPlant {
+  float maxRpm   = 3000.0f;
+  float minRpm   = 500.0f;
+  float stallPct = 5.0f;    // Arctic P8 Slim-like: stops at <= 5 % (FAN1_MIN_DUTY_PCT 8 has margin)
+  float startPct = 10.0f;   // FAN_ON_ABOVE_PCT (12) starts it
+  float tauMs    = 1500.0f;
+  float rpm      = 0.0f;
+  bool  turning  = false;
+
+  float steadyRpm(float pct) const {
+    if (pct < (turning ? stallPct : startPct)) return 0.0f;
+    return minRpm + (maxRpm - minRpm) * (pct - stallPct) / (100.0f - stallPct);
+  }
+
+  void step(float pct, float dtMs) {
+    const float target = steadyRpm(pct);
+    if (target > 0.0f) turning = true;
+    rpm += (target - rpm) * (1.0f - expf(-dtMs / tauMs));
+    if (target == 0.0f && rpm < 30.0f) { rpm = 0.0f; turning = false; }
+  }
+};
+
+// Case air: relaxes toward ambientC + riseC / (1 + coolK * airflow), airflow
+// 0..1 from the first fan's speed; riseC stands for the heat load.
+struct ThermalPlant {
+  float ambientC = 25.0f;
+  float riseC    = 20.0f;
+  float coolK    = 3.0f;
+  float tauMs    = 90000.0f;
+  float tempC    = 25.0f;
+
+  void step(float airflow, float dtMs) {
+    const float ss = ambientC + riseC / (1.0f + coolK * airflow);
+    tempC += (ss - tempC) * (1.0f - expf(-dtMs / tauMs));
+  }
+  float dallasC() const { return roundf(tempC * 16.0f) / 16.0f; } // DS18B20, 12 bit
+};
+
+// One fan wired to the firmware: duty from its LEDC pin, pulses into its tach pin
+struct SimFan {
+  FanPlant plant;
+  int      pwmPin   = -1;
+  int      tachPin  = -1;
+  uint8_t  ppr      = 2;
+  float    fixedPct = 0.0f;  // duty for a fan without PWM pin
+  uint64_t nextUs   = 0;     // next tach edge, 0 = no pulses
+  uint32_t edges    = 0;
+  uint32_t delayed  = 0;     // edges whose ISR ran late (interrupts masked)
+  uint32_t lost     = 0;     // edges merged into an earlier pending one
+  uint64_t maxDelayUs = 0;
+  bool     pending  = false; // edge latched while interrupts are masked
+  float    phase    = 0.0f;  // pulses travelled since the last edge (0..1)
+  uint64_t phaseUs  = 0;
+};
+
+class FanSim {
+public:
+  SimFan       fan[FAN_COUNT];
+  ThermalPlant air;
+  bool         useAir = false;
+
+  // Wire the plants to the compiled-in channel table
+  FanSim() {
+    for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+      fan[ch].pwmPin  = kFanDefs[ch].pwmPin;
+      fan[ch].tachPin = kFanDefs[ch].tachPin;
+      fan[ch].ppr     = kFanDefs[ch].ppr ? kFanDefs[ch].ppr : 2;
+      fan[ch].plant.maxRpm = (float)kFanDefs[ch].maxRpm;
+      fan[ch].phaseUs = halNowUs();
+    }
+    plantUs_ = halNowUs();
+    halIrq().deliver = onBusy;
+    halIrq().ctx     = this;
+  }
+  ~FanSim() { if (halIrq().ctx == this) halIrq().deliver = nullptr; }
+
+  float dutyPct(uint8_t ch) const {
+    return fan[ch].pwmPin >= 0 ? halPinPercent(fan[ch].pwmPin) : fan[ch].fixedPct;
+  }
+
+  // loop() for ms of virtual time: due jobs, idle until the next tach edge
+  // or plant step (schedIdle() when that is >= 1 ms away), fire edges
+  void run(uint32_t ms) {
+    const uint64_t end = halNowUs() + (uint64_t)ms * 1000U;
+    while (halNowUs() < end) {
+      schedRun();
+      uint64_t next = plantUs_ + kPlantStepUs;
+      if (next > end) next = end;
+      for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+        if (fan[ch].nextUs && fan[ch].nextUs < next) next = fan[ch].nextUs;
+      }
+      const uint64_t now = halNowUs();
+      if (next > now) {
+        if (next - now >= 1000U) schedIdle((uint32_t)((next - now) / 1000U));
+        else clockAdvanceUs((uint32_t)(next - now));
+      }
+      for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) pulse(fan[ch]);
+      if (halNowUs() - plantUs_ >= kPlantStepUs) stepPlants();
+    }
+  }
+
+  // The firmware is busy until untilUs (halBusyUs): edges and plant steps
+  // due meanwhile happen at their time; with interrupts masked the ISR runs
+  // at untilUs instead, once per pin like the latched GPIO status
+  void busy(uint64_t untilUs, bool masked) {
+    for (;;) {
+      uint64_t next = plantUs_ + kPlantStepUs;
+      SimFan*  due  = nullptr;
+      for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+        if (fan[ch].nextUs && fan[ch].nextUs < next) { next = fan[ch].nextUs; due = &fan[ch]; }
+      }
+      if (next > untilUs) break;
+      g_clockVirtUs = next;
+      if (!due) { stepPlants(); continue; }
+      if (!masked) { pulse(*due); continue; }
+      if (due->pending) due->lost++;
+      due->pending = true;
+      due->delayed++;
+      if (untilUs - next > due->maxDelayUs) due->maxDelayUs = untilUs - next;
+      edge(*due, false);
+    }
+    g_clockVirtUs = untilUs;
+    for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+      if (!fan[ch].pending) continue;
+      fan[ch].pending = false;
+      halFireEdge(fan[ch].tachPin);
+    }
+  }
+
+private:
+  static constexpr uint64_t kPlantStepUs = 1000;
+
+  static void onBusy(void* self, uint64_t untilUs, bool masked) {
+    static_cast<FanSim*>(self)->busy(untilUs, masked);
+  }
+  uint64_t plantUs_;
+
+  static float pulsesPerUs(const SimFan& f) { return f.plant.rpm * (float)f.ppr / 60.0e6f; }
+
+  static void advance(SimFan& f) {
+    f.phase  += pulsesPerUs(f) * (float)(halNowUs() - f.phaseUs);
+    f.phaseUs = halNowUs();
+  }
+
+  // Next edge from the pulse phase at the current speed (spin-up from 0 included)
+  static void schedule(SimFan& f) {
+    const float rate = pulsesPerUs(f);
+    if (f.tachPin < 0 || rate <= 0.0f) { f.nextUs = 0; return; }
+    const float left = f.phase >= 1.0f ? 0.0f : (1.0f - f.phase) / rate;
+    f.nextUs = halNowUs() + (uint64_t)left + 1;
+  }
+
+  void pulse(SimFan& f) {
+    if (!f.nextUs || f.nextUs > halNowUs()) return;
+    edge(f, true);
+  }
+
+  void edge(SimFan& f, bool fire) {
+    advance(f);
+    if (fire) halFireEdge(f.tachPin);
+    f.edges++;
+    f.phase = f.phase > 1.0f ? f.phase - 1.0f : 0.0f;
+    schedule(f);
+  }
+
+  void stepPlants() {
+    const float dtMs = (float)(halNowUs() - plantUs_) / 1000.0f;
+    plantUs_ = halNowUs();
+    for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+      SimFan& f = fan[ch];
+      advance(f);                       // at the old speed
+      f.plant.step(dutyPct(ch), dtMs);
+      schedule(f);
+    }
+    if (useAir) air.step(fan[0].plant.rpm / fan[0].plant.maxRpm, dtMs);
+  }
+};
@@ -0,0 +1,9 @@
+#pragma once
+// Stand-in for Adafruit GFX fonts: only the cell metrics the shim draws with
+#include <stdint.h>
+
+typedef struct {
+  uint8_t xAdvance;   // pen advance per character
+  uint8_t ascent;     // pixels above the baseline
+  uint8_t yAdvance;   // line height
+} GFXfont;
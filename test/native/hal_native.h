@@ -0,0 +1,153 @@
+#pragma once
+// Host-side HAL state behind the Arduino/IDF shims in this directory.
+// Tests use it to poke the firmware from outside: fire GPIO edges into the
+// attached ISRs, read back the LEDC duty (including a running fade),
+// feed/collect the USB serial link, and let busy-waiting code (1-Wire) delay
+// or mask interrupts. Time is the firmware's virtual clock.
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+#if !CLOCK_VIRTUAL
+#error "native builds run on the virtual clock (-DCLOCK_VIRTUAL=1)"
+#endif
+
+extern volatile uint64_t g_clockVirtUs; // src/clock.cpp
+
+inline uint64_t halNowUs() { return g_clockVirtUs; }
+
+// ---- GPIO ----
+static constexpr int kHalPins = 32;
+
+struct HalPin {
+  uint8_t mode  = 0;
+  uint8_t level = 1;              // idle high (pull-ups)
+  void  (*isr)(void*) = nullptr;
+  void*   arg   = nullptr;
+  int     edge  = 0;
+};
+
+inline HalPin& halPin(int pin) {
+  static HalPin pins[kHalPins + 1];
+  return pins[(pin >= 0 && pin < kHalPins) ? pin : kHalPins];
+}
+
+// One tach pulse (falling edge) on pin; calls the ISR like the GPIO driver would
+inline void halFireEdge(int pin) {
+  HalPin& p = halPin(pin);
+  if (p.isr) p.isr(p.arg);
+}
+
+// ---- CPU busy time and interrupt latency ----
+// Firmware code that waits on hardware (1-Wire slots, RMT transfers) spends
+// us here. Interrupts that come due meanwhile run on time, or with masked
+// set, all at the end (the 1-Wire bit-bang critical sections). An edge
+// source such as fan_sim.h hooks in through deliver.
+struct HalIrq {
+  void   (*deliver)(void* ctx, uint64_t untilUs, bool masked) = nullptr;
+  void*    ctx      = nullptr;
+  uint64_t maskedUs = 0;          // total time with interrupts masked
+  uint64_t busyUs   = 0;          // total busy time, masked or not
+};
+
+inline HalIrq& halIrq() {
+  static HalIrq s;
+  return s;
+}
+
+inline void halBusyUs(uint32_t us, bool masked) {
+  HalIrq& q = halIrq();
+  const uint64_t end = halNowUs() + us;
+  q.busyUs += us;
+  if (masked) q.maskedUs += us;
+  if (q.deliver) q.deliver(q.ctx, end, masked);
+  g_clockVirtUs = end;
+}
+
+// ---- LEDC (channel = Arduino ledc channel, low-speed group) ----
+static constexpr int kHalLedcChannels = 8;
+
+struct HalLedc {
+  uint8_t  bits      = 10;
+  int      pin       = -1;
+  uint32_t from      = 0;         // fade start duty (== to when no fade runs)
+  uint32_t to        = 0;
+  uint64_t t0Us      = 0;
+  uint32_t fadeMs    = 0;
+  uint32_t pending   = 0;         // ledc_set_fade_with_time() target, started by ledc_fade_start()
+  uint32_t pendingMs = 0;
+  uint32_t updates   = 0;         // duty changes written
+  uint32_t blocked   = 0;         // calls that would have waited for a running fade
+  uint64_t blockedUs = 0;         // ...and how long the loop task would have stalled
+};
+
+inline HalLedc& halLedc(int ch) {
+  static HalLedc lc[kHalLedcChannels + 1];
+  return lc[(ch >= 0 && ch < kHalLedcChannels) ? ch : kHalLedcChannels];
+}
+
+inline uint64_t halLedcFadeEndUs(int ch) {
+  const HalLedc& c = halLedc(ch);
+  return c.t0Us + (uint64_t)c.fadeMs * 1000U;
+}
+
+inline bool halLedcFading(int ch) { return halNowUs() < halLedcFadeEndUs(ch) && halLedc(ch).from != halLedc(ch).to; }
+
+// Duty the hardware outputs right now (a fade moves linearly)
+inline uint32_t halLedcDuty(int ch) {
+  const HalLedc& c = halLedc(ch);
+  if (!halLedcFading(ch)) return c.to;
+  const uint64_t el = halNowUs() - c.t0Us;
+  return (uint32_t)((int64_t)c.from + ((int64_t)c.to - (int64_t)c.from) * (int64_t)el / ((int64_t)c.fadeMs * 1000));
+}
+
+inline float halLedcPercent(int ch) {
+  return (float)halLedcDuty(ch) * 100.0f / (float)((1u << halLedc(ch).bits) - 1);
+}
+
+// Percent on a pin (0 if no channel drives it)
+inline float halPinPercent(int pin) {
+  for (int ch = 0; ch < kHalLedcChannels; ++ch) {
+    if (halLedc(ch).pin == pin) return halLedcPercent(ch);
+  }
+  return 0.0f;
+}
+
+// Start a duty change; a running fade that is still busy counts as a stall
+inline void halLedcAcquire(int ch) {
+  HalLedc& c = halLedc(ch);
+  if (halLedcFading(ch)) {
+    c.blocked++;
+    c.blockedUs += halLedcFadeEndUs(ch) - halNowUs();
+  }
+}
+
+inline void halLedcSet(int ch, uint32_t duty, uint32_t fadeMs) {
+  HalLedc& c = halLedc(ch);
+  c.from   = fadeMs ? halLedcDuty(ch) : duty;
+  c.to     = duty;
+  c.t0Us   = halNowUs();
+  c.fadeMs = fadeMs;
+  c.updates++;
+}
+
+// ---- USB serial (HWCDC) ----
+struct HalSerialState {
+  bool        connected = true;   // DTR / host port open
+  std::string rx;                 // host → device, consumed by read()
+  std::string tx;                 // device → host
+  size_t      txRoom    = 256;    // what availableForWrite() reports
+};
+
+inline HalSerialState& halSerial() {
+  static HalSerialState s;
+  return s;
+}
+
+// ---- reset between tests ----
+inline void halReset() {
+  for (int i = 0; i <= kHalPins; ++i) halPin(i) = HalPin();
+  for (int i = 0; i <= kHalLedcChannels; ++i) halLedc(i) = HalLedc();
+  halSerial() = HalSerialState();
+  halIrq().maskedUs = halIrq().busyUs = 0;      // the edge source stays hooked
+}
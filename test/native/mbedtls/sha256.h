@@ -0,0 +1,81 @@
+#pragma once
+// SHA-256 with the mbedtls context API (FIPS 180-4, plain C++ on the host)
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef struct {
+  uint32_t state[8];
+  uint64_t total;
+  uint8_t  buf[64];
+} mbedtls_sha256_context;
+
+namespace sha256_native {
+static constexpr uint32_t K[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+inline uint32_t ror(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+inline void block(mbedtls_sha256_context* c, const uint8_t* p) {
+  uint32_t w[64];
+  for (int i = 0; i < 16; ++i) w[i] = (uint32_t)p[4 * i] << 24 | p[4 * i + 1] << 16 | p[4 * i + 2] << 8 | p[4 * i + 3];
+  for (int i = 16; i < 64; ++i) {
+    const uint32_t s0 = ror(w[i - 15], 7) ^ ror(w[i - 15], 18) ^ (w[i - 15] >> 3);
+    const uint32_t s1 = ror(w[i - 2], 17) ^ ror(w[i - 2], 19) ^ (w[i - 2] >> 10);
+    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+  }
+  uint32_t a = c->state[0], b = c->state[1], cc = c->state[2], d = c->state[3];
+  uint32_t e = c->state[4], f = c->state[5], g = c->state[6], h = c->state[7];
+  for (int i = 0; i < 64; ++i) {
+    const uint32_t t1 = h + (ror(e, 6) ^ ror(e, 11) ^ ror(e, 25)) + ((e & f) ^ (~e & g)) + K[i] + w[i];
+    const uint32_t t2 = (ror(a, 2) ^ ror(a, 13) ^ ror(a, 22)) + ((a & b) ^ (a & cc) ^ (b & cc));
+    h = g; g = f; f = e; e = d + t1; d = cc; cc = b; b = a; a = t1 + t2;
+  }
+  c->state[0] += a; c->state[1] += b; c->state[2] += cc; c->state[3] += d;
+  c->state[4] += e; c->state[5] += f; c->state[6] += g; c->state[7] += h;
+}
+}  // namespace sha256_native
+
+inline void mbedtls_sha256_init(mbedtls_sha256_context* c) { memset(c, 0, sizeof(*c)); }
+inline void mbedtls_sha256_free(mbedtls_sha256_context* c) { memset(c, 0, sizeof(*c)); }
+
+inline int mbedtls_sha256_starts(mbedtls_sha256_context* c, int /*is224*/) {
+  static const uint32_t iv[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+  memcpy(c->state, iv, sizeof(iv));
+  c->total = 0;
+  return 0;
+}
+
+inline int mbedtls_sha256_update(mbedtls_sha256_context* c, const unsigned char* p, size_t n) {
+  while (n > 0) {
+    const size_t used = (size_t)(c->total & 63);
+    const size_t k = n < 64 - used ? n : 64 - used;
+    memcpy(c->buf + used, p, k);
+    c->total += k; p += k; n -= k;
+    if ((c->total & 63) == 0) sha256_native::block(c, c->buf);
+  }
+  return 0;
+}
+
+inline int mbedtls_sha256_finish(mbedtls_sha256_context* c, unsigned char out[32]) {
+  const uint64_t bits = c->total * 8;
+  const uint8_t pad = 0x80, zero = 0;
+  mbedtls_sha256_update(c, &pad, 1);
+  while ((c->total & 63) != 56) mbedtls_sha256_update(c, &zero, 1);
+  uint8_t len[8];
+  for (int i = 0; i < 8; ++i) len[i] = (uint8_t)(bits >> (56 - 8 * i));
+  mbedtls_sha256_update(c, len, 8);
+  for (int i = 0; i < 8; ++i) {
+    out[4 * i] = (uint8_t)(c->state[i] >> 24); out[4 * i + 1] = (uint8_t)(c->state[i] >> 16);
+    out[4 * i + 2] = (uint8_t)(c->state[i] >> 8); out[4 * i + 3] = (uint8_t)c->state[i];
+  }
+  return 0;
+}
@@ -0,0 +1,225 @@
+#pragma once
+// 1-Wire bus with DS18x20/MAX31850 slaves at the time-slot level, behind
+// the OneWire library and RMT shims. Each slot is a wired AND: the master
+// releases early for a 1 (write 1 / read), a transmitting slave holds the
+// line for a 0, and every slave clocks in what the line showed. The slaves
+// implement READ/MATCH/SKIP/SEARCH ROM, CONVERT T, READ and WRITE SCRATCHPAD;
+// conversions finish after the resolution's conversion time.
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include "hal_native.h"
+
+inline uint8_t owCrc8(const uint8_t* p, uint8_t n) {
+  uint8_t crc = 0;
+  while (n--) {
+    uint8_t b = *p++;
+    for (uint8_t i = 0; i < 8; ++i) {
+      const uint8_t mix = (crc ^ b) & 1;
+      crc >>= 1;
+      if (mix) crc ^= 0x8C;
+      b >>= 1;
+    }
+  }
+  return crc;
+}
+
+struct OwSlave {
+  uint8_t  rom[8]   = {0};
+  float    tempC    = 25.0f;     // what the next conversion reads
+  bool     present  = true;
+  uint8_t  sp[9]    = {0};       // scratchpad as read (CRC in sp[8])
+  uint64_t convEndUs = 0;        // conversion running until then
+  uint32_t conversions = 0;
+  uint32_t configWrites = 0;     // WRITE SCRATCHPAD received
+  uint8_t  eepromConfig = 0x7F;  // what a power cycle restores (12 bit)
+
+  // protocol state
+  enum State : uint8_t { IDLE, ROM_CMD, MATCH, SEARCH, FUNC, READ, WRITE_SP } st = IDLE;
+  uint8_t  rx = 0, rxBits = 0;   // byte being received
+  uint8_t  txBuf[9];
+  uint8_t  txLen = 0, txPos = 0; // bits sent from txBuf
+  uint8_t  romBit = 0;           // MATCH/SEARCH position
+  uint8_t  searchPhase = 0;      // 0 = send bit, 1 = complement, 2 = read direction
+  uint8_t  wsp[3];
+  uint8_t  wspN = 0;
+
+  bool hasConfig() const { return rom[0] == 0x28 || rom[0] == 0x22; }
+  uint8_t bits() const { return hasConfig() ? (uint8_t)(9 + ((sp[4] >> 5) & 3)) : 12; }
+  uint32_t convUs() const { return (94000U << (bits() - 9)) - 2000U; } // a bit under the max
+
+  // Power-on state: 85 °C in the temperature register, config from EEPROM
+  void powerUp() {
+    const int16_t raw = rom[0] == 0x3B ? (int16_t)0 : rom[0] == 0x10 ? (int16_t)0x00AA : (int16_t)0x0550;
+    sp[0] = (uint8_t)raw; sp[1] = (uint8_t)(raw >> 8);
+    sp[2] = 0x4B; sp[3] = 0x46;
+    sp[4] = rom[0] == 0x3B ? 0xF0 : eepromConfig;     // MAX31850: AD pins + reserved bits
+    sp[5] = 0xFF; sp[6] = 0x0C; sp[7] = 0x10;
+    sp[8] = owCrc8(sp, 8);
+    convEndUs = 0;
+    st = IDLE;
+  }
+
+  void finishConversion() {
+    if (!convEndUs || halNowUs() < convEndUs) return;
+    convEndUs = 0;
+    int16_t raw;
+    if (rom[0] == 0x3B) {
+      raw = (int16_t)lroundf(tempC * 4.0f) * 4;          // 0.25 °C, bits 15..2; fault bit clear
+    } else if (rom[0] == 0x10) {
+      raw = (int16_t)lroundf(tempC * 2.0f);              // 0.5 °C
+      const int16_t r16 = (int16_t)lroundf(tempC * 16.0f);
+      sp[6] = (uint8_t)(16 - (r16 - (raw & ~1) * 8 + 4)); // COUNT_REMAIN, COUNT_PER_C = 16
+      sp[7] = 16;
+    } else {
+      raw = (int16_t)lroundf(tempC * 16.0f);
+      raw &= (int16_t)~((1 << (12 - bits())) - 1);       // undefined low bits read as 0
+    }
+    sp[0] = (uint8_t)raw; sp[1] = (uint8_t)(raw >> 8);
+    sp[8] = owCrc8(sp, 8);
+  }
+
+  void reset() {
+    finishConversion();
+    st = present ? ROM_CMD : IDLE;
+    rx = rxBits = 0;
+    txLen = txPos = 0;
+  }
+
+  // Bit this slave drives in the coming slot (1 = leaves the line alone)
+  uint8_t drive() const {
+    if (st == SEARCH) {
+      const uint8_t b = (rom[romBit >> 3] >> (romBit & 7)) & 1;
+      return searchPhase == 0 ? b : searchPhase == 1 ? (uint8_t)!b : 1;
+    }
+    if (st == READ && txPos < txLen) return (txBuf[txPos >> 3] >> (txPos & 7)) & 1;
+    return 1;
+  }
+
+  void send(const uint8_t* p, uint8_t n) {
+    memcpy(txBuf, p, n);
+    txLen = (uint8_t)(n * 8);
+    txPos = 0;
+    st = READ;
+  }
+
+  void command(uint8_t c) {
+    if (st == ROM_CMD) {
+      switch (c) {
+      case 0x33: send(rom, 8); break;                         // READ ROM
+      case 0x55: st = MATCH; romBit = 0; break;
+      case 0xCC: st = FUNC; break;
+      case 0xF0: st = SEARCH; romBit = 0; searchPhase = 0; break;
+      default:   st = IDLE; break;
+      }
+      return;
+    }
+    if (st == FUNC) {
+      switch (c) {
+      case 0x44:
+        convEndUs = halNowUs() + convUs();
+        conversions++;
+        st = IDLE;
+        break;
+      case 0xBE: finishConversion(); send(sp, 9); break;
+      case 0x4E:                                           // the MAX31850 has none
+        configWrites++;
+        st = rom[0] == 0x3B ? IDLE : WRITE_SP;
+        wspN = 0;
+        break;
+      default:   st = IDLE; break;
+      }
+      return;
+    }
+    if (st == WRITE_SP) {
+      wsp[wspN++] = c;
+      const uint8_t n = hasConfig() ? 3 : 2;
+      if (wspN < n) return;
+      sp[2] = wsp[0]; sp[3] = wsp[1];
+      if (hasConfig()) sp[4] = (uint8_t)((wsp[2] & 0x60) | 0x1F);
+      sp[8] = owCrc8(sp, 8);
+      st = IDLE;
+    }
+  }
+
+  // The line level of a finished slot
+  void clock(uint8_t line) {
+    switch (st) {
+    case SEARCH:
+      if (searchPhase < 2) { searchPhase++; return; }
+      if (line != ((rom[romBit >> 3] >> (romBit & 7)) & 1)) { st = IDLE; return; }
+      searchPhase = 0;
+      if (++romBit == 64) st = FUNC;
+      return;
+    case MATCH:
+      if (line != ((rom[romBit >> 3] >> (romBit & 7)) & 1)) { st = IDLE; return; }
+      if (++romBit == 64) st = FUNC;
+      return;
+    case READ:
+      if (txPos < txLen) txPos++;
+      return;
+    case ROM_CMD:
+    case FUNC:
+    case WRITE_SP:
+      rx |= (uint8_t)(line << rxBits);
+      if (++rxBits == 8) {
+        const uint8_t c = rx;
+        rx = rxBits = 0;
+        command(c);
+      }
+      return;
+    default:
+      return;
+    }
+  }
+};
+
+struct OwBus {
+  static constexpr uint8_t kMaxSlaves = 8;
+  OwSlave  slave[kMaxSlaves];
+  uint8_t  n       = 0;
+  uint32_t resets  = 0;
+  uint32_t slots   = 0;
+
+  OwSlave& add(uint8_t family, uint8_t serial, float tempC) {
+    OwSlave& s = slave[n++];
+    s = OwSlave();
+    s.rom[0] = family;
+    s.rom[1] = serial;
+    for (uint8_t i = 2; i < 7; ++i) s.rom[i] = (uint8_t)(serial * 31 + i);
+    s.rom[7] = owCrc8(s.rom, 7);
+    s.tempC  = tempC;
+    s.powerUp();
+    return s;
+  }
+
+  // true = presence pulse
+  bool reset() {
+    resets++;
+    bool any = false;
+    for (uint8_t i = 0; i < n; ++i) {
+      slave[i].reset();
+      any |= slave[i].present;
+    }
+    return any;
+  }
+
+  // One slot; master sends bit (1 also for a read). Returns the line level.
+  uint8_t slot(uint8_t bit) {
+    slots++;
+    uint8_t line = bit;
+    for (uint8_t i = 0; i < n; ++i) {
+      if (slave[i].present) line &= slave[i].drive();
+    }
+    for (uint8_t i = 0; i < n; ++i) {
+      if (slave[i].present) slave[i].clock(line);
+    }
+    return line;
+  }
+};
+
+// One bus per test binary (the firmware has one 1-Wire pin)
+inline OwBus& owBus() {
+  static OwBus b;
+  return b;
+}
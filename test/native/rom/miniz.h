@@ -0,0 +1,65 @@
+#pragma once
+// The ROM tinfl API backed by zlib's raw inflate on the host. Like the
+// ROM inflater, it may already have consumed up to 4 bytes past the end of
+// the deflate stream when it reports DONE (bit buffer read-ahead); the
+// amount is set per test with g_tinflReadAhead.
+#include <stddef.h>
+#include <stdint.h>
+#include <zlib.h>
+
+#define TINFL_LZ_DICT_SIZE 32768
+
+enum {
+  TINFL_FLAG_PARSE_ZLIB_HEADER = 1,
+  TINFL_FLAG_HAS_MORE_INPUT = 2,
+  TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF = 4,
+  TINFL_FLAG_COMPUTE_ADLER32 = 8
+};
+
+typedef enum {
+  TINFL_STATUS_BAD_PARAM = -3,
+  TINFL_STATUS_ADLER32_MISMATCH = -2,
+  TINFL_STATUS_FAILED = -1,
+  TINFL_STATUS_DONE = 0,
+  TINFL_STATUS_NEEDS_MORE_INPUT = 1,
+  TINFL_STATUS_HAS_MORE_OUTPUT = 2
+} tinfl_status;
+
+typedef struct {
+  z_stream z;
+  bool     live;
+} tinfl_decompressor;
+
+inline size_t g_tinflReadAhead = 4;   // 0..4 bytes swallowed after the final block
+
+inline void tinfl_init(tinfl_decompressor* r) {
+  r->z = z_stream();
+  r->live = inflateInit2(&r->z, -MAX_WBITS) == Z_OK;
+}
+
+inline tinfl_status tinfl_decompress(tinfl_decompressor* r, const uint8_t* in, size_t* inSize,
+                                     uint8_t* /*outStart*/, uint8_t* out, size_t* outSize,
+                                     uint32_t /*flags*/) {
+  if (!r->live) { *inSize = *outSize = 0; return TINFL_STATUS_FAILED; }
+  r->z.next_in   = const_cast<uint8_t*>(in);
+  r->z.avail_in  = (uInt)*inSize;
+  r->z.next_out  = out;
+  r->z.avail_out = (uInt)*outSize;
+  const int zr = inflate(&r->z, Z_NO_FLUSH);
+  size_t used = *inSize - r->z.avail_in;
+  *outSize -= r->z.avail_out;
+
+  tinfl_status st;
+  if (zr == Z_STREAM_END) {
+    const size_t extra = r->z.avail_in < g_tinflReadAhead ? r->z.avail_in : g_tinflReadAhead;
+    used += extra;
+    st = TINFL_STATUS_DONE;
+  } else if (zr == Z_OK || zr == Z_BUF_ERROR) {
+    st = r->z.avail_out == 0 ? TINFL_STATUS_HAS_MORE_OUTPUT : TINFL_STATUS_NEEDS_MORE_INPUT;
+  } else {
+    st = TINFL_STATUS_FAILED;
+  }
+  *inSize = used;
+  if (st <= TINFL_STATUS_DONE) { inflateEnd(&r->z); r->live = false; }
+  return st;
+}
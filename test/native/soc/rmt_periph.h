@@ -0,0 +1,12 @@
+#pragma once
+// RMT signal indices for the GPIO matrix (values unused on the host)
+typedef struct {
+  struct {
+    struct {
+      int tx_sig;
+      int rx_sig;
+    } channels[4];
+  } groups[1];
+} rmt_signal_conn_t;
+
+inline const rmt_signal_conn_t rmt_periph_signals = {};
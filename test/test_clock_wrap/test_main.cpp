@@ -0,0 +1,147 @@
+// Wrap-around soak on the virtual clock: the scheduler, the tach windows and
+// the fan loop run for 3 h across the clockMs() wrap (30 min in) and two
+// clockUs() wraps (every 71.6 min), against the fan/air plant. The fan
+// controller stats start 1 h short of 2^32 ms of run time and pass it.
+#define CLOCK_START_MS (0xFFFFFFFFu - 30u * 60u * 1000u + 1u)
+
+#include <unity.h>
+#include "clock.cpp"
+#include "modules/sched.cpp"
+#include "modules/tach_core.cpp"
+#include "modules/fans.cpp"
+#include "modules/fancal.cpp"
+#include "modules/fanctrl.cpp"
+#include "modules/fanmon.cpp"
+#include "fan_sim.h"
+
+static HostState g_host;
+static UiState   g_ui;
+static FanSim*   g_sim;
+
+static uint32_t s_jobs20, s_jobs1000, s_once, s_gapMax;
+static uint32_t s_lastSensorsMs;
+static SchedId  s_onceId;
+
+// Worst RPM error while the fan holds its speed, sampled once a second
+static float    s_rpmErrMax;
+static float    s_prevTruth[FAN_COUNT];
+static uint32_t s_seqStalls;   // seconds without a new tach window on a spinning fan
+static uint32_t s_lastSeq[FAN_COUNT];
+static uint32_t s_rejects0[FAN_COUNT]; // outliers by the end of the first minute (spin-up)
+static float    s_tempMin = 1e9f, s_tempMax = -1e9f;
+
+// Controller stats as after 49.7 days at 20 % duty: run time 1 h short of 2^32 ms
+static constexpr uint64_t kPriorRunMs = 0xFFFFFFFFull - 3600000ull;
+
+static void jobSensors() {
+  const uint32_t now = clockMs();
+  if (s_jobs20 && now - s_lastSensorsMs > s_gapMax) s_gapMax = now - s_lastSensorsMs;
+  s_lastSensorsMs = now;
+  s_jobs20++;
+  g_host.local_temp_c = g_sim->air.dallasC();
+  fansTick();
+  fanCalTick(g_host);
+  fanCtrlTick(g_host, g_ui);
+  fanMonTick(g_host);
+}
+
+static void jobOnce() {
+  s_once++;
+  schedArm(s_onceId, 250);       // re-arms itself like the tap/UI one-shots
+}
+
+static void jobSecond() {
+  s_jobs1000++;
+  if (clockUptimeMs() < 60000) {
+    for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) s_rejects0[ch] = fanTachRejects(ch);
+    return;
+  }
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+    const float truth = g_sim->fan[ch].plant.rpm;
+    const int   rpm   = fanTachGetRPM(ch);
+    const bool  steady = fabsf(truth - s_prevTruth[ch]) < 0.005f * truth;
+    s_prevTruth[ch] = truth;
+    if (truth > 300.0f && steady) {
+      const float err = fabsf((float)rpm - truth) / truth;
+      if (err > s_rpmErrMax) s_rpmErrMax = err;
+    }
+    if (truth > 300.0f && fanTachSeq(ch) == s_lastSeq[ch]) s_seqStalls++;
+    s_lastSeq[ch] = fanTachSeq(ch);
+  }
+  if (clockUptimeMs() < 20u * 60u * 1000u) return;   // air settles (tau 90 s)
+  if (g_sim->air.tempC < s_tempMin) s_tempMin = g_sim->air.tempC;
+  if (g_sim->air.tempC > s_tempMax) s_tempMax = g_sim->air.tempC;
+}
+
+static void soak() {
+  static FanSim sim;
+  g_sim = &sim;
+  sim.useAir          = true;
+  sim.air.riseC       = 24.0f;    // ~40 °C with the fan off → curve mid-range
+  sim.air.tempC       = 35.0f;
+  sim.fan[1].fixedPct = 60.0f;    // tach-only fan on its own supply
+
+  fansBegin();
+  fanCalBegin();
+  fanCtrlBegin();
+  s_stat[0].runMs  = kPriorRunMs;
+  s_stat[0].dutyMs = kPriorRunMs * 20u;
+  schedEvery(SCHED_SENSORS_MS, jobSensors);
+  schedEvery(1000, jobSecond);
+  s_onceId = schedOnce(jobOnce);
+  schedArm(s_onceId, 250);
+
+  sim.run(3u * 3600u * 1000u);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_clock_wrapped() {
+  TEST_ASSERT_EQUAL_UINT32(3u * 3600u * 1000u, clockUptimeMs());
+  TEST_ASSERT_TRUE(clockMs() < (uint32_t)CLOCK_START_MS);    // ms clock went through 0
+  TEST_ASSERT_EQUAL_UINT32(2, (uint32_t)(g_clockVirtUs >> 32)); // two µs wraps
+}
+
+void test_jobs_keep_cadence() {
+  TEST_ASSERT_INT_WITHIN(1, 3u * 3600u * 1000u / SCHED_SENSORS_MS, s_jobs20);
+  TEST_ASSERT_INT_WITHIN(1, 3u * 3600u, s_jobs1000);
+  TEST_ASSERT_INT_WITHIN(1, 3u * 3600u * 4u, s_once);
+  TEST_ASSERT_EQUAL_UINT32(SCHED_SENSORS_MS, s_gapMax);  // no job skipped at a wrap
+}
+
+void test_tach_tracks_plant() {
+  TEST_ASSERT_TRUE(s_rpmErrMax <= 0.03f);
+  TEST_ASSERT_EQUAL_UINT32(0, s_seqStalls);
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+    TEST_ASSERT_EQUAL_UINT32(0, fanTachGlitches(ch));
+    TEST_ASSERT_EQUAL_UINT32(s_rejects0[ch], fanTachRejects(ch));
+  }
+}
+
+void test_fan_loop_regulates() {
+  TEST_ASSERT_TRUE(s_tempMin > 38.0f);
+  TEST_ASSERT_TRUE(s_tempMax < 41.0f);
+  TEST_ASSERT_EQUAL_UINT8(FAN_OK, g_host.fan[0].fault);
+  TEST_ASSERT_EQUAL_UINT32(0, halLedc(0).blocked);       // no LEDC call waited on a fade
+}
+
+// The run time passes 2^32 ms during the soak; the averages must not jump
+void test_stats_past_49_days() {
+  const FanCtrlStats st = fanCtrlStats(0);
+  TEST_ASSERT_TRUE(s_stat[0].runMs > 0xFFFFFFFFull);
+  TEST_ASSERT_INT_WITHIN(FAN_TICK_MS, kPriorRunMs + 3u * 3600u * 1000u, s_stat[0].runMs);
+  TEST_ASSERT_TRUE(st.avgDutyPct > 19.0f && st.avgDutyPct < 21.0f);
+  TEST_ASSERT_TRUE(st.togglesPerHour < 0.01f);
+}
+
+int main(int, char**) {
+  soak();
+  UNITY_BEGIN();
+  RUN_TEST(test_clock_wrapped);
+  RUN_TEST(test_jobs_keep_cadence);
+  RUN_TEST(test_tach_tracks_plant);
+  RUN_TEST(test_fan_loop_regulates);
+  RUN_TEST(test_stats_past_49_days);
+  return UNITY_END();
+}
@@ -0,0 +1,56 @@
+// Tach accuracy next to Dallas reads on the bit-banged 1-Wire bus (OneWire
+// library). The bus model (onewire_bus.h) masks interrupts for each slot's
+// timed part the way OneWire 2.3.x does; tach edges due meanwhile reach the
+// ISR late, at the end of the critical section. Simulated figures, not a
+// hardware measurement: see "Tach jitter from 1-Wire" in the README.
+#define USE_DALLAS 1
+#define DALLAS_RMT 0
+
+#include <stdio.h>
+#include <unity.h>
+#include "clock.cpp"
+#include "modules/sched.cpp"
+#include "modules/tach_core.cpp"
+#include "modules/fans.cpp"
+#include "modules/dallas.cpp"
+#include "fan_sim.h"
+
+static FanSim g_fanSim;
+
+#include "dallas_bench.h"
+
+static constexpr uint32_t kRunMs = 10u * 60u * 1000u;
+
+void setUp() {}
+void tearDown() {}
+
+void test_probes_read() { checkProbesRead(); }
+
+void test_resolution_resync() { checkResolutionResync(); }
+
+// Critical sections are at most 70 µs (reset presence sample): an edge is
+// late by no more than that, never lost at these speeds, and the RPM error
+// stays small next to the 30 % outlier gate
+void test_tach_with_dallas() {
+  const TachRun off = runTach(false, kRunMs);
+  const TachRun on  = runTach(true, kRunMs);
+  reportTach("bit-bang, off", off);
+  reportTach("bit-bang, on", on);
+  TEST_ASSERT_EQUAL_UINT32(0, off.delayed);
+  TEST_ASSERT_TRUE(on.delayed > 0);
+  TEST_ASSERT_TRUE(on.maxDelayUs <= 70);
+  TEST_ASSERT_EQUAL_UINT32(0, on.lost);
+  TEST_ASSERT_EQUAL_UINT32(0, on.rejects);
+  TEST_ASSERT_TRUE(on.errMaxPct < 1.0f);
+  TEST_ASSERT_TRUE(on.samples >= kRunMs / (DALLAS_FAST_MS + 800 + 100));  // period + 12-bit conversion
+}
+
+int main(int, char**) {
+  benchBegin(g_fanSim);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_probes_read);
+  RUN_TEST(test_resolution_resync);
+  RUN_TEST(test_tach_with_dallas);
+  return UNITY_END();
+}
@@ -0,0 +1,55 @@
+// Tach accuracy next to Dallas reads on the RMT 1-Wire backend (DALLAS_RMT).
+// The RMT driver shim plays each transfer on the bus model (onewire_bus.h)
+// while the loop task waits with interrupts on, so tach edges reach the ISR
+// on time. Same scenario as test_dallas_bitbang; simulated figures, not a
+// hardware measurement: see "Tach jitter from 1-Wire" in the README.
+#define USE_DALLAS 1
+#define DALLAS_RMT 1
+
+#include <stdio.h>
+#include <unity.h>
+#include "clock.cpp"
+#include "modules/sched.cpp"
+#include "modules/tach_core.cpp"
+#include "modules/fans.cpp"
+#include "modules/onewire_rmt.cpp"
+#include "modules/dallas.cpp"
+#include "fan_sim.h"
+
+static FanSim g_fanSim;
+
+#include "dallas_bench.h"
+
+static constexpr uint32_t kRunMs = 10u * 60u * 1000u;
+
+void setUp() {}
+void tearDown() {}
+
+void test_probes_read() { checkProbesRead(); }
+
+void test_resolution_resync() { checkResolutionResync(); }
+
+// No critical sections: every edge reaches the ISR at its time
+void test_tach_with_dallas() {
+  const TachRun off = runTach(false, kRunMs);
+  const TachRun on  = runTach(true, kRunMs);
+  reportTach("RMT, off", off);
+  reportTach("RMT, on", on);
+  TEST_ASSERT_EQUAL_UINT32(0, off.delayed);
+  TEST_ASSERT_EQUAL_UINT32(0, on.delayed);
+  TEST_ASSERT_EQUAL_UINT32(0, on.lost);
+  TEST_ASSERT_EQUAL_UINT32(0, on.rejects);
+  TEST_ASSERT_TRUE(on.maskedPct == 0.0f);
+  TEST_ASSERT_TRUE(on.errMaxPct <= off.errMaxPct);
+  TEST_ASSERT_TRUE(on.samples >= kRunMs / (DALLAS_FAST_MS + 800 + 100));  // period + 12-bit conversion
+}
+
+int main(int, char**) {
+  benchBegin(g_fanSim);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_probes_read);
+  RUN_TEST(test_resolution_resync);
+  RUN_TEST(test_tach_with_dallas);
+  return UNITY_END();
+}
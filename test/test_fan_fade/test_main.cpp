@@ -0,0 +1,78 @@
+// LEDC hardware fades (FAN_HW_FADE): a kick or a direct duty change during a
+// running fade must take effect at once and never wait for the fade
+#include <unity.h>
+#include "clock.cpp"
+#include "modules/sched.cpp"
+#include "modules/tach_core.cpp"
+#include "modules/fans.cpp"
+#include "modules/fancal.cpp"
+#include "modules/fanctrl.cpp"
+#include "fan_sim.h"
+
+static HostState g_host;
+static UiState   g_ui;
+static FanSim*   g_sim;
+
+static void jobSensors() {
+  g_host.local_temp_c = g_sim->air.dallasC();
+  fansTick();
+  fanCtrlTick(g_host, g_ui);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_direct_set_stops_fade() {
+  const uint32_t blocked0 = halLedc(0).blocked;
+  fanPwmFadeToPercent(0, 80, 1000);
+  clockAdvanceMs(300);
+  TEST_ASSERT_TRUE(fanPwmFading(0));
+  fanPwmSetPercent(0, 30);
+  TEST_ASSERT_EQUAL_UINT32(blocked0, halLedc(0).blocked);
+  TEST_ASSERT_FLOAT_WITHIN(0.2, 30.0, halLedcPercent(0));
+  TEST_ASSERT_FALSE(fanPwmFading(0));
+}
+
+// fanPwmFading() is whole ms; it must not end before the hardware fade does
+void test_fading_covers_fade() {
+  clockAdvanceUs(1400);                // fade starts mid-ms
+  fanPwmFadeToPercent(0, 60, 500);
+  while (halLedcFading(0)) {
+    TEST_ASSERT_TRUE(fanPwmFading(0));
+    clockAdvanceUs(100);
+  }
+  const uint32_t blocked0 = halLedc(0).blocked;
+  if (!fanPwmFading(0)) fanPwmFadeToPercent(0, 70, 500);
+  TEST_ASSERT_EQUAL_UINT32(blocked0, halLedc(0).blocked);
+}
+
+// Curve ramp in progress, then a recovery kick: the kick must hit 100% now
+void test_kick_during_ramp() {
+  static FanSim sim;
+  g_sim = &sim;
+  sim.air.tempC = 33.0f;               // ~13% on the curve
+  fansBegin();
+  fanCalBegin();
+  fanCtrlBegin();
+  schedEvery(SCHED_SENSORS_MS, jobSensors);
+  sim.run(20000);
+  const uint32_t blocked0 = halLedc(0).blocked;
+
+  sim.air.tempC = 50.0f;               // curve → 85%: multi-second ramp
+  sim.run(1500);
+  TEST_ASSERT_TRUE(fanPwmFading(0));
+  fanCtrlKick(0, 250);
+  sim.run(SCHED_SENSORS_MS + FAN_TICK_MS);
+  TEST_ASSERT_FLOAT_WITHIN(0.2, 100.0, sim.dutyPct(0));
+  sim.run(10000);
+  TEST_ASSERT_EQUAL_UINT32(blocked0, halLedc(0).blocked);
+}
+
+int main(int, char**) {
+  fansBegin();
+  UNITY_BEGIN();
+  RUN_TEST(test_direct_set_stops_fade);
+  RUN_TEST(test_fading_covers_fade);
+  RUN_TEST(test_kick_during_ramp);
+  return UNITY_END();
+}
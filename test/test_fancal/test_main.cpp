@@ -0,0 +1,89 @@
+// Calibration sweep against the fan plant: stall/start duty, top speed and
+// the spin-up time that sets the kick length, also with a late tach spike
+#include <stdio.h>
+#include <unity.h>
+#include "clock.cpp"
+#include "modules/sched.cpp"
+#include "modules/tach_core.cpp"
+#include "modules/fans.cpp"
+#include "modules/fancal.cpp"
+#include "modules/fanctrl.cpp"
+#include "fan_sim.h"
+
+static HostState g_host;
+static UiState   g_ui;
+static FanSim*   g_sim;
+
+// Plant t90 from standstill at 100%: tau * ln(10)
+static const float kT90Ms = 1500.0f * logf(10.0f);
+
+static void jobSensors() {
+  fansTick();
+  fanCalTick(g_host);
+  fanCtrlTick(g_host, g_ui);
+}
+
+// Stop the fan, start a sweep and run it to the end. spikeAtMs > 0 kicks the
+// plant 6% above its speed that long after the sweep went to 100%
+static void sweep(uint32_t spikeAtMs) {
+  g_sim->run(20000);                             // cool case: controller keeps the fan off
+  fanCalStart();
+  g_sim->run(SCHED_SENSORS_MS);                  // standstill seen → 100%
+  TEST_ASSERT_EQUAL_UINT8(CAL_SPINUP, s_phase);
+  if (spikeAtMs) {
+    g_sim->run(spikeAtMs);
+    g_sim->fan[0].plant.rpm *= 1.06f;
+  }
+  for (uint32_t s = 0; s < 600 && fanCalActive(); ++s) g_sim->run(1000);
+  TEST_ASSERT_EQUAL_STRING("done", fanCalStatus());
+}
+
+void setUp() {}
+void tearDown() {}
+
+static void report(const char* name, const FanCalData& d) {
+  char msg[120];
+  snprintf(msg, sizeof msg, "%-6s stall %u %%, start %u %%, top %u rpm, spin-up %u ms (plant t90 %.0f ms)",
+           name, d.stallPct, d.startPct, d.rpm[10], d.spinUpMs, kT90Ms);
+  TEST_MESSAGE(msg);
+}
+
+void test_sweep_finds_plant_limits() {
+  sweep(0);
+  const FanCalData& d = fanCalData(0);
+  report("clean", d);
+  TEST_ASSERT_INT_WITHIN(2, 6, d.stallPct);     // stalls at <= 5 %; coasting hides it for a step
+  TEST_ASSERT_INT_WITHIN(2, 10, d.startPct);   // 10 % on the LEDC reads back a hair below
+  TEST_ASSERT_INT_WITHIN(60, (int)g_sim->fan[0].plant.maxRpm, d.rpm[10]);
+  // t90 plus up to one tach window of reporting delay
+  TEST_ASSERT_TRUE(d.spinUpMs >= kT90Ms - 100.0f);
+  TEST_ASSERT_TRUE(d.spinUpMs <= kT90Ms + FAN1_TACH_WIN_MS);
+  TEST_ASSERT_EQUAL_UINT32(d.spinUpMs / 4U, s_ch[0].kickMs);   // applied after the sweep
+}
+
+// A peak near the end of the window raises the 90 % mark a little; the
+// crossing time must stay near t90, not move to the peak
+void test_late_spike_keeps_spin_up() {
+  sweep(FANCAL_SPINUP_MS - 1500);
+  const FanCalData& d = fanCalData(0);
+  report("spike", d);
+  TEST_ASSERT_TRUE(d.rpm[10] > g_sim->fan[0].plant.maxRpm * 1.01f);  // the spike is the top
+  TEST_ASSERT_TRUE(d.spinUpMs >= kT90Ms - 100.0f);
+  TEST_ASSERT_TRUE(d.spinUpMs <= kT90Ms + 1000.0f);
+}
+
+int main(int, char**) {
+  static FanSim sim;
+  g_sim = &sim;
+  g_host.local_temp_c = 25.0f;
+  sim.fan[1].fixedPct = 60.0f;    // tach-only fan on its own supply: not swept
+  fansBegin();
+  fanCalBegin();
+  fanCtrlBegin();
+  schedEvery(SCHED_SENSORS_MS, jobSensors);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_sweep_finds_plant_limits);
+  RUN_TEST(test_late_spike_keeps_spin_up);
+  return UNITY_END();
+}
@@ -0,0 +1,167 @@
+// Load-trend feed-forward (FAN_USE_FF): the term stays within FAN_FF_MAX_PCT,
+// decays to 0 over FAN_FF_DECAY_MS, ignores falling load and frames closer
+// than 10 s, and in the case-air model a backup burst peaks cooler with it
+// for no more fan duty
+#define FAN_USE_DISK 0    // only the feed-forward differs between the runs
+#define FAN_USE_CPU  0
+
+#include <unity.h>
+#include "clock.cpp"
+#include "modules/sched.cpp"
+#include "modules/tach_core.cpp"
+#include "modules/fans.cpp"
+#include "modules/fancal.cpp"
+#include "modules/fanctrl.cpp"
+#include "fan_sim.h"
+
+static HostState g_host;
+static UiState   g_ui;
+static FanSim*   g_sim;
+
+static void frame(float load1, float cpu, float rxKbps) {
+  g_host.load1       = load1;
+  g_host.cpu_percent = cpu;
+  g_host.net_rx_kbps = rxKbps;
+  g_ui.lastParseOkMs = clockMs();
+  g_ui.parseOkCount++;
+}
+
+static void tickFor(uint32_t ms, float* ffMax = nullptr) {
+  for (uint32_t el = 0; el < ms; el += FAN_TICK_MS) {
+    clockAdvanceMs(FAN_TICK_MS);
+    fanCtrlTick(g_host, g_ui);
+    if (ffMax && g_host.fan_ff_pct > *ffMax) *ffMax = g_host.fan_ff_pct;
+  }
+}
+
+void setUp() {
+  g_host.local_temp_c = 38.0f;
+  tickFor(FAN_FF_DECAY_MS + 1000);           // previous term gone
+  frame(NAN, NAN, NAN);                      // reset the slopes
+  tickFor(POLL_INTERVAL_MS);
+}
+void tearDown() {}
+
+void test_bounded_under_extreme_rise() {
+  float ffMax = 0;
+  frame(1, 5, 0);
+  tickFor(POLL_INTERVAL_MS, &ffMax);
+  for (int i = 1; i <= 10; ++i) {            // +30 load/min, +50 %/min, +1 Gbit/s per min
+    frame(1 + 60.0f * i, fminf(5 + 100.0f * i, 100), 2000000.0f * i);
+    tickFor(POLL_INTERVAL_MS, &ffMax);
+  }
+  TEST_ASSERT_TRUE(ffMax <= FAN_FF_MAX_PCT);
+  TEST_ASSERT_FLOAT_WITHIN(0.1, FAN_FF_MAX_PCT, ffMax);   // sampled one tick into the decay
+  TEST_ASSERT_TRUE(g_host.fan[0].duty_cmd <= 100.0f);
+}
+
+void test_decays_linearly_to_zero() {
+  frame(1, 5, 0);
+  tickFor(POLL_INTERVAL_MS);
+  frame(5, 40, 0);                           // +2 load/min → 5 % (after the alpha 1/2 EWMA)
+  tickFor(FAN_TICK_MS);
+  const float peak = g_host.fan_ff_pct;
+  TEST_ASSERT_TRUE(peak > 0.0f && peak <= FAN_FF_MAX_PCT);
+  tickFor(FAN_FF_DECAY_MS / 2 - FAN_TICK_MS);
+  TEST_ASSERT_FLOAT_WITHIN(0.05f * peak + 0.01f, peak / 2, g_host.fan_ff_pct);
+  tickFor(FAN_FF_DECAY_MS / 2);
+  TEST_ASSERT_FLOAT_WITHIN(0.0001, 0.0, g_host.fan_ff_pct);
+}
+
+void test_falling_load_adds_nothing() {
+  float ffMax = 0;
+  frame(8, 90, 500000);
+  tickFor(POLL_INTERVAL_MS, &ffMax);
+  for (int i = 1; i <= 4; ++i) {
+    frame(8 - 1.5f * i, 90 - 20.0f * i, 500000 - 100000.0f * i);
+    tickFor(POLL_INTERVAL_MS, &ffMax);
+  }
+  TEST_ASSERT_FLOAT_WITHIN(0.0001, 0.0, ffMax);
+}
+
+// An immediate GET answer a second after a frame says nothing about a trend
+void test_close_frames_ignored() {
+  frame(1, 5, 0);
+  tickFor(POLL_INTERVAL_MS);
+  frame(4, 30, 0);
+  tickFor(FAN_TICK_MS);
+  const float ff = g_host.fan_ff_pct;
+  tickFor(1000);
+  frame(20, 100, 0);                         // 1 s later: would be +960 load/min
+  tickFor(FAN_TICK_MS);
+  TEST_ASSERT_TRUE(g_host.fan_ff_pct <= ff);
+}
+
+// ---- case-air model: a backup burst ----
+// Host load steps up for 10 min; the heat in the case follows with a 2 min
+// lag and the air (8 min time constant) later still, so the Dallas probe
+// sees the burst late. Frames every POLL_INTERVAL_MS.
+struct Burst { float peakC = 0, peakDuty = 0, ffMax = 0; };
+
+static float s_load, s_heatC;
+
+static void jobSensors() {
+  g_host.local_temp_c = g_sim->air.dallasC();
+  fansTick();
+  fanCtrlTick(g_host, g_ui);
+}
+
+static void jobHeat() {                      // 1 s: heat load follows the host load
+  const float target = 8.0f + 3.0f * s_load;
+  s_heatC += (target - s_heatC) * (1.0f - expf(-1000.0f / 120000.0f));
+  g_sim->air.riseC = s_heatC;
+}
+
+static Burst runBurst(bool reportLoad) {
+  Burst b;
+  s_load = 0.5f;
+  s_heatC = 8.0f + 3.0f * s_load;
+  g_sim->air.tempC = 32.0f;
+  g_host = HostState();
+  fanCtrlBegin();
+  for (int f = 0; f < 60; ++f) {             // 1 h idle, backup, 40 min after; one frame per poll
+    s_load = (f >= 30 && f < 35) ? (f == 30 ? 5.0f : 8.0f) : 0.5f;   // 10 min backup
+    if (reportLoad) frame(s_load, 10.0f * s_load, 20000.0f * s_load);
+    else            frame(NAN, NAN, NAN);
+    for (uint32_t el = 0; el < POLL_INTERVAL_MS; el += 1000) {
+      g_sim->run(1000);
+      if (f < 30) continue;
+      b.peakC    = fmaxf(b.peakC, g_sim->air.tempC);
+      if (!fanCtrlKicking(0)) b.peakDuty = fmaxf(b.peakDuty, g_sim->dutyPct(0));  // start kick aside
+      b.ffMax    = fmaxf(b.ffMax, g_host.fan_ff_pct);
+    }
+  }
+  char msg[120];
+  snprintf(msg, sizeof msg, "%s: peak %.2f °C, peak duty %.1f %%, ff max %.1f %%",
+           reportLoad ? "with ff" : "no ff  ", b.peakC, b.peakDuty, b.ffMax);
+  TEST_MESSAGE(msg);
+  return b;
+}
+
+void test_burst_peaks_lower() {
+  static FanSim sim;
+  g_sim = &sim;
+  sim.useAir    = true;
+  sim.air.tauMs = 480000.0f;
+  fansBegin();
+  schedEvery(SCHED_SENSORS_MS, jobSensors);
+  schedEvery(1000, jobHeat);
+
+  const Burst off = runBurst(false);
+  const Burst on  = runBurst(true);
+  TEST_ASSERT_TRUE(on.ffMax > 0.0f && on.ffMax <= FAN_FF_MAX_PCT);
+  TEST_ASSERT_TRUE(on.peakC < off.peakC);
+  TEST_ASSERT_TRUE(on.peakDuty <= off.peakDuty);  // equal here: the early duty replaces the late ramp
+}
+
+int main(int, char**) {
+  fansBegin();
+  fanCtrlBegin();
+  UNITY_BEGIN();
+  RUN_TEST(test_bounded_under_extreme_rise);
+  RUN_TEST(test_decays_linearly_to_zero);
+  RUN_TEST(test_falling_load_adds_nothing);
+  RUN_TEST(test_close_frames_ignored);
+  RUN_TEST(test_burst_peaks_lower);
+  return UNITY_END();
+}
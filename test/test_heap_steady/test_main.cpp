@@ -0,0 +1,203 @@
+// The allocation steady state from heaptrace.h: once warmed up, the loop's
+// work outside HTTP must not touch the heap. Runs the sensor and fan path
+// (Dallas on the bus model, tach, fancal, fanctrl, fanmon), the scheduler,
+// host frames through SerialClient (parse, the Debug preview copy) and log
+// lines drained to the link, with no web server and no page render.
+// Counts every malloc/calloc/realloc (glibc) and operator new in the binary,
+// the harness included: its buffers are sized up front.
+#define USE_DALLAS 1
+#define DALLAS_RMT 0
+#define LOG_CDC    1      // log lines go out on the host link (drainLog)
+
+#include <new>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unity.h>
+
+static uint32_t s_allocs;
+
+#if defined(__GLIBC__)
+extern "C" {
+void* __libc_malloc(size_t n) noexcept;
+void* __libc_calloc(size_t n, size_t sz) noexcept;
+void* __libc_realloc(void* p, size_t n) noexcept;
+
+void* malloc(size_t n) noexcept { s_allocs++; return __libc_malloc(n); }
+void* calloc(size_t n, size_t sz) noexcept { s_allocs++; return __libc_calloc(n, sz); }
+void* realloc(void* p, size_t n) noexcept { s_allocs++; return __libc_realloc(p, n); }
+}
+#endif
+
+void* operator new(size_t n) {
+#if !defined(__GLIBC__)
+  s_allocs++;                                 // malloc() itself is not counted here
+#endif
+  if (void* p = malloc(n ? n : 1)) return p;
+  throw std::bad_alloc();
+}
+void* operator new[](size_t n) { return operator new(n); }
+void  operator delete(void* p) noexcept { free(p); }
+void  operator delete[](void* p) noexcept { free(p); }
+void  operator delete(void* p, size_t) noexcept { free(p); }
+void  operator delete[](void* p, size_t) noexcept { free(p); }
+
+#include "clock.cpp"
+#include "modules/sched.cpp"
+#include "modules/logring.cpp"
+#include "modules/tach_core.cpp"
+#include "modules/fans.cpp"
+#include "modules/fancal.cpp"
+#include "modules/fanctrl.cpp"
+#include "modules/fanmon.cpp"
+#include "modules/dallas.cpp"
+#include "serial_client.cpp"
+#include "fan_sim.h"
+#include "onewire_bus.h"
+
+static HostState    g_host;
+static UiState      g_ui;
+static SerialClient g_serial;
+static DallasProbe  g_dallas;
+static FanSim       g_sim;
+
+// A full v1 frame, a smaller one (disks idle, no guests) and a broken one
+// ("bad frame" log line): none longer than the first, which warm-up sends
+static const char kFrameFull[] =
+    "{\"schema_version\":1,\"hostname\":\"pve-01\",\"uptime_s\":864000,"
+    "\"cpu\":{\"percent\":23.5,\"load1\":1.25,\"load5\":0.98,\"load15\":0.7},"
+    "\"ram\":{\"total_bytes\":68719476736,\"used_bytes\":21474836480},"
+    "\"filesystems\":[{\"mount\":\"/boot\",\"total_bytes\":1073741824,\"used_bytes\":104857600},"
+    "{\"mount\":\"/\",\"total_bytes\":107374182400,\"used_bytes\":32212254720}],"
+    "\"proxmox\":{\"vm_running\":3,\"vm_total\":5,\"lxc_running\":4,\"lxc_total\":6,"
+    "\"vms\":[{\"id\":100,\"name\":\"router\",\"status\":\"running\"},{\"id\":101,\"name\":\"nas\",\"status\":\"1\"},"
+    "{\"id\":102,\"name\":\"win11\",\"status\":\"stopped\"}],"
+    "\"lxcs\":[{\"id\":200,\"name\":\"dns\",\"status\":\"running\"},{\"id\":201,\"name\":\"proxy\",\"status\":\"running\"}]},"
+    "\"ip\":{\"primary_ifname\":\"vmbr0\",\"primary_ipv4\":\"192.168.1.10\",\"gateway_ipv4\":\"192.168.1.1\",\"ip_status\":\"ok\"},"
+    "\"net\":{\"window_s\":10,\"interfaces\":[{\"if\":\"eno1\",\"rx_Bps\":1200,\"tx_Bps\":800},"
+    "{\"if\":\"vmbr0\",\"rx_Bps\":125000,\"tx_Bps\":64000}]},"
+    "\"disks\":[{\"name\":\"sda\",\"state\":\"active\",\"temp_C\":38},{\"name\":\"sdb\",\"state\":\"standby\",\"temp_C\":null},"
+    "{\"name\":\"nvme0\",\"state\":\"active\",\"temperature_C\":44.6}]}";
+static const char kFrameIdle[] =
+    "{\"schema_version\":1,\"hostname\":\"pve-01\",\"uptime_s\":864120,"
+    "\"cpu\":{\"percent\":2.0,\"load1\":0.1,\"load5\":0.2,\"load15\":0.3},"
+    "\"ram\":{\"total\":68719476736,\"used\":8589934592},"
+    "\"net\":{\"window_s\":10,\"total_rx_bps\":80000,\"total_tx_bps\":40000},"
+    "\"disks\":[{\"name\":\"sda\",\"state\":\"idle\"},{\"name\":\"sdb\",\"state\":\"standby\"}]}";
+static const char kFrameBad[] = "{\"schema_version\":1,\"cpu\":{\"percent\":}}";
+
+static uint32_t s_frames;
+static uint32_t s_dallasSeq;
+
+// main.cpp's tickSensorsAndFans(), case probe from the air model
+static void tickSensorsAndFans() {
+  owBus().slave[0].tempC = g_sim.air.dallasC();
+  g_dallas.tick(false);
+  if (g_dallas.sampleSeq() != s_dallasSeq) {
+    s_dallasSeq = g_dallas.sampleSeq();
+    for (uint8_t i = 0; i < MAX_LOCAL_TEMPS; ++i) g_host.local_temps_c[i] = g_dallas.tempC(i);
+    g_host.local_temp_c     = g_dallas.lastC();
+    g_host.local_temp_count = g_dallas.count();
+    g_ui.stateGen++;
+  }
+  fansTick();
+  fanCalTick(g_host);
+  fanCtrlTick(g_host, g_ui);
+  fanMonTick(g_host);
+}
+
+static void jobSensors() {
+  tickSensorsAndFans();
+  const uint8_t changed = fanMonTakeChanges();
+  for (uint8_t ch = 0; ch < FAN_COUNT; ++ch) {
+    if (!(changed & (1u << ch))) continue;
+    g_serial.sendAlert(ch + 1, fanFaultName(g_host.fan[ch].fault), fanPwmGetPercent(ch), fanTachGetRPM(ch));
+  }
+}
+
+static void jobSerial() { g_serial.tick(g_host, g_ui); }   // loop(): woken by USB RX
+static void jobPoll() { g_serial.pollHost(); }
+
+// The host: reads (and drops) whatever the link sent, pushes a frame every
+// 5 s, each third one broken
+static void jobHost() {
+  HalSerialState& s = halSerial();
+  s.tx.clear();
+  const uint32_t k = s_frames++;
+  s.rx.append(k % 3 == 2 ? kFrameBad : k % 2 ? kFrameIdle : kFrameFull);
+}
+
+// Load steps every 3 min: the fans ramp, Dallas goes fast and slow
+static void jobHeat() {
+  g_sim.air.riseC = (clockUptimeMs() / (3u * 60u * 1000u)) % 2 ? 24.0f : 12.0f;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// 10 min after a 2 min warm-up (first frames, first Dallas rescan, log
+// ring wrapped): no allocation at all
+void test_no_alloc_in_steady_state() {
+  g_sim.run(2u * 60u * 1000u);
+  const uint32_t okFrames = g_ui.parseOkCount, badFrames = g_ui.parseErrCount;
+  const uint32_t dallasReads = g_dallas.sampleSeq();
+  const uint32_t allocs = s_allocs;
+
+  g_sim.run(10u * 60u * 1000u);
+
+  const uint32_t n = s_allocs - allocs;
+  char msg[160];
+  snprintf(msg, sizeof msg, "%u allocations in 10 min: %u frames parsed, %u rejected, %u Dallas reads",
+           (unsigned)n, (unsigned)(g_ui.parseOkCount - okFrames), (unsigned)(g_ui.parseErrCount - badFrames),
+           (unsigned)(g_dallas.sampleSeq() - dallasReads));
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_TRUE(g_ui.parseOkCount - okFrames >= 70);
+  TEST_ASSERT_TRUE(g_ui.parseErrCount - badFrames >= 30);
+  TEST_ASSERT_TRUE(g_dallas.sampleSeq() - dallasReads >= 50);
+  TEST_ASSERT_EQUAL_UINT32(0, n);
+}
+
+// The counter works: the Debug preview grows for a frame longer than any before
+void test_longer_frame_allocates() {
+  static char big[sizeof(kFrameFull) + 64];
+  const size_t n = sizeof(kFrameFull) - 2;    // without the closing brace
+  memcpy(big, kFrameFull, n);
+  memcpy(big + n, ",\"pad\":\"", 8);
+  memset(big + n + 8, 'x', 52);
+  memcpy(big + n + 60, "\"}", 3);
+  const uint32_t okFrames = g_ui.parseOkCount;
+  const uint32_t allocs = s_allocs;
+  halSerial().rx.append(big);
+  jobSerial();
+  TEST_ASSERT_EQUAL_UINT32(okFrames + 1, g_ui.parseOkCount);
+  TEST_ASSERT_TRUE(s_allocs - allocs >= 1);
+}
+
+int main(int, char**) {
+  halSerial().rx.reserve(4 * RX_LINEBUF_BYTES);
+  halSerial().tx.reserve(64 * 1024);
+  halSerial().txRoom = 4 * LOG_LINE_MAX;      // drainLog() sends whenever the ring has lines
+
+  owBus().add(0x28, 1, 30.0f);
+  owBus().add(0x28, 2, 35.0f);
+  g_sim.useAir          = true;
+  g_sim.air.tempC       = 30.0f;
+  g_sim.fan[1].fixedPct = 60.0f;              // tach-only fan on its own supply
+
+  fansBegin();
+  fanCalBegin();
+  fanCtrlBegin();
+  g_dallas.begin();
+  g_serial.begin();
+  schedEvery(SCHED_SENSORS_MS, jobSensors);
+  schedEvery(10, jobSerial);
+  schedEvery(SERIAL_PACE_MS, jobPoll);
+  schedEvery(1000, logTick);
+  schedEvery(5000, jobHost);
+  schedEvery(1000, jobHeat);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_no_alloc_in_steady_state);
+  RUN_TEST(test_longer_frame_allocates);
+  return UNITY_END();
+}
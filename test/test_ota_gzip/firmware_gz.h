@@ -0,0 +1,556 @@
+#pragma once
+// firmware.bin.gz: `gzip -9 firmware.bin` of makePayload() (40960 bytes);
+// the header carries FNAME "firmware.bin"
+#include <stdint.h>
+
+static const uint8_t kFirmwareGz[] = {
+  0x1f, 0x8b, 0x08, 0x08, 0x85, 0xc7, 0xd5, 0x6a, 0x02, 0x03, 0x66, 0x69, 0x72, 0x6d, 0x77, 0x61,
+  0x72, 0x65, 0x2e, 0x62, 0x69, 0x6e, 0x00, 0x7d, 0x7d, 0x4b, 0xce, 0x04, 0x4b, 0xaf, 0x94, 0x04,
+  0xb3, 0xbb, 0x8a, 0x7f, 0x09, 0xb6, 0xf3, 0xbd, 0x1c, 0xa4, 0x2b, 0x66, 0x20, 0x84, 0x60, 0xc0,
+  0x92, 0xd9, 0x05, 0x05, 0xa7, 0x1d, 0xe9, 0xf8, 0x32, 0xc4, 0xb4, 0xd4, 0xaa, 0xae, 0xaa, 0xcc,
+  0xf4, 0x23, 0x1c, 0x0e, 0xff, 0xef, 0xff, 0xf8, 0x1f, 0xfe, 0xf5, 0x9f, 0xff, 0xd3, 0x7f, 0x6d,
+  0xff, 0xfa, 0xef, 0xff, 0xed, 0xbf, 0xfc, 0xcb, 0xd6, 0x5a, 0xff, 0xfa, 0xf7, 0xff, 0xf9, 0x3f,
+  0xfe, 0xd7, 0xbf, 0x7c, 0xfc, 0xdb, 0x77, 0x35, 0xfe, 0xb9, 0x6a, 0x67, 0xff, 0xae, 0xb6, 0x7f,
+  0xc3, 0x6f, 0xc3, 0xa7, 0xff, 0xae, 0xda, 0xff, 0xbd, 0x6a, 0xff, 0xef, 0xaa, 0x9f, 0xbc, 0x43,
+  0x94, 0xdf, 0x9a, 0xc7, 0xef, 0xb7, 0x6b, 0x96, 0xdf, 0xae, 0x98, 0xff, 0x5c, 0x35, 0xfa, 0xed,
+  0xf8, 0x5d, 0x5d, 0xeb, 0x3e, 0x83, 0xc7, 0xb0, 0xfa, 0x64, 0xff, 0xdc, 0x21, 0xc6, 0xfc, 0xfd,
+  0xdb, 0x3c, 0xe5, 0x79, 0x7b, 0x5e, 0xfd, 0xe7, 0x79, 0xfd, 0x9f, 0xab, 0xbb, 0xf7, 0x7f, 0xae,
+  0x76, 0xbb, 0xbf, 0x8d, 0xdd, 0xe3, 0xf7, 0x0c, 0x71, 0xef, 0x6b, 0xde, 0xce, 0x3f, 0x57, 0x9b,
+  0xdd, 0x3b, 0x7c, 0x17, 0x47, 0x7d, 0xb7, 0xdf, 0x7d, 0xcd, 0x7e, 0xcf, 0xbb, 0xcb, 0x55, 0xdf,
+  0xe7, 0xf7, 0x0c, 0x7b, 0x96, 0x6f, 0x66, 0xbe, 0xea, 0x7d, 0x7f, 0xcf, 0x30, 0xcf, 0xef, 0x19,
+  0x66, 0xf9, 0x37, 0x1b, 0xe7, 0xf7, 0xc6, 0xab, 0x7e, 0x9d, 0xc8, 0x6f, 0xb6, 0x7a, 0xf9, 0x3a,
+  0x6d, 0xfc, 0x9e, 0x6c, 0x8d, 0xfa, 0x64, 0xfd, 0x77, 0x87, 0xd1, 0xeb, 0x7d, 0xdb, 0x6f, 0x35,
+  0xc7, 0xac, 0x57, 0xfb, 0xef, 0x8d, 0x23, 0xca, 0x97, 0x5c, 0x78, 0x86, 0x72, 0xd5, 0x77, 0xfb,
+  0x3d, 0x43, 0xec, 0xfb, 0x64, 0x3e, 0x4f, 0x17, 0xcf, 0x70, 0xf2, 0x8d, 0xeb, 0x6a, 0xc6, 0x5e,
+  0xed, 0x77, 0x87, 0xba, 0x9a, 0xd1, 0x72, 0x85, 0xe2, 0xde, 0x21, 0x22, 0xbf, 0xfa, 0x28, 0xfb,
+  0xcc, 0xa6, 0xfd, 0xee, 0x60, 0xa7, 0x7c, 0x9d, 0xe1, 0xbd, 0x7e, 0xb3, 0xdf, 0x7d, 0xb7, 0x4f,
+  0xb1, 0x6e, 0xab, 0xe7, 0xba, 0xf5, 0xb2, 0x42, 0xdd, 0xfd, 0x7d, 0x5e, 0x9b, 0x73, 0xbe, 0x5f,
+  0x27, 0xac, 0x79, 0x7d, 0x86, 0xdf, 0xf3, 0xce, 0xdc, 0x7d, 0x56, 0xff, 0x6d, 0xae, 0xdf, 0x5b,
+  0xb4, 0xf2, 0x64, 0xb6, 0xf3, 0xb4, 0x0c, 0xaf, 0x5f, 0x32, 0x7e, 0xfb, 0x61, 0xaf, 0x72, 0x75,
+  0xc7, 0xef, 0x8d, 0x17, 0xed, 0x5f, 0xdb, 0xe2, 0x2d, 0xb0, 0xd7, 0xff, 0x59, 0xa1, 0x7c, 0xde,
+  0x5c, 0xa1, 0x28, 0xdf, 0x2c, 0x4e, 0xbe, 0xc5, 0x2e, 0xeb, 0xf6, 0xad, 0xd0, 0xef, 0xb7, 0x23,
+  0x68, 0xf7, 0xfd, 0xfe, 0xcd, 0xca, 0x8e, 0x8a, 0x93, 0x7b, 0x67, 0xd7, 0xbd, 0xd3, 0x66, 0xde,
+  0xe1, 0xd4, 0x33, 0xb4, 0xbc, 0xee, 0xa8, 0xdf, 0xd7, 0x89, 0xf1, 0x7b, 0x37, 0xaf, 0x67, 0x7e,
+  0x8d, 0x55, 0xff, 0xed, 0x77, 0xdf, 0xbd, 0xd7, 0xfb, 0x6f, 0xb1, 0x5a, 0x7b, 0xef, 0x7b, 0xaf,
+  0xd6, 0xf3, 0xf6, 0x3d, 0x03, 0x9d, 0x8b, 0xdf, 0x5a, 0x8c, 0x7c, 0xe3, 0x5d, 0x77, 0xd4, 0x1c,
+  0xbb, 0xae, 0x85, 0xfd, 0x39, 0x01, 0xbd, 0x95, 0x67, 0x88, 0xf6, 0x5b, 0xb7, 0xa8, 0x16, 0x31,
+  0xf2, 0x0e, 0xa3, 0x3e, 0xd9, 0xc9, 0x5d, 0xdd, 0x5b, 0xbd, 0x1a, 0x69, 0x1f, 0xbc, 0xdc, 0xa1,
+  0x05, 0xad, 0xdb, 0xef, 0x2d, 0xfe, 0x9c, 0xd8, 0xfc, 0xed, 0x99, 0xef, 0xf3, 0xda, 0xf2, 0x5d,
+  0x2d, 0xcc, 0xef, 0x5c, 0xac, 0x5c, 0x4d, 0xf7, 0x7a, 0xd5, 0xbc, 0xae, 0x45, 0xde, 0xd7, 0x7f,
+  0xcf, 0x7b, 0xbc, 0xee, 0xea, 0xd1, 0xeb, 0xde, 0xf9, 0x7d, 0xb3, 0xbe, 0xb7, 0xb0, 0xe0, 0x67,
+  0xff, 0xee, 0x1b, 0x65, 0xa7, 0x7e, 0x3e, 0x60, 0xbc, 0x6f, 0x11, 0x96, 0x2b, 0xef, 0xbb, 0x7c,
+  0x9d, 0x9e, 0x9e, 0x61, 0xb6, 0x7a, 0xdf, 0xdc, 0x67, 0xeb, 0xd4, 0xb5, 0x48, 0x0b, 0x63, 0xb3,
+  0x9e, 0x21, 0xa7, 0x95, 0xcf, 0xab, 0xfd, 0xf7, 0x0c, 0x7b, 0x57, 0x5b, 0x92, 0x7b, 0x67, 0x56,
+  0x1b, 0x75, 0x56, 0x54, 0x6b, 0x94, 0xfb, 0x37, 0xd7, 0xed, 0x9f, 0xbd, 0xfe, 0xfb, 0xea, 0x0d,
+  0xbe, 0xb0, 0xee, 0xf5, 0xb9, 0xf3, 0x2d, 0xea, 0xee, 0x3b, 0xdb, 0xea, 0x7d, 0x7f, 0x6f, 0xd1,
+  0xd6, 0xef, 0xb7, 0xad, 0xee, 0x9d, 0x9e, 0x67, 0xbe, 0xef, 0x6a, 0xcf, 0xe6, 0xef, 0xc9, 0x0e,
+  0x79, 0xc8, 0xf4, 0x9b, 0xa3, 0xd1, 0x5e, 0xdf, 0xef, 0xba, 0x79, 0x4f, 0xcf, 0x70, 0xea, 0x69,
+  0x31, 0x3c, 0x59, 0x5d, 0x8b, 0x99, 0x7e, 0x68, 0x3a, 0x9d, 0xac, 0xb4, 0xe0, 0xd5, 0x22, 0xda,
+  0x11, 0xeb, 0xf6, 0x3d, 0xd9, 0x78, 0x6d, 0xd4, 0xf7, 0xd3, 0xdf, 0x57, 0xef, 0xc5, 0x1a, 0x79,
+  0xf7, 0xa8, 0xab, 0x99, 0xb1, 0x46, 0x6f, 0x75, 0x9f, 0xe5, 0xf7, 0xed, 0x5e, 0xad, 0x7d, 0x9e,
+  0x00, 0xfb, 0xfd, 0x9b, 0x8d, 0xfa, 0xbc, 0x69, 0x11, 0x7b, 0x3d, 0x2d, 0x2d, 0x77, 0xb5, 0xd7,
+  0x77, 0xf3, 0x3c, 0x43, 0x56, 0xad, 0xdc, 0xce, 0xfd, 0x70, 0xca, 0x3e, 0xfb, 0xde, 0xc2, 0xaa,
+  0xe5, 0x4a, 0xbb, 0x6e, 0x51, 0xdf, 0x2d, 0xa3, 0xab, 0xbe, 0xea, 0xe9, 0xce, 0x77, 0xf3, 0xdf,
+  0xe9, 0x3e, 0xd5, 0xfe, 0xae, 0xfc, 0x3a, 0xdb, 0xea, 0xfe, 0x4d, 0x6b, 0xe4, 0x9d, 0x56, 0x88,
+  0xec, 0x6f, 0x7a, 0xf4, 0xb4, 0x9e, 0xb3, 0x7e, 0xf5, 0x48, 0x9f, 0x35, 0x6a, 0x0c, 0x33, 0xd2,
+  0x6f, 0xd2, 0x5b, 0x60, 0x3f, 0xcc, 0xba, 0x16, 0x91, 0x27, 0xab, 0x46, 0x78, 0x16, 0x7b, 0xd4,
+  0x28, 0xe8, 0xf7, 0xdb, 0x99, 0xd6, 0xbe, 0x75, 0xb2, 0x46, 0xa7, 0xc6, 0x04, 0xbf, 0xb7, 0x68,
+  0xb9, 0x27, 0x5b, 0xb5, 0x7d, 0x3b, 0x57, 0x9e, 0xe2, 0xd4, 0x95, 0x51, 0xdb, 0xae, 0x67, 0x68,
+  0x9c, 0xf6, 0xda, 0x3e, 0xf7, 0x26, 0x62, 0x4f, 0x5f, 0xbb, 0xd7, 0x33, 0x94, 0xbb, 0xaf, 0x89,
+  0x5d, 0xfd, 0x45, 0x4c, 0xbb, 0xee, 0xc9, 0xf4, 0x7a, 0x19, 0x81, 0x0c, 0xaf, 0xd1, 0x60, 0x9e,
+  0xf9, 0x35, 0xab, 0xb5, 0xcf, 0x1d, 0xd5, 0xab, 0x9f, 0x3f, 0xf9, 0x75, 0xac, 0x3e, 0xc3, 0xca,
+  0xb8, 0xa4, 0xae, 0xa6, 0x3b, 0xe2, 0xf5, 0x6a, 0xab, 0x23, 0xf7, 0xd9, 0x69, 0x6a, 0xaf, 0x57,
+  0xbb, 0xe3, 0xdf, 0x43, 0xfc, 0x9e, 0xa1, 0xae, 0x90, 0xe7, 0x9e, 0x6c, 0xbb, 0xc6, 0x51, 0x99,
+  0x07, 0x50, 0xa4, 0xdb, 0x3a, 0xd9, 0x9d, 0x96, 0xa7, 0x7b, 0xd5, 0x38, 0xf5, 0x77, 0xb5, 0xed,
+  0x26, 0x6c, 0xc9, 0xca, 0xaf, 0xd3, 0xeb, 0x6f, 0x47, 0x27, 0xfb, 0x9b, 0x71, 0x49, 0xc6, 0xd5,
+  0xd5, 0xae, 0x7f, 0x71, 0xdf, 0x16, 0x16, 0xa6, 0xc1, 0x46, 0x55, 0xfb, 0x3b, 0xe6, 0xa8, 0xdf,
+  0x21, 0x77, 0x35, 0xfc, 0x66, 0x8d, 0x74, 0x57, 0xc6, 0x7d, 0x3e, 0xab, 0x0f, 0xc8, 0x9d, 0x3a,
+  0xea, 0xca, 0xcf, 0x3c, 0x01, 0xf5, 0x3b, 0x78, 0x84, 0xd5, 0x33, 0x9f, 0x57, 0xb1, 0x53, 0xbd,
+  0xda, 0xbe, 0x73, 0xde, 0x6f, 0xf6, 0xd9, 0xea, 0x56, 0x4f, 0x77, 0x4b, 0x1b, 0xb5, 0xaa, 0xfd,
+  0xc5, 0xde, 0xd9, 0x35, 0x1f, 0xfa, 0xbd, 0x71, 0x5f, 0x53, 0x44, 0xa4, 0xdf, 0x11, 0xa8, 0xe7,
+  0x02, 0x7e, 0x33, 0xea, 0x5e, 0xff, 0xed, 0x07, 0xcb, 0x68, 0xbb, 0x66, 0x12, 0x81, 0xab, 0x8d,
+  0x22, 0x5d, 0x4b, 0x7f, 0x5c, 0x23, 0x85, 0x91, 0xd6, 0xc8, 0x06, 0x7d, 0x75, 0xb2, 0xd5, 0x91,
+  0x31, 0xb8, 0x55, 0x8f, 0x9e, 0xa7, 0x30, 0xe3, 0x87, 0x1e, 0x75, 0x47, 0x0d, 0xca, 0x45, 0xf0,
+  0x6f, 0xbb, 0x5a, 0x4f, 0xcb, 0xfb, 0xae, 0x37, 0x5e, 0xb7, 0x33, 0x32, 0x8a, 0xaf, 0xd6, 0x7e,
+  0xe6, 0x2e, 0x69, 0xd5, 0xda, 0x4f, 0xd8, 0xb3, 0x9a, 0x51, 0xb5, 0xcc, 0xdf, 0xe8, 0xeb, 0xe0,
+  0xfb, 0x46, 0x3d, 0xdd, 0x63, 0x47, 0xdd, 0xeb, 0xf0, 0x4e, 0x56, 0x9f, 0x2c, 0xa3, 0xa0, 0x8c,
+  0x95, 0xab, 0x3d, 0x33, 0xcb, 0x5c, 0xba, 0x51, 0x6c, 0x9f, 0x1e, 0xc7, 0xeb, 0xd7, 0x39, 0xf0,
+  0xf3, 0x14, 0x5d, 0xe5, 0xd7, 0x99, 0xb3, 0xda, 0x87, 0x8c, 0x61, 0xaa, 0xfd, 0xfd, 0xb2, 0x71,
+  0x8a, 0x48, 0xd3, 0xeb, 0x39, 0xad, 0x71, 0xfc, 0x59, 0xa1, 0x7a, 0x2e, 0xbe, 0x37, 0xde, 0xef,
+  0x0a, 0x7d, 0x7b, 0x27, 0xcf, 0x50, 0xdd, 0x0f, 0x27, 0xf3, 0xcd, 0x6a, 0x11, 0xe3, 0x4b, 0xa6,
+  0xdf, 0xdc, 0x29, 0x4e, 0xee, 0xb3, 0x20, 0xcb, 0xd5, 0xc8, 0x33, 0xe0, 0xb4, 0x8c, 0xba, 0x1f,
+  0xf0, 0x16, 0xb3, 0xbe, 0x5b, 0xfe, 0x76, 0x9e, 0x37, 0xaa, 0xf8, 0x22, 0x47, 0xca, 0xb0, 0x33,
+  0x0b, 0xcd, 0xdd, 0xc7, 0xb9, 0x13, 0x6c, 0xc9, 0xa1, 0x08, 0x6f, 0xbd, 0x99, 0xda, 0x67, 0x68,
+  0x57, 0x8d, 0xb9, 0xf0, 0xd5, 0x69, 0x47, 0x25, 0xae, 0xb1, 0x4e, 0xcd, 0x19, 0xf2, 0x8d, 0x33,
+  0x93, 0x98, 0xf5, 0x79, 0x67, 0xc6, 0xb4, 0xb3, 0x7a, 0x9c, 0x31, 0x4e, 0xf5, 0xc7, 0x89, 0x3f,
+  0xe4, 0x97, 0x64, 0x7b, 0x96, 0x56, 0x79, 0xd4, 0xfd, 0xdb, 0xd3, 0x2a, 0xd7, 0x1d, 0x65, 0x3d,
+  0xf7, 0xc3, 0xa9, 0xd6, 0xc8, 0x2c, 0xdf, 0xad, 0xd3, 0x7d, 0xed, 0x8d, 0x61, 0xc2, 0xf3, 0xc9,
+  0x08, 0x87, 0xb1, 0xbd, 0xdf, 0x75, 0xf3, 0x9d, 0x91, 0x6e, 0xab, 0x3e, 0x00, 0x3e, 0xb6, 0xfa,
+  0x80, 0x7b, 0x5a, 0xa2, 0x9e, 0x79, 0xcb, 0x75, 0x73, 0xc2, 0x09, 0x86, 0x42, 0xb4, 0x90, 0x17,
+  0x7a, 0xf5, 0x85, 0x40, 0xa9, 0x66, 0xcd, 0xa5, 0xe7, 0xa1, 0x33, 0x94, 0x36, 0x35, 0x7d, 0x40,
+  0x50, 0x94, 0x99, 0x67, 0xb3, 0x5b, 0x7d, 0x0b, 0x27, 0x44, 0xcb, 0xd2, 0x6f, 0xfa, 0x8b, 0x47,
+  0x7d, 0x5f, 0x47, 0x60, 0x20, 0x81, 0xfb, 0xd6, 0x4c, 0x2d, 0x2c, 0x6d, 0xaa, 0xd3, 0xde, 0x49,
+  0x4f, 0xd6, 0x4e, 0xf5, 0x4e, 0x88, 0x2a, 0x0e, 0xa1, 0x1d, 0xf1, 0x7e, 0x1d, 0x43, 0xbe, 0x79,
+  0x26, 0x3d, 0x59, 0x5a, 0xfb, 0x8a, 0x10, 0x6d, 0x8e, 0xc1, 0xd3, 0x46, 0x39, 0x21, 0x23, 0x69,
+  0x09, 0xda, 0xa8, 0x9e, 0x17, 0x3e, 0x36, 0xaa, 0x95, 0xcb, 0x48, 0x37, 0x11, 0x8c, 0xb3, 0xeb,
+  0x8e, 0x32, 0x71, 0x5a, 0xcc, 0x81, 0x39, 0xee, 0x7a, 0x5a, 0xd2, 0x2a, 0x8f, 0xfa, 0x0c, 0x8e,
+  0x78, 0x67, 0x53, 0x34, 0x68, 0x6f, 0x6e, 0xfa, 0x45, 0xf1, 0xa7, 0xfe, 0x36, 0xf7, 0x6f, 0x46,
+  0x62, 0xab, 0xae, 0x71, 0x73, 0x8a, 0xb9, 0x90, 0x4b, 0x53, 0x2c, 0x97, 0x6b, 0x91, 0xbe, 0xc5,
+  0x29, 0xb3, 0x74, 0x5a, 0xa1, 0xf6, 0x07, 0x27, 0x68, 0xf5, 0x0c, 0xed, 0xfc, 0x92, 0xb4, 0x16,
+  0x7d, 0x51, 0x2c, 0x97, 0xf1, 0x64, 0xfe, 0xdb, 0xa2, 0x68, 0xc5, 0x9a, 0xc0, 0xf0, 0x22, 0xd7,
+  0x6d, 0xb3, 0x8f, 0xf5, 0x37, 0x5e, 0x0f, 0x6f, 0xc2, 0x33, 0xc4, 0x02, 0xae, 0x7c, 0xe8, 0x0e,
+  0xfd, 0xc5, 0x82, 0xcc, 0x72, 0xe5, 0x69, 0x35, 0x67, 0x9e, 0xac, 0xb1, 0xaa, 0x67, 0xd8, 0xf3,
+  0x8d, 0x8d, 0x0c, 0x11, 0x9e, 0x55, 0x6f, 0xba, 0xe0, 0x63, 0x2b, 0x9a, 0x04, 0xb4, 0x99, 0xf1,
+  0xbe, 0xf4, 0x43, 0xcb, 0x09, 0xd3, 0x6d, 0x22, 0xdf, 0xec, 0x99, 0x85, 0x52, 0x76, 0xe0, 0x19,
+  0x5d, 0x35, 0x23, 0x2b, 0x77, 0x6a, 0x76, 0x90, 0x2b, 0x04, 0x1b, 0x55, 0x63, 0x7b, 0x78, 0x3d,
+  0xc2, 0x74, 0x03, 0x48, 0xd9, 0xaa, 0xd6, 0xbe, 0x0b, 0x0c, 0xda, 0xe1, 0xf5, 0x9c, 0x4e, 0x6c,
+  0x46, 0xd0, 0x67, 0x93, 0xc7, 0xd9, 0x22, 0xab, 0xc3, 0xba, 0x55, 0xcb, 0xe5, 0x73, 0x51, 0xd4,
+  0x66, 0x79, 0x36, 0xfb, 0xeb, 0x21, 0xad, 0xe5, 0x1b, 0xf7, 0x1a, 0x3f, 0xac, 0xb4, 0xf6, 0x15,
+  0x5b, 0x09, 0xa0, 0xf9, 0xab, 0xe6, 0x2d, 0x27, 0xaf, 0xd6, 0x38, 0x35, 0x36, 0x62, 0x44, 0xc6,
+  0x32, 0x7f, 0x2b, 0x74, 0x6a, 0x26, 0xfc, 0x1d, 0x7a, 0x91, 0x07, 0x9c, 0x8c, 0x1f, 0xc2, 0x29,
+  0xc7, 0xd9, 0x35, 0x63, 0x45, 0xcc, 0xd5, 0xea, 0xbb, 0xfd, 0x9e, 0xac, 0x23, 0x1a, 0xac, 0x77,
+  0xb8, 0x31, 0x38, 0xe5, 0x85, 0x69, 0x8d, 0x6a, 0x1e, 0x1b, 0x12, 0x15, 0x0e, 0x5f, 0xfe, 0x62,
+  0x20, 0x5f, 0x88, 0x48, 0x98, 0x63, 0x46, 0x62, 0xa8, 0x75, 0x90, 0x8d, 0x32, 0x42, 0xc7, 0x13,
+  0x3f, 0xc3, 0x39, 0xae, 0xfe, 0xe2, 0x20, 0xd2, 0xad, 0x88, 0xe1, 0xc6, 0x1b, 0xd7, 0xe8, 0x75,
+  0xab, 0xd3, 0xf2, 0x39, 0x74, 0x42, 0x17, 0x13, 0x19, 0xe9, 0x53, 0x21, 0xd3, 0x8c, 0xe4, 0x24,
+  0x8a, 0x9d, 0x51, 0x71, 0x45, 0x4e, 0xad, 0x19, 0xe5, 0xdd, 0xb9, 0xd7, 0x61, 0x95, 0xab, 0x85,
+  0x89, 0xb4, 0x04, 0x84, 0x23, 0x22, 0x26, 0x38, 0x75, 0xe5, 0x3d, 0x77, 0xd4, 0xae, 0x59, 0x87,
+  0x1f, 0xf2, 0x90, 0xe9, 0x8f, 0x11, 0x9f, 0x11, 0x2a, 0x91, 0x7b, 0x9d, 0x7c, 0x16, 0x32, 0xb5,
+  0x5e, 0x2b, 0x36, 0x73, 0xaf, 0x77, 0x97, 0x58, 0xcf, 0xd8, 0x73, 0x54, 0x8f, 0x3e, 0x12, 0x23,
+  0x9d, 0x64, 0xed, 0x67, 0x7b, 0xb1, 0xcc, 0x40, 0x04, 0x3d, 0xab, 0x35, 0x8a, 0xb4, 0xbf, 0x93,
+  0x22, 0xb1, 0x15, 0x2f, 0x6a, 0xf9, 0xc5, 0x88, 0xfb, 0x8d, 0xfb, 0x3e, 0x5b, 0x62, 0x35, 0x87,
+  0xcc, 0xfd, 0xb0, 0xc6, 0x9b, 0xc7, 0x46, 0x5f, 0xa2, 0x2e, 0xe2, 0x9e, 0x3b, 0xea, 0xd4, 0x15,
+  0xda, 0xa1, 0x62, 0x2e, 0x44, 0xd0, 0x6b, 0x57, 0xdc, 0x28, 0xc8, 0x07, 0xa4, 0x9d, 0x64, 0x64,
+  0x24, 0x6b, 0x8b, 0x6c, 0x27, 0xd3, 0xda, 0x8f, 0x25, 0xac, 0xf2, 0x64, 0x74, 0xfc, 0xf7, 0xbc,
+  0x96, 0x39, 0x43, 0x67, 0x8c, 0x69, 0x57, 0x04, 0xa3, 0xfd, 0x41, 0x38, 0x4f, 0xad, 0x1d, 0x20,
+  0x0a, 0xa2, 0x3a, 0xc3, 0xcc, 0xe7, 0xf5, 0xea, 0x37, 0x4f, 0x62, 0x8e, 0xa3, 0xda, 0xd4, 0xb5,
+  0x28, 0x5a, 0x49, 0xab, 0x7c, 0xfc, 0x8d, 0xa0, 0x3f, 0x5b, 0xdd, 0x55, 0x85, 0x14, 0x35, 0xcb,
+  0xfa, 0x75, 0x9a, 0x89, 0x2c, 0xff, 0x3b, 0x59, 0xbd, 0x46, 0x2b, 0x89, 0x3c, 0x4d, 0x91, 0xfb,
+  0x5f, 0xac, 0x78, 0x53, 0xec, 0x99, 0xf6, 0xb7, 0xa2, 0xc2, 0xd7, 0x96, 0x50, 0x55, 0xc3, 0xb2,
+  0xce, 0x30, 0x28, 0x9f, 0x3f, 0xf6, 0xd6, 0x9a, 0x1d, 0x7b, 0xd2, 0x6a, 0xdc, 0xe7, 0x46, 0xb6,
+  0x3a, 0xb1, 0x4c, 0x44, 0x20, 0x5c, 0xc3, 0xa6, 0xba, 0x1e, 0xea, 0x0c, 0x43, 0x20, 0x5a, 0x23,
+  0x2b, 0xdb, 0x7b, 0x51, 0x4e, 0xd6, 0xdf, 0x8c, 0xca, 0x81, 0x5a, 0xd6, 0x7c, 0xfe, 0xb3, 0x3b,
+  0x56, 0xaf, 0x26, 0xd2, 0x80, 0x3a, 0x2f, 0xd7, 0x2c, 0x4d, 0x21, 0x23, 0x99, 0xeb, 0xd5, 0xa8,
+  0x2d, 0x50, 0x4d, 0xdd, 0xd5, 0x43, 0xa2, 0x6a, 0x4f, 0x79, 0xd6, 0xc5, 0xf0, 0x6a, 0x24, 0x36,
+  0xfa, 0x10, 0xb5, 0x5b, 0x44, 0xaf, 0xb3, 0xfa, 0xa1, 0x86, 0x4a, 0x66, 0xfd, 0xb7, 0x91, 0x71,
+  0x35, 0xe1, 0x0f, 0xc0, 0x53, 0x6b, 0xfc, 0x1b, 0xab, 0x75, 0xe1, 0xd1, 0x77, 0xda, 0x12, 0xaa,
+  0x33, 0x6c, 0xd8, 0xc9, 0xea, 0x21, 0x81, 0x91, 0xd6, 0xbd, 0x63, 0xb0, 0xca, 0xab, 0x5e, 0x1d,
+  0x19, 0x55, 0x50, 0x65, 0xa5, 0x71, 0xb5, 0x04, 0xef, 0xd6, 0x5f, 0x74, 0x26, 0x56, 0x66, 0xa1,
+  0xf5, 0x0c, 0x7d, 0xd9, 0xa2, 0xc0, 0x1f, 0xbe, 0x78, 0xfd, 0x54, 0x5c, 0x0e, 0x95, 0xc1, 0x55,
+  0x51, 0xc0, 0x5c, 0x8b, 0x3c, 0x59, 0x15, 0x49, 0xff, 0xae, 0x46, 0xdd, 0xa9, 0xf6, 0x07, 0xb3,
+  0xa1, 0x8a, 0xcd, 0xc9, 0x48, 0xb7, 0xe2, 0x0f, 0x5f, 0x44, 0x3a, 0xeb, 0x37, 0xcb, 0x08, 0x7a,
+  0xfb, 0x1b, 0x6b, 0x7c, 0xb6, 0x7a, 0x8b, 0xb8, 0xef, 0x2c, 0x81, 0x08, 0x7c, 0x21, 0xad, 0x55,
+  0xe4, 0x34, 0x7d, 0x77, 0xda, 0xb3, 0x7a, 0x5a, 0xee, 0x57, 0xaf, 0x75, 0xff, 0x40, 0xbc, 0x53,
+  0xed, 0x59, 0x60, 0x8d, 0x57, 0x8d, 0x4b, 0xe6, 0x19, 0xa2, 0xca, 0x15, 0x73, 0x88, 0x4a, 0xd0,
+  0x49, 0xcf, 0xcb, 0x1c, 0x81, 0x44, 0xbf, 0x1a, 0x45, 0x99, 0x99, 0x6f, 0x46, 0x7d, 0xb7, 0x38,
+  0x02, 0x29, 0xfb, 0xd6, 0xc2, 0x45, 0x94, 0x39, 0x17, 0xed, 0x28, 0x44, 0x6d, 0x56, 0xf1, 0x87,
+  0xac, 0x93, 0xe5, 0x7d, 0x6b, 0x1e, 0xf0, 0xe5, 0x6f, 0x02, 0x69, 0xf8, 0x96, 0x6d, 0xbd, 0x38,
+  0x6d, 0xc1, 0xcf, 0x8c, 0xb2, 0x99, 0x2e, 0x7c, 0xa1, 0x01, 0x15, 0xae, 0x9c, 0x1c, 0xe4, 0x43,
+  0x35, 0x87, 0xbc, 0xd1, 0x76, 0xdd, 0xd5, 0x5f, 0x72, 0xdb, 0x04, 0x2e, 0x07, 0x0e, 0x06, 0xed,
+  0x75, 0x54, 0xf8, 0xe9, 0x1c, 0xa3, 0x96, 0x1f, 0xe4, 0x21, 0xf3, 0xc9, 0x76, 0xe5, 0xad, 0x20,
+  0xa6, 0xad, 0x79, 0x80, 0x03, 0x6d, 0x26, 0xa4, 0x17, 0xc8, 0x69, 0xab, 0xfb, 0x37, 0xd2, 0x72,
+  0x71, 0x45, 0x21, 0xd7, 0xad, 0x72, 0x04, 0x2e, 0x8a, 0xcd, 0x19, 0x55, 0x5a, 0xc4, 0x1a, 0xff,
+  0x7e, 0x0b, 0x34, 0x45, 0xdc, 0x37, 0x81, 0x4f, 0x06, 0x31, 0x54, 0x08, 0x79, 0xca, 0x88, 0x3f,
+  0x4c, 0xd4, 0x19, 0xc0, 0x50, 0x61, 0x7f, 0xbc, 0x45, 0x5d, 0x2f, 0x36, 0xac, 0x5c, 0xf5, 0x38,
+  0xd1, 0x43, 0x44, 0x4c, 0x2d, 0xe8, 0x04, 0xd8, 0x1f, 0xe6, 0xd6, 0xa2, 0xd3, 0x9d, 0xf6, 0x81,
+  0x72, 0x06, 0x1f, 0x84, 0x20, 0xb7, 0x3f, 0xbc, 0x8a, 0x8a, 0xe6, 0xc7, 0x9a, 0xb4, 0x77, 0xd2,
+  0x07, 0x2c, 0x81, 0x68, 0xf9, 0x8d, 0x35, 0xaa, 0x2f, 0x44, 0x55, 0xa3, 0x62, 0xf1, 0x7e, 0x90,
+  0x1f, 0x57, 0xb4, 0x0e, 0xdc, 0x83, 0x4d, 0x55, 0x39, 0xd4, 0xc9, 0xea, 0x7e, 0xe8, 0x60, 0xc9,
+  0x54, 0x4c, 0x17, 0x91, 0xae, 0x13, 0xc6, 0x94, 0x99, 0xc4, 0xa6, 0x33, 0x04, 0x44, 0xab, 0xc6,
+  0xe0, 0x81, 0x1a, 0x15, 0xed, 0x5f, 0x30, 0x49, 0x6a, 0x65, 0xbb, 0xe5, 0xb9, 0x20, 0xa6, 0x59,
+  0x33, 0xc5, 0x1c, 0x18, 0xd6, 0x5e, 0xcf, 0xfb, 0x19, 0xae, 0xf1, 0x22, 0x44, 0xee, 0xb9, 0xa3,
+  0x36, 0xed, 0x28, 0x54, 0x48, 0x6b, 0x0c, 0x73, 0x99, 0x50, 0x15, 0x2f, 0x01, 0x53, 0x27, 0x28,
+  0x5b, 0xcc, 0x6f, 0xd6, 0x6a, 0x5c, 0xd2, 0x73, 0xaf, 0xd7, 0x1c, 0xd2, 0x46, 0x5a, 0xf0, 0x1a,
+  0xff, 0x7e, 0x47, 0x73, 0xd5, 0xf8, 0x17, 0xcc, 0x97, 0xf1, 0xf2, 0x61, 0x1c, 0xb9, 0x7f, 0xad,
+  0x2d, 0x06, 0xde, 0x82, 0x38, 0x65, 0x2b, 0x54, 0xbc, 0x6e, 0x5d, 0x45, 0xba, 0xd1, 0x55, 0x6d,
+  0xbc, 0xa1, 0x3e, 0x4f, 0xd9, 0x6d, 0xc6, 0x9e, 0x64, 0xa3, 0x3a, 0xd0, 0x45, 0xb2, 0x9e, 0xc8,
+  0xbb, 0x8d, 0xd6, 0x6d, 0x88, 0xba, 0x3f, 0x2a, 0x99, 0x87, 0xee, 0x90, 0xb1, 0x06, 0x21, 0x4f,
+  0xb0, 0x88, 0x84, 0x8c, 0x74, 0x46, 0x4e, 0x33, 0x86, 0x09, 0x62, 0x42, 0x25, 0xc2, 0x99, 0x39,
+  0x7a, 0xfd, 0x3a, 0x01, 0x4e, 0x0e, 0x61, 0x2b, 0xb7, 0x2a, 0x57, 0x77, 0xea, 0x42, 0x2d, 0xbf,
+  0x9e, 0x8b, 0x48, 0x4b, 0xeb, 0x94, 0x6f, 0x82, 0xaf, 0xb1, 0x08, 0x11, 0xd8, 0x35, 0xca, 0x44,
+  0xac, 0x2c, 0x70, 0xda, 0x2f, 0xfc, 0x25, 0xfc, 0x21, 0xb3, 0x8e, 0xe6, 0x6f, 0x2d, 0xf4, 0x0b,
+  0xc1, 0x7b, 0x3d, 0x2d, 0x60, 0x8c, 0xae, 0x6a, 0x4b, 0x12, 0x53, 0xc8, 0x7c, 0xb3, 0xd6, 0xf2,
+  0xbf, 0x50, 0x99, 0xd8, 0x79, 0xd8, 0x25, 0x84, 0x2e, 0x82, 0x55, 0xb9, 0x2a, 0x76, 0x65, 0x7f,
+  0x6a, 0x5f, 0xbd, 0xe6, 0xf3, 0x33, 0xf3, 0xee, 0x4e, 0x88, 0x37, 0xd8, 0x84, 0x93, 0x72, 0xf4,
+  0x55, 0xa3, 0x8a, 0xfc, 0x0e, 0xa8, 0x09, 0xd3, 0xba, 0x25, 0x06, 0x72, 0x4c, 0x45, 0xe6, 0x87,
+  0x70, 0xf0, 0xd8, 0x82, 0xa1, 0x02, 0x6c, 0x70, 0xd5, 0x4c, 0xc2, 0xd3, 0x5f, 0x54, 0xfb, 0x6b,
+  0x3d, 0xff, 0x8d, 0x18, 0x77, 0x88, 0xc4, 0x08, 0x7b, 0x45, 0x1d, 0xdd, 0x08, 0x73, 0x04, 0xc3,
+  0x6a, 0x11, 0xde, 0xb7, 0xdf, 0x8a, 0x4d, 0x00, 0x1d, 0x27, 0x64, 0x24, 0x10, 0x89, 0xd5, 0x2f,
+  0x09, 0xac, 0x62, 0x50, 0x84, 0x07, 0x5b, 0xe2, 0x0a, 0x97, 0xa3, 0x5a, 0xdd, 0xc4, 0xae, 0x66,
+  0x74, 0x26, 0xcf, 0x66, 0xc5, 0xab, 0x51, 0xa9, 0xe8, 0x35, 0xf3, 0x41, 0x76, 0xdb, 0x89, 0xa7,
+  0x0b, 0xcf, 0x4b, 0x5c, 0xb5, 0xf4, 0x9b, 0x5c, 0xc7, 0xe1, 0x4c, 0x22, 0xf1, 0x07, 0x8f, 0xf7,
+  0xb4, 0xdc, 0xfc, 0x82, 0x18, 0x61, 0xa8, 0x49, 0x50, 0xad, 0xf9, 0x24, 0xaf, 0x98, 0xcf, 0xc5,
+  0x5c, 0x6f, 0xf6, 0x65, 0x33, 0xf9, 0x04, 0x4e, 0x55, 0x7b, 0xc4, 0x3b, 0x64, 0xcf, 0xe6, 0x78,
+  0x31, 0x85, 0x08, 0x85, 0x70, 0x7e, 0x87, 0xd0, 0x05, 0x03, 0xe8, 0xe4, 0x4e, 0xad, 0x0c, 0xe2,
+  0x98, 0x33, 0xc4, 0x9e, 0x5c, 0x1c, 0x5d, 0xe5, 0xd9, 0xc4, 0x19, 0xaa, 0x88, 0xd6, 0x00, 0x7e,
+  0x66, 0x94, 0x8b, 0xf4, 0x1a, 0xf7, 0x21, 0xeb, 0x98, 0x2f, 0x83, 0xf8, 0xf3, 0x38, 0x51, 0x11,
+  0x81, 0xac, 0x5f, 0x20, 0xb3, 0x6c, 0xc4, 0x1c, 0x20, 0x5e, 0x66, 0xfa, 0xb7, 0x49, 0x91, 0x58,
+  0xc6, 0x7d, 0xec, 0x03, 0x32, 0x52, 0x68, 0xe7, 0xf5, 0x2d, 0x7e, 0x2b, 0xe6, 0xc4, 0x49, 0x3f,
+  0xfd, 0x8d, 0x09, 0x7c, 0xe7, 0xd5, 0x43, 0x1c, 0xd9, 0x3c, 0xdd, 0xc4, 0xdc, 0x6a, 0xe3, 0xa8,
+  0x4a, 0x05, 0xe2, 0xa8, 0x1a, 0x3f, 0x44, 0xbe, 0x05, 0x61, 0x4c, 0x60, 0x08, 0x92, 0x0f, 0x00,
+  0x06, 0x4d, 0x98, 0xf9, 0x6a, 0xf3, 0x45, 0x90, 0xbf, 0x8f, 0x73, 0x84, 0xb5, 0x47, 0x36, 0x5e,
+  0xfd, 0xa6, 0x1b, 0xf8, 0xbf, 0x83, 0x6c, 0x75, 0xd4, 0x3b, 0xe4, 0xae, 0x6e, 0xc4, 0x66, 0x41,
+  0xe4, 0x38, 0x45, 0xa6, 0x06, 0x7e, 0x5f, 0xf5, 0xc7, 0x9f, 0xdd, 0x89, 0x97, 0x99, 0x11, 0x3d,
+  0x2b, 0xd0, 0x4e, 0x11, 0x69, 0x17, 0x48, 0x4e, 0x2c, 0x13, 0x71, 0xdf, 0x17, 0x65, 0xae, 0xd7,
+  0x8b, 0xf8, 0x1e, 0xe7, 0x45, 0x0f, 0xae, 0x1f, 0xaa, 0x91, 0x8d, 0xd9, 0xa1, 0xc8, 0x3c, 0x3d,
+  0x43, 0xeb, 0x2f, 0x5b, 0xc8, 0x50, 0xed, 0x9b, 0x64, 0x7f, 0xcf, 0x16, 0xd5, 0x12, 0x64, 0xb7,
+  0xc4, 0x3a, 0xd9, 0x79, 0x8e, 0xb9, 0x47, 0x21, 0xad, 0x27, 0xb1, 0x14, 0xc1, 0x76, 0xa3, 0x0c,
+  0x25, 0x12, 0x13, 0xab, 0x27, 0xc0, 0x3b, 0xd8, 0xa5, 0x15, 0x6b, 0x43, 0x9c, 0x1a, 0xc4, 0x0a,
+  0x4e, 0x1f, 0x70, 0x08, 0x6b, 0x4b, 0xa4, 0x77, 0x52, 0x94, 0x09, 0x1f, 0x5b, 0x73, 0x69, 0x78,
+  0xbd, 0x63, 0xc4, 0x16, 0x0a, 0xe1, 0x0b, 0x67, 0x17, 0xa8, 0xb0, 0x01, 0x63, 0x62, 0x2f, 0x6d,
+  0xc4, 0x3f, 0xfb, 0xcb, 0xb3, 0xa9, 0xa7, 0xc5, 0xf1, 0xcd, 0x6a, 0x2c, 0xf7, 0x9d, 0x21, 0x55,
+  0xa3, 0x82, 0xdf, 0x1c, 0xae, 0x98, 0x0e, 0x95, 0xb9, 0xe5, 0xcd, 0x43, 0x9c, 0xa1, 0x86, 0xfe,
+  0x00, 0x66, 0xc6, 0x09, 0x64, 0xc4, 0x81, 0x18, 0x12, 0x86, 0x17, 0xcc, 0x9a, 0x42, 0x15, 0xe6,
+  0x08, 0x16, 0xdd, 0x65, 0x47, 0xd3, 0xba, 0xa1, 0x62, 0xb3, 0x09, 0x3d, 0x68, 0x82, 0xef, 0x79,
+  0xb0, 0xfb, 0x9a, 0xe2, 0xb8, 0x50, 0xcf, 0xca, 0x66, 0x76, 0x1e, 0xd0, 0xf1, 0x25, 0xf0, 0x28,
+  0xec, 0xc9, 0x7d, 0x68, 0x97, 0x6c, 0xc1, 0xfd, 0xea, 0xb9, 0x53, 0xa9, 0x42, 0x0a, 0x0c, 0xa4,
+  0xa2, 0xb7, 0x37, 0x22, 0xad, 0xbf, 0x8d, 0xce, 0xf5, 0xee, 0xe4, 0x05, 0x1d, 0xc1, 0x0b, 0xf2,
+  0xe9, 0x5d, 0xe0, 0x0f, 0x0b, 0x6c, 0x4d, 0xea, 0x30, 0x40, 0xcd, 0xbd, 0x22, 0xe9, 0x97, 0xdd,
+  0xe4, 0x14, 0x81, 0x4c, 0xc1, 0x7f, 0x88, 0xb5, 0x5f, 0xe4, 0xe9, 0x73, 0xd2, 0x26, 0xaa, 0x67,
+  0x0b, 0xec, 0x85, 0x4d, 0x95, 0xab, 0x55, 0xbf, 0x03, 0xf2, 0xa1, 0x5e, 0xf9, 0xbf, 0xfe, 0xe7,
+  0x0e, 0xf5, 0xab, 0x7b, 0x07, 0x07, 0x99, 0x2a, 0xc5, 0x16, 0x22, 0xa6, 0x05, 0x67, 0x84, 0xb2,
+  0x19, 0xd8, 0xdf, 0x7a, 0xde, 0xbe, 0x3c, 0x76, 0x09, 0xfe, 0xc3, 0x70, 0xea, 0x09, 0xca, 0xaf,
+  0xd3, 0xec, 0xc5, 0x1f, 0xcc, 0x86, 0x38, 0x6f, 0x5f, 0x6e, 0x4a, 0xf8, 0x03, 0x3a, 0x6f, 0x54,
+  0xbe, 0x09, 0x2c, 0x68, 0x53, 0x5f, 0x92, 0x51, 0xe6, 0xd3, 0xfe, 0xe6, 0xa6, 0x8b, 0x30, 0xe8,
+  0xf6, 0x7a, 0x11, 0x9b, 0xf9, 0xc6, 0x41, 0x48, 0xce, 0xd8, 0x2a, 0x1f, 0xca, 0xba, 0x69, 0xad,
+  0xda, 0x7f, 0x79, 0xb7, 0xaa, 0x9e, 0xa1, 0x03, 0x89, 0x7e, 0x6b, 0x79, 0xba, 0xe9, 0xb4, 0xc0,
+  0xf6, 0x11, 0xff, 0x0c, 0xeb, 0x46, 0x15, 0x85, 0x8b, 0x65, 0x6e, 0xf5, 0x6f, 0x95, 0x51, 0xf3,
+  0xed, 0x9d, 0x10, 0x1e, 0x1d, 0xcc, 0x43, 0xaa, 0xae, 0x0f, 0x33, 0x81, 0xff, 0x9e, 0x50, 0x55,
+  0xae, 0x8b, 0x15, 0x13, 0xd7, 0x1d, 0x3d, 0x78, 0x75, 0xff, 0x02, 0x33, 0xa7, 0x4c, 0x18, 0x8c,
+  0x5c, 0xc2, 0xa0, 0x57, 0x9e, 0x80, 0x8a, 0xcb, 0xf9, 0xca, 0x4a, 0x50, 0xb5, 0xbf, 0xf7, 0x8d,
+  0x2b, 0x56, 0xfc, 0x45, 0x15, 0x2e, 0x50, 0xc0, 0xb3, 0x86, 0x88, 0xb9, 0x1c, 0xbc, 0xab, 0x43,
+  0x2c, 0x8e, 0x78, 0x2b, 0x62, 0xdf, 0x7e, 0xe8, 0xca, 0x72, 0x65, 0x05, 0xaf, 0x7e, 0xf5, 0xcb,
+  0x50, 0x39, 0xf5, 0x0c, 0x75, 0x66, 0xbe, 0xa4, 0x5d, 0xcf, 0x0c, 0xa5, 0x22, 0x9c, 0x86, 0x2a,
+  0x38, 0xe3, 0xa9, 0x79, 0xde, 0x88, 0x93, 0x03, 0xb6, 0x31, 0x71, 0x04, 0xe0, 0xdf, 0x88, 0xa5,
+  0xd8, 0x8d, 0xbc, 0x48, 0xfa, 0x58, 0xb7, 0x97, 0x59, 0xff, 0xc5, 0xa9, 0x22, 0xc2, 0xb3, 0x66,
+  0xaa, 0x8e, 0x83, 0xac, 0x83, 0x50, 0x09, 0x30, 0x6a, 0xce, 0x26, 0x26, 0x89, 0xbf, 0x18, 0xa9,
+  0x3b, 0x6a, 0x80, 0xd4, 0x77, 0x70, 0x04, 0x5f, 0xf9, 0xcb, 0x19, 0x96, 0xe0, 0x02, 0x0e, 0xb0,
+  0x43, 0x36, 0x59, 0x18, 0x7f, 0xed, 0xba, 0x81, 0x45, 0x37, 0xc8, 0xda, 0x67, 0xad, 0x8e, 0xd8,
+  0xfd, 0x13, 0xde, 0xb4, 0x5a, 0x82, 0xd1, 0xe6, 0x9b, 0x1d, 0x98, 0x31, 0x2f, 0x3e, 0x6d, 0x49,
+  0xc6, 0xd5, 0xb5, 0xa7, 0xc2, 0xb0, 0x27, 0x6b, 0x86, 0x1d, 0x81, 0xc8, 0xbc, 0x56, 0x35, 0xd6,
+  0x52, 0x6c, 0x16, 0xd4, 0x03, 0xa8, 0xee, 0xef, 0xb0, 0xb4, 0x84, 0xf1, 0x4f, 0xd5, 0x09, 0x7b,
+  0x2b, 0x41, 0x51, 0xb3, 0x3a, 0x53, 0x3d, 0x4c, 0xa8, 0xcf, 0x53, 0xff, 0x1b, 0x18, 0x98, 0x84,
+  0x1e, 0x5c, 0x66, 0x32, 0x75, 0xe6, 0x4d, 0xd1, 0x97, 0x74, 0xbb, 0xed, 0xa8, 0xa2, 0x3b, 0x6d,
+  0x8a, 0x2a, 0xed, 0x41, 0xdf, 0x4c, 0xbd, 0xef, 0xc9, 0xdc, 0xb4, 0x76, 0x7b, 0x7c, 0x11, 0xa9,
+  0xa8, 0xd5, 0xf9, 0x1c, 0xf6, 0xd6, 0x0e, 0x0c, 0x9d, 0x42, 0xe4, 0x4d, 0x03, 0x3d, 0x2b, 0x35,
+  0x22, 0x05, 0x5e, 0x52, 0x71, 0xda, 0x00, 0xf6, 0xda, 0x98, 0xb7, 0xb2, 0x44, 0xb6, 0x08, 0xab,
+  0x41, 0xa7, 0x7b, 0x75, 0xd1, 0xe3, 0x18, 0xe8, 0x74, 0xeb, 0xd4, 0x3b, 0x69, 0xa1, 0xb8, 0xe3,
+  0x59, 0xe1, 0xa7, 0x8c, 0xd5, 0xb7, 0xc0, 0x74, 0x0d, 0xfd, 0x7a, 0xdc, 0xfb, 0x90, 0xc8, 0xd3,
+  0x1f, 0x4e, 0x6f, 0x13, 0x58, 0x3c, 0xba, 0x92, 0x4f, 0x57, 0x19, 0x2b, 0xd5, 0x71, 0x36, 0xf3,
+  0x95, 0x33, 0x9f, 0x47, 0x1c, 0x55, 0xbf, 0x3a, 0x72, 0x27, 0xab, 0x55, 0x70, 0x60, 0x4c, 0x35,
+  0xe6, 0xb2, 0x86, 0x58, 0x99, 0xd8, 0x21, 0x8b, 0x3c, 0x43, 0x7a, 0x5e, 0xee, 0x98, 0x42, 0x7d,
+  0x93, 0x70, 0xe5, 0x44, 0x72, 0x42, 0xc4, 0x93, 0x01, 0x2b, 0xb7, 0xa9, 0xc7, 0x91, 0xad, 0x51,
+  0x66, 0xd8, 0xcc, 0x92, 0x49, 0xc4, 0x65, 0x37, 0xd5, 0x67, 0x99, 0x3e, 0x96, 0xa2, 0x6d, 0x54,
+  0x56, 0x88, 0x61, 0x85, 0xee, 0xd6, 0xda, 0xa3, 0xfb, 0xe5, 0x01, 0x47, 0x71, 0x4e, 0x77, 0x7f,
+  0xb3, 0x83, 0x2f, 0x26, 0xa0, 0x33, 0x9f, 0x28, 0xf6, 0x18, 0x02, 0xb7, 0x1f, 0xd3, 0xde, 0xb5,
+  0xf0, 0xc0, 0x1d, 0xa8, 0x12, 0xd4, 0xfa, 0x5b, 0x9d, 0xfc, 0xbc, 0xbf, 0x40, 0x9b, 0x2f, 0xbe,
+  0x43, 0xf8, 0x2f, 0xec, 0x0e, 0xf5, 0x88, 0x81, 0x0d, 0x4b, 0x3d, 0x15, 0xa8, 0x6f, 0x52, 0xc5,
+  0x1c, 0xb8, 0xbd, 0x73, 0xff, 0xd0, 0x79, 0x2b, 0xd0, 0x5f, 0x58, 0x62, 0x82, 0x7b, 0x0b, 0xf4,
+  0xe0, 0x4f, 0xaf, 0x5c, 0xa8, 0xdc, 0x34, 0x33, 0x89, 0x8a, 0x94, 0xf9, 0x06, 0x6b, 0x8a, 0xba,
+  0xea, 0x57, 0xbc, 0x2c, 0x83, 0xcf, 0x3e, 0xf4, 0xea, 0x9d, 0xfe, 0x32, 0x51, 0x89, 0xad, 0x69,
+  0x69, 0x09, 0x6a, 0xb5, 0x24, 0xd0, 0x99, 0xb7, 0x89, 0x4f, 0x7b, 0xd6, 0xbb, 0x6e, 0x9f, 0xb5,
+  0x17, 0x1c, 0x81, 0xbf, 0x1d, 0x74, 0xf6, 0x07, 0x1b, 0xdc, 0x35, 0x6f, 0x81, 0x87, 0x34, 0x8a,
+  0xb6, 0x51, 0xe1, 0xa7, 0xdc, 0x14, 0xfd, 0x17, 0x87, 0xd8, 0x37, 0x74, 0x8e, 0xff, 0x32, 0xd5,
+  0x6d, 0x50, 0x57, 0x67, 0xbc, 0x2b, 0x14, 0x88, 0xa3, 0xa8, 0xaa, 0x01, 0x74, 0x66, 0x52, 0x87,
+  0x41, 0x17, 0x3d, 0x20, 0x37, 0x82, 0xa6, 0xa8, 0x18, 0xd5, 0x54, 0xea, 0x3f, 0x9e, 0x4b, 0x74,
+  0x4f, 0x7c, 0x71, 0x89, 0x0b, 0x7b, 0xe6, 0xe8, 0x8c, 0x26, 0xb6, 0x71, 0x5b, 0x2f, 0x47, 0xeb,
+  0x5b, 0xf8, 0xae, 0xd8, 0x21, 0x19, 0x9f, 0x11, 0x8a, 0x32, 0x50, 0x7d, 0x20, 0xfc, 0x2c, 0xa3,
+  0x41, 0xea, 0x0c, 0xb9, 0x9d, 0xdc, 0xb4, 0x53, 0xb7, 0xc8, 0x66, 0x0c, 0x19, 0x6b, 0x90, 0xed,
+  0x43, 0x8d, 0x8a, 0x2a, 0x15, 0x66, 0xa2, 0xdf, 0x14, 0x56, 0xb9, 0x32, 0x3b, 0x3f, 0xef, 0x7f,
+  0x5e, 0x9f, 0x65, 0x13, 0xfe, 0x82, 0x56, 0x1e, 0xa8, 0xb0, 0x93, 0x55, 0xd6, 0x7d, 0x8b, 0x82,
+  0xc5, 0xfc, 0x85, 0xca, 0xf3, 0xad, 0xc4, 0xdf, 0xcc, 0xd2, 0x08, 0x87, 0x81, 0xbf, 0x20, 0x5e,
+  0x71, 0x66, 0xcd, 0x46, 0xef, 0x96, 0x6b, 0x41, 0x1d, 0x7f, 0xb0, 0x93, 0x8d, 0xce, 0x31, 0xa2,
+  0x36, 0xee, 0x0e, 0x1c, 0xc2, 0xf3, 0x9e, 0x8c, 0x69, 0xa9, 0xe6, 0x03, 0xc6, 0x52, 0xed, 0x35,
+  0x32, 0xf4, 0x8d, 0x13, 0xcb, 0x0b, 0x3d, 0x2b, 0xc4, 0x45, 0xd9, 0x38, 0xdd, 0xc4, 0x3c, 0x44,
+  0x36, 0x53, 0x23, 0xc7, 0x8d, 0x33, 0x4f, 0x0c, 0x6d, 0xec, 0x33, 0xb2, 0xbf, 0x2e, 0x2a, 0x78,
+  0x1e, 0x4b, 0x76, 0x78, 0x4d, 0xd1, 0x29, 0x74, 0x19, 0x61, 0x93, 0xf6, 0x03, 0x38, 0x23, 0x35,
+  0x86, 0x81, 0x3e, 0x0c, 0x21, 0xd3, 0x93, 0xbb, 0x19, 0xe1, 0x03, 0xda, 0xcb, 0xa5, 0x32, 0x60,
+  0xc5, 0x41, 0xf5, 0x58, 0xf0, 0x82, 0xea, 0x2e, 0x81, 0x12, 0x0c, 0x75, 0x8b, 0x82, 0x05, 0x5a,
+  0x51, 0x94, 0x8b, 0x26, 0xd5, 0xa8, 0xed, 0xea, 0xce, 0x50, 0xcd, 0x12, 0xc8, 0x3f, 0xb1, 0xbc,
+  0x10, 0xaf, 0x57, 0x3d, 0x10, 0x03, 0x23, 0x97, 0xba, 0x7f, 0xd0, 0xb5, 0x45, 0xfa, 0x3b, 0xb7,
+  0xf3, 0x91, 0x6a, 0x8b, 0x66, 0x6f, 0xa7, 0xbc, 0xdd, 0x7f, 0xe3, 0xbe, 0x8e, 0x78, 0xbb, 0x95,
+  0xbc, 0x87, 0xa8, 0x8b, 0x5c, 0x1c, 0x9c, 0xf6, 0x8e, 0x39, 0x65, 0x33, 0x7f, 0x3b, 0xe8, 0x9c,
+  0xb2, 0xaf, 0xa5, 0xfa, 0xa5, 0xd1, 0xd5, 0x79, 0x9c, 0x3a, 0x2a, 0x15, 0x6a, 0xb9, 0x4e, 0x7f,
+  0x59, 0x5e, 0x01, 0xeb, 0x49, 0x1a, 0x2a, 0x86, 0x5a, 0x73, 0xc5, 0x98, 0x6e, 0xe7, 0x6e, 0xf5,
+  0xf3, 0xa8, 0x90, 0x52, 0xdf, 0xe2, 0xca, 0x33, 0x44, 0x28, 0x0a, 0x78, 0x4c, 0x84, 0x36, 0x43,
+  0xb1, 0x85, 0xb0, 0x62, 0xa8, 0xb0, 0x34, 0xd9, 0x7f, 0x4c, 0x51, 0xf1, 0xc0, 0x19, 0xaa, 0x18,
+  0x88, 0xe7, 0x93, 0x11, 0x23, 0x77, 0x3b, 0x61, 0xdb, 0x69, 0xcf, 0x8c, 0x4e, 0x96, 0xfd, 0xe9,
+  0x1b, 0xa7, 0xde, 0xb3, 0x05, 0xa6, 0x2f, 0xfb, 0xf9, 0x29, 0x7a, 0x77, 0xfa, 0x56, 0x51, 0x05,
+  0xf4, 0x82, 0xa8, 0x1f, 0xa7, 0xaf, 0x21, 0xf6, 0x7a, 0x20, 0x52, 0xa0, 0x3e, 0xc0, 0xf4, 0xb1,
+  0xd5, 0x07, 0x5c, 0x96, 0x0c, 0xf5, 0xb4, 0x39, 0xb0, 0x95, 0x46, 0x35, 0x09, 0x91, 0x85, 0x1a,
+  0xb0, 0x0a, 0x42, 0x25, 0xc0, 0xd0, 0x26, 0xbb, 0x83, 0xaa, 0x3d, 0x71, 0x4e, 0xa1, 0x59, 0x44,
+  0x3c, 0x5d, 0x58, 0xe5, 0x4e, 0x91, 0x42, 0x57, 0x5d, 0x71, 0xb1, 0x4c, 0xc4, 0xd5, 0xad, 0x0b,
+  0x46, 0x6e, 0x41, 0xca, 0xaa, 0xfd, 0xbd, 0xbd, 0xf6, 0xc4, 0x6e, 0xc2, 0x19, 0xe2, 0x8a, 0xae,
+  0xbd, 0xb9, 0xbf, 0x41, 0x73, 0x80, 0x32, 0xf7, 0x81, 0x9e, 0xed, 0xba, 0xfb, 0xda, 0x5e, 0x62,
+  0x57, 0xcf, 0x10, 0xfa, 0x3b, 0x9f, 0x77, 0xea, 0x82, 0xc1, 0x76, 0xd9, 0x9a, 0x83, 0xf4, 0x82,
+  0xc6, 0x7b, 0xba, 0xbf, 0x5d, 0x2d, 0x32, 0xf7, 0x40, 0x75, 0x92, 0xea, 0xe8, 0xf8, 0x3a, 0xa4,
+  0x3b, 0x03, 0x4b, 0x5b, 0xe3, 0x54, 0xbf, 0x71, 0x14, 0xd9, 0x12, 0x20, 0x4f, 0x54, 0x3f, 0x6e,
+  0x43, 0xc5, 0x88, 0xe6, 0x42, 0x57, 0x62, 0x67, 0x4c, 0xc0, 0xb1, 0xc6, 0x50, 0xbd, 0xca, 0xc0,
+  0x56, 0x6a, 0xdd, 0xff, 0x8b, 0x06, 0x9b, 0xe8, 0xa6, 0x19, 0x4d, 0xf4, 0x5f, 0x94, 0x4e, 0x16,
+  0x8a, 0x7f, 0xa1, 0x6f, 0xb4, 0xa9, 0x1e, 0xb0, 0x15, 0x9f, 0x2b, 0x44, 0xff, 0x85, 0xa1, 0x2e,
+  0x5d, 0xd9, 0x79, 0x5f, 0x2e, 0x2d, 0x30, 0xbc, 0x80, 0x22, 0x4e, 0xad, 0xda, 0xdf, 0x28, 0x88,
+  0x78, 0x15, 0x57, 0x15, 0x2d, 0x14, 0xbf, 0x8f, 0xb2, 0x5b, 0xe8, 0x08, 0x10, 0x46, 0x8a, 0x5c,
+  0xba, 0x93, 0x66, 0xdc, 0x1c, 0x02, 0x03, 0x81, 0xd6, 0x14, 0x9d, 0xcd, 0xd1, 0xbb, 0x50, 0x19,
+  0x43, 0x3f, 0xe4, 0x26, 0xb6, 0xbc, 0xdb, 0xdb, 0xd1, 0x63, 0xc7, 0x84, 0x76, 0xde, 0xf7, 0x60,
+  0x4d, 0x20, 0x0d, 0xde, 0x15, 0x2b, 0xe2, 0x76, 0x33, 0xd6, 0x7f, 0x6b, 0x47, 0x74, 0xc8, 0x04,
+  0x98, 0x50, 0x84, 0x52, 0x41, 0xd3, 0x8c, 0xd0, 0x83, 0xb0, 0x25, 0xb4, 0x9b, 0x90, 0x09, 0x93,
+  0x6f, 0x81, 0x4d, 0xad, 0x1e, 0xfd, 0xf2, 0x8d, 0x08, 0x8f, 0x1a, 0x4a, 0xab, 0x27, 0x76, 0x5f,
+  0x2f, 0x36, 0xe8, 0x40, 0x0f, 0x3a, 0x47, 0xba, 0xeb, 0xad, 0xbf, 0x39, 0xf0, 0x12, 0xda, 0x67,
+  0x60, 0x68, 0x93, 0xf2, 0x07, 0x7e, 0x5b, 0xed, 0xe4, 0xed, 0x5c, 0xa0, 0x1c, 0x07, 0xd6, 0xb3,
+  0xd6, 0xdf, 0xbe, 0xb5, 0x50, 0xfd, 0xfe, 0xe0, 0x6d, 0x93, 0x82, 0x04, 0x34, 0xb7, 0x6a, 0xff,
+  0x9b, 0x77, 0xa0, 0x8b, 0x5c, 0x51, 0x68, 0xaf, 0x46, 0xc2, 0x17, 0xd9, 0x88, 0x3e, 0xb5, 0x6f,
+  0xef, 0x78, 0x3d, 0xc7, 0x7f, 0x2b, 0xdb, 0xb5, 0x43, 0xd1, 0x2c, 0x8e, 0xe0, 0xc3, 0x6c, 0x28,
+  0xb3, 0x51, 0x4f, 0x85, 0x0b, 0x75, 0xc3, 0xcf, 0xa6, 0x36, 0x51, 0xf3, 0x59, 0x87, 0x30, 0x10,
+  0xf4, 0x1d, 0x50, 0x37, 0x63, 0xda, 0xdf, 0x3e, 0x44, 0xcf, 0x6b, 0x03, 0x3f, 0x8a, 0xb2, 0xfc,
+  0xb4, 0xca, 0xc4, 0x33, 0x87, 0x9f, 0xa7, 0x9e, 0xa0, 0x3f, 0x1a, 0x56, 0xe0, 0xc5, 0x5b, 0xfd,
+  0x3a, 0x50, 0x66, 0xb3, 0xf7, 0xab, 0xdf, 0x3e, 0x35, 0xd2, 0xce, 0x43, 0x14, 0x7f, 0x82, 0xfa,
+  0x71, 0xfc, 0x65, 0x4a, 0x1a, 0x30, 0x05, 0x23, 0xfe, 0xd9, 0xde, 0xa2, 0xaa, 0x8c, 0x0a, 0x74,
+  0xc5, 0x7f, 0x03, 0x7d, 0xee, 0xd4, 0xb9, 0x30, 0x67, 0x17, 0x0c, 0x15, 0x70, 0xbf, 0xbc, 0x46,
+  0xc5, 0xa8, 0x3e, 0x50, 0xaf, 0xfd, 0x9f, 0xbe, 0xa4, 0xdc, 0x7d, 0xe9, 0x9d, 0xa8, 0x5a, 0x3d,
+  0x6c, 0x09, 0xd5, 0x02, 0x44, 0x36, 0x8d, 0x55, 0xc6, 0x4c, 0xf4, 0xbf, 0x01, 0x65, 0x65, 0xe4,
+  0xd4, 0x4d, 0x68, 0x4d, 0x61, 0xe5, 0x89, 0xfb, 0xd5, 0xf8, 0x5c, 0x40, 0x9f, 0x4b, 0x61, 0x0a,
+  0x50, 0xbe, 0x3b, 0xd4, 0x7b, 0x16, 0xf1, 0xb2, 0x2a, 0xef, 0xba, 0x39, 0x21, 0x70, 0x79, 0xde,
+  0x48, 0x1d, 0xee, 0xf6, 0x33, 0x2c, 0xd2, 0x5d, 0x54, 0x5c, 0xcb, 0x8b, 0x62, 0x93, 0x96, 0x4c,
+  0xe6, 0x4e, 0x54, 0x19, 0xbc, 0x5c, 0xb5, 0x5a, 0x3f, 0xbe, 0xfd, 0x85, 0x4e, 0xda, 0x4d, 0xe7,
+  0xd5, 0x44, 0xbd, 0x3c, 0xb1, 0x41, 0xf8, 0x59, 0x9b, 0xa2, 0xff, 0xed, 0x4f, 0xde, 0xd2, 0xfe,
+  0xa8, 0xce, 0x91, 0x62, 0x0b, 0xfa, 0x6e, 0xa9, 0x4a, 0x30, 0xe6, 0x7c, 0x35, 0x04, 0x6f, 0x66,
+  0xd9, 0x28, 0xf6, 0x84, 0x6a, 0x41, 0x8d, 0x2a, 0x76, 0x28, 0x4d, 0x54, 0xc4, 0xa9, 0xd4, 0x45,
+  0xbd, 0x65, 0xfd, 0x2d, 0x9a, 0xe8, 0xed, 0x33, 0xa8, 0x10, 0x52, 0xbe, 0x89, 0x2e, 0xb3, 0x3f,
+  0x3d, 0xe6, 0x53, 0x55, 0x2a, 0x2c, 0xc4, 0x0a, 0x1d, 0x56, 0xfd, 0xb4, 0x3f, 0x0a, 0xac, 0x9b,
+  0x78, 0x8e, 0x87, 0xea, 0xa6, 0xe8, 0x2f, 0x14, 0xba, 0x80, 0x5f, 0x64, 0x13, 0x82, 0x43, 0x74,
+  0xf9, 0xb4, 0x8c, 0x5d, 0x09, 0xcc, 0xdc, 0xc0, 0x15, 0x26, 0x0d, 0x41, 0x44, 0x0a, 0xcc, 0x5a,
+  0x6d, 0x8a, 0x7f, 0x86, 0x2a, 0x4c, 0xb5, 0x46, 0x45, 0xa7, 0xac, 0xda, 0x92, 0x1e, 0xfb, 0xe5,
+  0x5d, 0x7d, 0x69, 0xa1, 0xe8, 0x98, 0xfa, 0x0e, 0x8b, 0xbd, 0xe7, 0xf8, 0x32, 0x54, 0x88, 0xff,
+  0x70, 0x3b, 0xae, 0x29, 0xb6, 0x47, 0x5c, 0x42, 0x36, 0xca, 0xa8, 0x63, 0x0a, 0x59, 0x7e, 0xab,
+  0xbf, 0xfd, 0xab, 0x9c, 0x6b, 0xb2, 0xfa, 0x40, 0x28, 0x6b, 0xf7, 0xfd, 0xe6, 0xb1, 0x76, 0x58,
+  0xeb, 0x24, 0xfe, 0xf8, 0x79, 0xaa, 0x77, 0x4f, 0x15, 0xf7, 0xc5, 0x40, 0xbd, 0x85, 0x70, 0xae,
+  0x8c, 0x98, 0x0e, 0xc5, 0x46, 0xb9, 0xd7, 0x0f, 0x79, 0x11, 0x3f, 0x6f, 0x77, 0xf6, 0xad, 0x59,
+  0x2e, 0x52, 0x34, 0x8d, 0x2e, 0xf6, 0x99, 0x2b, 0x75, 0xc3, 0xcb, 0xec, 0x9c, 0xcc, 0x48, 0x30,
+  0xc1, 0x87, 0xb9, 0xde, 0x89, 0xaa, 0xe0, 0x19, 0xaf, 0x13, 0x17, 0x65, 0x1e, 0x51, 0x61, 0xb2,
+  0xde, 0x05, 0x8f, 0xf4, 0x8b, 0x8a, 0x05, 0xe7, 0xf4, 0x22, 0x2e, 0xc4, 0x26, 0xdc, 0xd0, 0x66,
+  0x59, 0x14, 0x9f, 0x99, 0xe8, 0x35, 0x02, 0xe3, 0x8e, 0xba, 0x03, 0xa3, 0x91, 0x32, 0x1b, 0x90,
+  0x11, 0xa1, 0x0e, 0x77, 0xab, 0x51, 0xc4, 0x07, 0x47, 0xae, 0x67, 0x14, 0xad, 0x44, 0xbc, 0xd9,
+  0xe2, 0x67, 0xfb, 0xfa, 0xdb, 0x27, 0xec, 0xd0, 0x95, 0xa0, 0xac, 0x03, 0x5c, 0x1f, 0x52, 0x0e,
+  0x43, 0x95, 0xab, 0x13, 0xd3, 0x6c, 0x48, 0x86, 0xeb, 0x9a, 0x42, 0x5d, 0xeb, 0x9c, 0xfe, 0xd6,
+  0xdc, 0xbf, 0x85, 0xdf, 0x22, 0xca, 0x8c, 0x23, 0x4e, 0xb7, 0xc1, 0x9e, 0x51, 0xe7, 0x18, 0x58,
+  0x27, 0x95, 0x33, 0x6d, 0x57, 0x09, 0x91, 0xb0, 0x20, 0x75, 0x07, 0x47, 0x67, 0x3f, 0xe9, 0x4a,
+  0x40, 0x31, 0xab, 0x6d, 0x95, 0xdd, 0x52, 0x4c, 0x30, 0x5d, 0xa9, 0x31, 0x02, 0x7f, 0x88, 0xa1,
+  0x94, 0xc0, 0xa9, 0x57, 0x03, 0x3a, 0x18, 0xd4, 0x0f, 0x09, 0xe6, 0x8b, 0x13, 0xc2, 0x99, 0xef,
+  0xd6, 0x28, 0x82, 0x6e, 0x5b, 0x30, 0x6a, 0x5a, 0x6f, 0x2f, 0x6b, 0xca, 0x4d, 0xad, 0xd0, 0xe7,
+  0xf4, 0xd6, 0xab, 0x5e, 0x66, 0x26, 0xbb, 0xbe, 0xc1, 0x39, 0xb5, 0x2d, 0xfb, 0xf5, 0x6a, 0xa5,
+  0xe2, 0x6a, 0xdc, 0x51, 0x94, 0x89, 0x5c, 0x64, 0x51, 0xfd, 0x2d, 0x84, 0x0e, 0xc6, 0x9c, 0xe7,
+  0x65, 0xb0, 0x5d, 0x95, 0xbc, 0xaa, 0xe6, 0x71, 0x99, 0x50, 0x15, 0x83, 0xf6, 0x69, 0x2e, 0xaa,
+  0x7d, 0xe0, 0x6b, 0x4c, 0xe2, 0xc5, 0xb7, 0x26, 0x3a, 0x7a, 0x4e, 0xe2, 0x88, 0xc4, 0xb3, 0x41,
+  0x1f, 0x0a, 0x65, 0x28, 0x58, 0x8b, 0x5a, 0xdd, 0xb9, 0x7d, 0x07, 0x87, 0xfa, 0xe7, 0xc1, 0xec,
+  0x24, 0xbd, 0x41, 0x78, 0xf4, 0xa6, 0x74, 0x3b, 0xea, 0x1a, 0x3b, 0x72, 0x48, 0x52, 0xc4, 0xc1,
+  0x1b, 0x93, 0x12, 0x22, 0x78, 0x41, 0x9b, 0xfa, 0xd1, 0xf1, 0xdb, 0x9a, 0x35, 0x5f, 0x16, 0xe8,
+  0x52, 0x5d, 0xa8, 0x8d, 0x54, 0x13, 0x5d, 0x54, 0xcf, 0x62, 0x1e, 0x13, 0x7d, 0x28, 0x8b, 0x35,
+  0xe3, 0x80, 0xbd, 0x6e, 0xa1, 0xe6, 0xe1, 0x7b, 0x09, 0x1e, 0x08, 0x3a, 0x64, 0x36, 0x45, 0x78,
+  0xa8, 0x09, 0x93, 0x9f, 0x5f, 0x5d, 0x54, 0xda, 0x06, 0x6b, 0x66, 0xa0, 0x1b, 0x57, 0xe5, 0x64,
+  0x4b, 0xb1, 0x17, 0x6e, 0x6d, 0x9c, 0x74, 0xeb, 0x6e, 0xfd, 0xb8, 0xa2, 0xee, 0xf8, 0xea, 0xd4,
+  0xd7, 0x81, 0xae, 0x38, 0x42, 0xa9, 0x7a, 0x3b, 0xaa, 0x73, 0xf7, 0x88, 0x8a, 0x8d, 0xdd, 0xec,
+  0x76, 0x28, 0x0d, 0xed, 0x49, 0x6c, 0xa1, 0xd1, 0xc5, 0x29, 0x44, 0x75, 0x92, 0xba, 0xb6, 0x10,
+  0x73, 0x19, 0xf5, 0x8d, 0x37, 0x17, 0xd1, 0xe0, 0x94, 0xc8, 0x1e, 0x50, 0x77, 0xd2, 0xdf, 0x89,
+  0x10, 0x7a, 0x62, 0x57, 0x5d, 0xc0, 0x69, 0xff, 0xee, 0x2d, 0xba, 0xf5, 0xf7, 0x3e, 0x2f, 0x63,
+  0xe9, 0xdb, 0x25, 0xfe, 0xf2, 0x7f, 0x0d, 0xbb, 0x8f, 0xd8, 0x21, 0x60, 0xbb, 0xfd, 0x41, 0x88,
+  0x86, 0xea, 0x4d, 0x85, 0xa6, 0x43, 0xcd, 0xc9, 0xae, 0x0e, 0x46, 0x10, 0x83, 0xf8, 0x88, 0x3a,
+  0x2f, 0xea, 0x38, 0x15, 0x1d, 0x0f, 0x5f, 0xa2, 0xd3, 0x22, 0xe0, 0x21, 0x6b, 0xe5, 0xea, 0x33,
+  0x1a, 0x43, 0x74, 0xba, 0x5d, 0xee, 0x62, 0x3d, 0x59, 0xa8, 0xbf, 0x55, 0xee, 0x81, 0x41, 0x31,
+  0x6b, 0x30, 0x22, 0x30, 0x45, 0x0e, 0x79, 0x72, 0x35, 0x89, 0xb1, 0x84, 0xbd, 0x4e, 0xc8, 0xc8,
+  0xc9, 0x33, 0xb4, 0xd9, 0xe3, 0x9c, 0x57, 0x6d, 0xed, 0xce, 0x7d, 0x20, 0xa5, 0x3e, 0xc4, 0xca,
+  0x84, 0x6b, 0xb8, 0x3a, 0x85, 0xdf, 0x8e, 0x8a, 0x37, 0xd7, 0x2b, 0x7d, 0xc2, 0x94, 0xf9, 0xa4,
+  0x87, 0xa4, 0x6c, 0x06, 0x5c, 0x94, 0x49, 0x7a, 0x6d, 0x19, 0x31, 0x51, 0x86, 0x0d, 0xed, 0xbc,
+  0x60, 0x0d, 0x36, 0xca, 0xe7, 0x13, 0xd1, 0xda, 0x4a, 0x7f, 0xf2, 0xf2, 0xd7, 0x2b, 0xb2, 0x67,
+  0x69, 0x3d, 0x83, 0x3a, 0xb9, 0x97, 0xbf, 0x31, 0x6d, 0xe9, 0xa2, 0x76, 0xd5, 0xeb, 0x49, 0xd5,
+  0x87, 0xc0, 0xbf, 0x11, 0xff, 0x21, 0x77, 0x35, 0x31, 0xd5, 0x7b, 0x6b, 0x6f, 0xff, 0xdb, 0xe7,
+  0xf5, 0x54, 0x0f, 0xe9, 0xde, 0xed, 0x55, 0x4d, 0xb4, 0x9e, 0x4f, 0x76, 0xa8, 0x1b, 0x81, 0x3b,
+  0xb1, 0xc0, 0x44, 0x35, 0xd1, 0x69, 0xdc, 0x87, 0x50, 0x17, 0xb8, 0x19, 0x2b, 0xa1, 0x75, 0x9d,
+  0x99, 0xea, 0x7f, 0xbb, 0x24, 0x2b, 0x77, 0xe6, 0x46, 0xa4, 0xd4, 0x89, 0x65, 0x3b, 0x5e, 0xec,
+  0xca, 0x80, 0xa2, 0x50, 0x37, 0x39, 0xfa, 0x8f, 0x6b, 0xad, 0xce, 0xcf, 0x14, 0x1d, 0xab, 0x6e,
+  0xd2, 0xe3, 0x34, 0x66, 0x94, 0x43, 0xd1, 0x7f, 0xbc, 0xd9, 0xcc, 0xed, 0x98, 0xea, 0xa4, 0xfc,
+  0xdc, 0xba, 0xaa, 0xfb, 0xbb, 0x0b, 0x35, 0x84, 0x85, 0x0e, 0xa4, 0x43, 0xca, 0x4b, 0xf3, 0xed,
+  0xb8, 0xbe, 0xfa, 0x72, 0xc4, 0x3d, 0x00, 0x4f, 0x77, 0x4d, 0x85, 0x1e, 0x1c, 0x53, 0x13, 0x34,
+  0xb8, 0x1f, 0xa7, 0xcd, 0xd7, 0x5f, 0x5c, 0x4e, 0xe4, 0x69, 0xa4, 0xaf, 0x41, 0x13, 0x6b, 0xd2,
+  0x7a, 0x2e, 0x31, 0x25, 0xc5, 0xd1, 0x3d, 0xc1, 0x73, 0x35, 0x80, 0x23, 0x56, 0x1b, 0x75, 0xb3,
+  0x71, 0xd2, 0xc9, 0x01, 0x57, 0x82, 0xd8, 0x84, 0xc0, 0x8d, 0x96, 0xf2, 0x22, 0xd5, 0x4e, 0xc6,
+  0x09, 0x51, 0x2f, 0xfc, 0x76, 0x75, 0x7b, 0x63, 0x98, 0xab, 0x0d, 0xbb, 0x98, 0xe9, 0x4b, 0xd1,
+  0x6b, 0x7e, 0x5f, 0x57, 0x9c, 0x1c, 0xe8, 0x47, 0x1d, 0x52, 0xd7, 0x62, 0x7f, 0x01, 0x3d, 0x52,
+  0x7f, 0x67, 0xff, 0x5c, 0x84, 0x9e, 0xf2, 0x2c, 0xf4, 0x64, 0x3a, 0xe5, 0xa6, 0xa3, 0x09, 0x76,
+  0x29, 0xd6, 0x8d, 0xf2, 0x58, 0x60, 0xf1, 0x75, 0x47, 0xd9, 0x41, 0x87, 0x2d, 0x9d, 0xb7, 0x8c,
+  0x6c, 0xb8, 0xb3, 0x74, 0x36, 0x31, 0xef, 0x00, 0x51, 0x31, 0xe5, 0x22, 0xd0, 0xc8, 0xad, 0x2a,
+  0x16, 0xe1, 0xac, 0x52, 0xfa, 0xb7, 0xd7, 0x93, 0xf8, 0x0f, 0x7b, 0x1d, 0x95, 0xd5, 0x8d, 0x2d,
+  0xb4, 0xdd, 0xc0, 0xd9, 0x23, 0xad, 0x93, 0x3d, 0x4d, 0xcc, 0xbf, 0x00, 0xaf, 0x98, 0xde, 0x02,
+  0x7a, 0x78, 0x51, 0x2d, 0xed, 0x55, 0xb6, 0x9a, 0x14, 0xa7, 0x36, 0xd5, 0xb3, 0x82, 0xbe, 0x19,
+  0x53, 0x75, 0xe9, 0xc5, 0x5d, 0x03, 0xf3, 0xd5, 0x08, 0xfb, 0x3c, 0x99, 0x88, 0x32, 0xbf, 0x25,
+  0x3e, 0x8a, 0x1d, 0x72, 0x44, 0xdd, 0x29, 0xce, 0x8c, 0xb7, 0x27, 0xd3, 0xc0, 0xec, 0xe4, 0xbe,
+  0x3a, 0x9f, 0x2f, 0x23, 0xe1, 0x4b, 0x9d, 0x94, 0x2e, 0x0a, 0xb2, 0x03, 0x52, 0xf0, 0x81, 0x8d,
+  0xaa, 0xb5, 0xe6, 0x8b, 0x47, 0x71, 0x0f, 0x88, 0xad, 0xb7, 0x62, 0x73, 0xe3, 0x33, 0x9a, 0xfd,
+  0x03, 0xad, 0xb4, 0xca, 0xd9, 0x2b, 0x8c, 0x1a, 0xaa, 0xc4, 0xe7, 0x09, 0x08, 0xd2, 0x9d, 0x01,
+  0x53, 0xb2, 0x56, 0xb6, 0xff, 0xd4, 0xdc, 0xed, 0xcf, 0x5b, 0x30, 0xeb, 0x0f, 0x6c, 0x6e, 0xea,
+  0x17, 0xb1, 0xf1, 0x76, 0x6d, 0xdd, 0x7a, 0x0b, 0x29, 0x55, 0xfb, 0x51, 0xcc, 0x64, 0x70, 0x4e,
+  0x39, 0x97, 0x5e, 0x42, 0x2f, 0xf3, 0x6a, 0x45, 0x50, 0x67, 0xde, 0xcc, 0x7a, 0x4b, 0xcd, 0xdc,
+  0xa3, 0xd9, 0x12, 0xea, 0xe9, 0xc8, 0xa5, 0x99, 0xa9, 0x0e, 0xd5, 0x2e, 0xa3, 0x18, 0x71, 0x2a,
+  0x9c, 0x0b, 0x2a, 0x2c, 0x4e, 0x9d, 0xbb, 0xfb, 0x3d, 0xf3, 0xb7, 0x1a, 0x45, 0xb8, 0x11, 0xa6,
+  0xa4, 0x50, 0xbf, 0x5e, 0x57, 0x6b, 0x71, 0xd5, 0x10, 0x82, 0xbf, 0x8e, 0x9a, 0xd9, 0x34, 0x94,
+  0x77, 0xba, 0x0a, 0x07, 0xd4, 0xcb, 0x05, 0xf6, 0x0d, 0x29, 0xf8, 0x60, 0x2a, 0x46, 0x67, 0x6f,
+  0xaa, 0x2a, 0xa4, 0xd0, 0x03, 0xa9, 0x5a, 0x1c, 0x17, 0x13, 0x5b, 0xae, 0x62, 0x65, 0x52, 0xc6,
+  0x44, 0x85, 0x94, 0x66, 0x23, 0x40, 0x59, 0x9b, 0x6a, 0x07, 0xe0, 0xd3, 0x3a, 0x4f, 0x36, 0x70,
+  0xe1, 0x37, 0xa1, 0x60, 0xb9, 0x69, 0xb2, 0x4c, 0x9f, 0x22, 0xf7, 0x47, 0x64, 0x73, 0x08, 0xff,
+  0xf5, 0xf1, 0xe2, 0xbf, 0x97, 0x7b, 0xcb, 0x9d, 0x58, 0x53, 0xcc, 0x88, 0xf8, 0x9e, 0x61, 0x8a,
+  0xec, 0xeb, 0xaa, 0xc0, 0x36, 0x95, 0x0f, 0xb5, 0x8a, 0xd3, 0xfa, 0x56, 0x99, 0x1a, 0xb8, 0xa1,
+  0xf4, 0x64, 0x7f, 0x54, 0xad, 0xff, 0xce, 0xcf, 0x22, 0xab, 0x0c, 0x9e, 0xc2, 0xa1, 0xaa, 0x11,
+  0xb8, 0x75, 0xc4, 0x62, 0xee, 0xaa, 0xd7, 0x28, 0x24, 0xd3, 0xe1, 0xce, 0xfb, 0x22, 0x66, 0x72,
+  0x7e, 0x9d, 0xb3, 0xa8, 0xd3, 0x38, 0x84, 0x7a, 0x0e, 0xb4, 0x6f, 0xa8, 0x43, 0x71, 0x33, 0xb7,
+  0x39, 0xfe, 0x70, 0x90, 0x59, 0x7f, 0xbd, 0x6d, 0x61, 0x7f, 0xa1, 0xa3, 0x45, 0xd3, 0x8e, 0x10,
+  0x89, 0x55, 0x05, 0x56, 0x87, 0x9a, 0x07, 0xf5, 0x1f, 0xcf, 0x10, 0x1a, 0x35, 0x0e, 0xc5, 0xa1,
+  0x5a, 0xeb, 0xf8, 0xde, 0x78, 0x0b, 0xef, 0xb4, 0x46, 0x7f, 0xf5, 0xcc, 0x2f, 0x3e, 0xc9, 0x75,
+  0x32, 0x60, 0x41, 0xae, 0xba, 0xab, 0xb8, 0x5a, 0x9d, 0x71, 0x09, 0xd5, 0x92, 0xa0, 0xbd, 0xc0,
+  0x57, 0x81, 0xb8, 0x10, 0x92, 0xde, 0xd4, 0xb4, 0x02, 0xa8, 0xd6, 0x2e, 0xda, 0x7d, 0xc9, 0x74,
+  0xa8, 0x9e, 0xec, 0xf6, 0x61, 0x13, 0xb7, 0xce, 0xa7, 0xa8, 0x3b, 0x05, 0xb4, 0x6c, 0x29, 0xbb,
+  0x45, 0xc5, 0x7c, 0x74, 0xa5, 0xef, 0x49, 0x93, 0xf4, 0x6e, 0x34, 0xb8, 0x94, 0x4a, 0x29, 0x73,
+  0x17, 0x31, 0x1b, 0x61, 0x90, 0xbe, 0x91, 0xea, 0xcb, 0x6f, 0x7b, 0xbe, 0x33, 0xf3, 0xbe, 0xf0,
+  0x77, 0x09, 0x5c, 0x03, 0x9a, 0x19, 0x4e, 0x73, 0xb9, 0xf2, 0x14, 0xd2, 0x4c, 0x96, 0x31, 0x44,
+  0x8f, 0xee, 0xed, 0xb1, 0x61, 0xd5, 0xa3, 0x8c, 0x2a, 0x16, 0x4f, 0x93, 0x5a, 0x6f, 0xd6, 0xfc,
+  0xc5, 0xbf, 0x2e, 0xfa, 0x2f, 0x30, 0x55, 0x80, 0xf0, 0x5f, 0xc4, 0xca, 0x64, 0xa3, 0x5a, 0xc6,
+  0x93, 0x95, 0x6b, 0x79, 0xfb, 0xd4, 0x08, 0xa1, 0x5f, 0x6b, 0x88, 0x7e, 0x06, 0xa0, 0x75, 0x3b,
+  0x94, 0x62, 0xcb, 0x61, 0xbd, 0x2b, 0xa1, 0x3b, 0x7e, 0x39, 0x44, 0xb5, 0x27, 0x28, 0x56, 0x6f,
+  0xaf, 0x5d, 0xff, 0x32, 0xec, 0x2e, 0xa6, 0x0a, 0xdc, 0xf9, 0x22, 0x43, 0x71, 0x64, 0x49, 0xf5,
+  0x53, 0xc6, 0x5c, 0x57, 0x8d, 0x91, 0xd4, 0x86, 0xef, 0x34, 0x4a, 0x8e, 0x56, 0x9a, 0x98, 0xc3,
+  0x84, 0x39, 0x57, 0x87, 0xe6, 0x46, 0x71, 0xaf, 0x27, 0x2a, 0xba, 0xed, 0xed, 0x94, 0xbf, 0xf3,
+  0x50, 0xa8, 0x4f, 0x62, 0xaf, 0x29, 0x94, 0xcb, 0x31, 0x4b, 0xb2, 0x91, 0xca, 0x63, 0x6c, 0x35,
+  0x7b, 0x42, 0x29, 0xa8, 0xdd, 0x89, 0x6c, 0x84, 0xd9, 0x00, 0xbb, 0x72, 0x9a, 0xbd, 0x36, 0xc4,
+  0xd4, 0x91, 0x40, 0xc5, 0x91, 0x6a, 0x1d, 0xe0, 0x44, 0xd2, 0x1c, 0x47, 0x70, 0xe0, 0xa8, 0x63,
+  0x0a, 0x7a, 0x83, 0x63, 0x28, 0xcc, 0x31, 0xc8, 0x3b, 0xb9, 0xbd, 0xb5, 0xdb, 0x18, 0xc8, 0x16,
+  0x49, 0x83, 0x78, 0xaf, 0x37, 0xde, 0xf9, 0x22, 0x90, 0xfe, 0x22, 0x0d, 0x77, 0x35, 0xa9, 0x7b,
+  0xed, 0x76, 0xfc, 0xd1, 0x0c, 0x19, 0xd6, 0xbb, 0xf2, 0x3f, 0x78, 0x14, 0x4f, 0x7a, 0xeb, 0x5b,
+  0x70, 0x46, 0x86, 0x2f, 0xa5, 0x21, 0x88, 0x3a, 0x19, 0xa9, 0xd3, 0xc3, 0xf3, 0xd6, 0xac, 0x63,
+  0x70, 0x77, 0x4a, 0x5a, 0x5a, 0xec, 0x3e, 0xea, 0x98, 0x3a, 0x64, 0x7f, 0xa1, 0x46, 0xae, 0x70,
+  0x0d, 0xf4, 0x2d, 0x12, 0x6e, 0x3f, 0xb2, 0x6b, 0x60, 0xb1, 0xfe, 0xa4, 0xe8, 0x50, 0x2c, 0x5a,
+  0x1c, 0x34, 0x0d, 0xcd, 0x8e, 0xc8, 0x5b, 0xc0, 0x50, 0xa1, 0x89, 0x2a, 0x01, 0x9c, 0xa0, 0x7a,
+  0x27, 0x68, 0xbb, 0x11, 0xff, 0x61, 0x67, 0xd4, 0x56, 0xd5, 0xde, 0x0d, 0x5d, 0x24, 0xc4, 0xf5,
+  0x81, 0x3a, 0x06, 0xe5, 0x01, 0x97, 0x99, 0x4c, 0x1a, 0x1f, 0x7e, 0xc4, 0xcc, 0x1b, 0x63, 0xa6,
+  0x3a, 0xaa, 0x0f, 0x43, 0xe4, 0x90, 0x50, 0xef, 0x1d, 0xcc, 0x34, 0x3b, 0x42, 0x23, 0x0c, 0x53,
+  0x4f, 0x29, 0x82, 0xc6, 0x33, 0x74, 0x52, 0x77, 0x71, 0xd1, 0x21, 0x73, 0x59, 0xed, 0x8d, 0xf0,
+  0x6a, 0x56, 0x27, 0x6a, 0x7f, 0x72, 0x06, 0xcd, 0x96, 0x1f, 0x5c, 0xa3, 0x22, 0x84, 0x13, 0xea,
+  0xa7, 0xfe, 0xfa, 0xf9, 0xab, 0x31, 0x4a, 0xca, 0x09, 0xa8, 0xf6, 0x11, 0x83, 0x02, 0x4a, 0x04,
+  0x84, 0x70, 0x6e, 0x39, 0xfd, 0xf5, 0xb8, 0x98, 0x43, 0x5a, 0xa6, 0xf6, 0x56, 0x5c, 0xb9, 0x63,
+  0x4e, 0x31, 0x55, 0xa0, 0x43, 0x4d, 0x45, 0xbe, 0xd1, 0x6b, 0xb5, 0x72, 0xcb, 0xa6, 0x98, 0x39,
+  0x16, 0x47, 0x30, 0x51, 0x3f, 0x4b, 0x2b, 0x7b, 0xc1, 0xc7, 0x12, 0x08, 0xd1, 0xea, 0xf1, 0xf6,
+  0x9e, 0x7d, 0xd9, 0x41, 0x7b, 0x6b, 0x49, 0xdf, 0xd7, 0xf1, 0x97, 0x91, 0x5b, 0xf8, 0x04, 0x9d,
+  0x98, 0x45, 0xf6, 0x56, 0x61, 0xae, 0xb2, 0x2b, 0xf5, 0xe3, 0xa0, 0x4f, 0x98, 0xe6, 0xd2, 0xf6,
+  0x1d, 0xaa, 0x0f, 0x70, 0x89, 0x29, 0xc3, 0xb7, 0x33, 0x84, 0xba, 0xa0, 0x76, 0x76, 0x99, 0xb1,
+  0xa2, 0x69, 0x17, 0x18, 0xc8, 0x9d, 0x78, 0x57, 0x33, 0x94, 0x6f, 0xaf, 0x9b, 0x60, 0x2f, 0xa0,
+  0x3b, 0x9b, 0xf0, 0x12, 0x70, 0xf3, 0x89, 0x0b, 0xd8, 0x98, 0x4b, 0x95, 0xb6, 0x84, 0xfb, 0xea,
+  0xf2, 0x3b, 0xac, 0x10, 0xdd, 0xd9, 0xab, 0xc5, 0xab, 0x49, 0x72, 0x59, 0xb6, 0xdc, 0xfd, 0x3e,
+  0x04, 0x4b, 0x3c, 0x90, 0x59, 0xf2, 0xa4, 0xee, 0xdd, 0x94, 0xb2, 0x60, 0x5e, 0x25, 0xbd, 0xb6,
+  0x3b, 0xeb, 0x90, 0x7a, 0x14, 0xd0, 0xb7, 0x48, 0xdd, 0x34, 0xcb, 0x85, 0x26, 0x1f, 0xa2, 0x41,
+  0x52, 0x73, 0xf6, 0x23, 0x58, 0xc1, 0xee, 0x7b, 0x29, 0xbd, 0xb6, 0xb0, 0xd7, 0x33, 0x5c, 0xab,
+  0xc1, 0x13, 0x94, 0xa1, 0x04, 0x4e, 0x95, 0x8a, 0x50, 0x9d, 0x21, 0xfb, 0x0c, 0xa1, 0x6d, 0x8c,
+  0x78, 0x7d, 0xd1, 0xf4, 0x15, 0xf4, 0xac, 0x18, 0x31, 0xe0, 0x8f, 0x62, 0x1b, 0x63, 0x96, 0x3a,
+  0x45, 0xe6, 0xd1, 0xd4, 0xa4, 0x96, 0x21, 0xf4, 0xd7, 0x6d, 0x66, 0x5e, 0xb8, 0x25, 0x83, 0x22,
+  0x4c, 0x71, 0x43, 0xa9, 0x47, 0x17, 0xfd, 0xa6, 0xa4, 0x6d, 0x31, 0x43, 0x68, 0x1b, 0x7f, 0x29,
+  0xc3, 0x7a, 0xfb, 0xfd, 0xaf, 0x7a, 0x03, 0xc5, 0xbf, 0x2d, 0x94, 0x5d, 0xbf, 0x55, 0x02, 0xe6,
+  0x89, 0x35, 0xa1, 0xe5, 0x75, 0x86, 0xe8, 0x84, 0x0d, 0x9c, 0x79, 0x52, 0x52, 0xb6, 0xc4, 0x69,
+  0x17, 0xe3, 0x04, 0xfd, 0xd5, 0xe3, 0x77, 0xcc, 0x7c, 0xac, 0xb1, 0xf2, 0x97, 0x0f, 0xed, 0x37,
+  0x56, 0xbe, 0xcf, 0x5b, 0x3d, 0xd9, 0x9d, 0x6d, 0xd7, 0xb8, 0xdf, 0x54, 0x4d, 0xb3, 0x86, 0xee,
+  0x41, 0x23, 0x8f, 0x3e, 0x45, 0x1d, 0xc7, 0x87, 0x66, 0x68, 0xc7, 0x50, 0xfd, 0xbc, 0xed, 0xbc,
+  0xfd, 0xe8, 0x8e, 0xea, 0xc3, 0xa4, 0x2a, 0x01, 0x34, 0x07, 0x48, 0xed, 0x72, 0x1f, 0x51, 0x27,
+  0x43, 0x36, 0x63, 0x84, 0x55, 0xe4, 0x89, 0x25, 0x5e, 0xe6, 0x55, 0xf5, 0x23, 0x0c, 0x7a, 0xb5,
+  0x77, 0x4f, 0x96, 0x0e, 0xdb, 0x45, 0x9a, 0x3a, 0x5d, 0xcc, 0x5c, 0x80, 0x2d, 0x21, 0x76, 0x08,
+  0x76, 0x6a, 0xed, 0xbf, 0xb8, 0xac, 0x6b, 0x46, 0x59, 0xa1, 0x33, 0x42, 0x0a, 0xcd, 0x47, 0xe0,
+  0x9e, 0xb7, 0x2f, 0x3f, 0x48, 0xa3, 0xc6, 0xd5, 0xfc, 0x63, 0x67, 0xed, 0xbc, 0xb4, 0x9e, 0x4b,
+  0x69, 0xe4, 0xde, 0x9a, 0x5a, 0xcd, 0xc6, 0xaf, 0x72, 0x2e, 0xf9, 0xee, 0xd1, 0xd4, 0x5c, 0xda,
+  0xdd, 0x85, 0x1e, 0x08, 0x9e, 0x97, 0xf4, 0x7f, 0x81, 0x20, 0x13, 0xdf, 0xe8, 0x72, 0x88, 0x08,
+  0xf9, 0x5f, 0x02, 0x07, 0xbf, 0xf3, 0x66, 0x78, 0xe6, 0x63, 0x2c, 0xa1, 0xc6, 0xb8, 0xd1, 0x55,
+  0x44, 0x53, 0x7e, 0x70, 0x2e, 0x88, 0x33, 0x02, 0x74, 0x86, 0x78, 0x99, 0x6b, 0xbd, 0x98, 0xb9,
+  0x5d, 0x54, 0x82, 0x66, 0xc5, 0x8d, 0xfd, 0x72, 0xd2, 0x5d, 0x4e, 0x9d, 0xf6, 0xab, 0x69, 0x56,
+  0x51, 0xaa, 0xcb, 0xc8, 0xad, 0x3b, 0x75, 0x71, 0x95, 0xe0, 0xef, 0x84, 0xa8, 0x20, 0xc6, 0xb3,
+  0xfb, 0xdb, 0xd1, 0xfe, 0x7d, 0x9c, 0xf9, 0x32, 0x67, 0xa3, 0x6d, 0x55, 0x6f, 0x81, 0xc6, 0x07,
+  0xab, 0x79, 0xf8, 0x12, 0x73, 0xda, 0x2e, 0x36, 0x48, 0xf1, 0x6f, 0x6b, 0x42, 0xff, 0x17, 0x3d,
+  0x8e, 0x5b, 0xaa, 0x2e, 0x93, 0x22, 0x0e, 0x7a, 0x6c, 0x3a, 0xf3, 0xc4, 0x5c, 0xf0, 0xcf, 0xda,
+  0x69, 0xe2, 0xc9, 0xae, 0x96, 0x17, 0xcd, 0xbf, 0x80, 0x8e, 0xcb, 0x56, 0x56, 0x99, 0x26, 0x26,
+  0xa0, 0xc7, 0xb1, 0x75, 0x35, 0xd3, 0x98, 0x15, 0xa5, 0xdb, 0x52, 0xfd, 0x6f, 0xc3, 0x95, 0x0e,
+  0x9c, 0x52, 0xf3, 0xb8, 0x38, 0x0c, 0xf7, 0xf6, 0x31, 0x5f, 0x23, 0x55, 0x0b, 0xa6, 0x52, 0x9c,
+  0x77, 0x9e, 0xa7, 0x86, 0xf8, 0x61, 0xbf, 0x13, 0x31, 0xed, 0xce, 0x58, 0x3d, 0xc4, 0x54, 0x57,
+  0xd3, 0x62, 0xc0, 0x68, 0xa4, 0x19, 0x3d, 0xdd, 0xba, 0xc0, 0xa3, 0x90, 0xcf, 0x0f, 0xe2, 0x99,
+  0x4f, 0xa1, 0x92, 0xe7, 0x9d, 0xbb, 0x1c, 0xc0, 0xe7, 0x12, 0x9c, 0x91, 0x8b, 0x65, 0x52, 0x47,
+  0xfb, 0x08, 0x55, 0xb5, 0x07, 0x6f, 0xbb, 0x11, 0xd3, 0x57, 0x69, 0xfd, 0x39, 0x98, 0x2f, 0xd4,
+  0xf5, 0x8d, 0x5a, 0x68, 0x63, 0xcd, 0xc3, 0xf9, 0x66, 0x49, 0x16, 0x98, 0x45, 0x42, 0x5a, 0x5e,
+  0x5d, 0xe5, 0x64, 0xd0, 0xf5, 0xa9, 0x6f, 0xf1, 0x77, 0x0a, 0x39, 0x3a, 0x2d, 0xc4, 0x84, 0xf5,
+  0x58, 0x52, 0xb1, 0x1b, 0xfa, 0x0f, 0xa4, 0xe9, 0x80, 0x49, 0x85, 0xa4, 0x3f, 0x89, 0x29, 0x1e,
+  0xd4, 0x7f, 0x71, 0xf9, 0x93, 0x93, 0xe6, 0xfe, 0x9a, 0xca, 0x9d, 0xb2, 0xce, 0x40, 0xd5, 0x1d,
+  0xcc, 0x7a, 0xa9, 0x3b, 0xea, 0xb3, 0x9e, 0x21, 0xa6, 0xc5, 0x00, 0xbb, 0x22, 0x2e, 0x0a, 0xb2,
+  0xaf, 0xca, 0x20, 0xbe, 0x51, 0x3c, 0x75, 0x18, 0xa0, 0xd3, 0x82, 0x7a, 0x32, 0xf1, 0x0c, 0x83,
+  0xe2, 0x87, 0xf4, 0x01, 0xa4, 0x44, 0x00, 0xc6, 0xc7, 0xa6, 0x7a, 0xd6, 0xf1, 0xf7, 0xdf, 0x2e,
+  0x36, 0x58, 0x23, 0x90, 0x58, 0x43, 0xf4, 0x61, 0x3b, 0x94, 0x55, 0x88, 0x01, 0xb4, 0x99, 0x43,
+  0x94, 0x91, 0x23, 0xcf, 0x52, 0x47, 0xb5, 0xcf, 0x45, 0x67, 0x29, 0xba, 0xbe, 0x69, 0x4e, 0xfc,
+  0xd5, 0xfd, 0xa2, 0x59, 0x24, 0x3c, 0x0b, 0x0a, 0x9c, 0x91, 0x2e, 0x22, 0xa6, 0x3e, 0xd5, 0xa4,
+  0x00, 0x28, 0xab, 0x70, 0x45, 0x6c, 0x87, 0xc8, 0xd1, 0x81, 0x18, 0x36, 0xaa, 0xdd, 0x02, 0xe7,
+  0x62, 0xdc, 0x5e, 0x75, 0xc8, 0x80, 0xa1, 0x4d, 0x1d, 0xf8, 0x0d, 0x73, 0x14, 0x2a, 0xae, 0x3c,
+  0x7c, 0x0a, 0xfe, 0x19, 0xf6, 0x03, 0x4d, 0x92, 0xfe, 0xa3, 0x25, 0x03, 0xeb, 0xa9, 0xf8, 0x67,
+  0x60, 0x24, 0xd0, 0x6c, 0xbb, 0x6d, 0x84, 0xcb, 0x41, 0x0d, 0xd7, 0x95, 0x2a, 0x4f, 0x6f, 0x2f,
+  0x26, 0xf6, 0x65, 0x80, 0x21, 0x94, 0xfa, 0x10, 0x39, 0x52, 0x94, 0x89, 0x4a, 0x3c, 0xcf, 0xf2,
+  0xe5, 0x09, 0xf6, 0xe0, 0x0d, 0x2e, 0xa1, 0x7d, 0x0e, 0x35, 0x7d, 0x9a, 0x4b, 0x30, 0xd6, 0x12,
+  0x13, 0x6b, 0x30, 0x55, 0x8b, 0x71, 0x65, 0x0b, 0xc1, 0x16, 0x42, 0xb6, 0x48, 0xb9, 0x29, 0xb0,
+  0x6d, 0x52, 0x4d, 0xc4, 0x6c, 0x5c, 0xb2, 0xbf, 0xc0, 0x1f, 0x1a, 0x7f, 0x33, 0x17, 0x78, 0xf5,
+  0x98, 0x21, 0xba, 0x48, 0x2e, 0x93, 0x84, 0x54, 0x0b, 0x42, 0xb1, 0xbc, 0x2e, 0x77, 0x9c, 0x62,
+  0x0d, 0xd5, 0x39, 0x16, 0x98, 0x29, 0x34, 0x88, 0xc5, 0x61, 0x22, 0x63, 0xbd, 0xb5, 0xba, 0x8a,
+  0xa2, 0x7c, 0x09, 0xf6, 0x78, 0xfd, 0xf1, 0xe7, 0xf5, 0xda, 0x9b, 0xd5, 0xdd, 0xc9, 0x8a, 0xdc,
+  0xc7, 0xea, 0xfe, 0x56, 0x74, 0x8b, 0xd2, 0x2f, 0x21, 0x0d, 0xd1, 0x85, 0x8a, 0x1b, 0x74, 0xb1,
+  0xa9, 0xe7, 0xaa, 0x69, 0xb6, 0x10, 0xe3, 0x0f, 0xe8, 0x1b, 0x1f, 0xa2, 0x5a, 0xbd, 0x98, 0xa9,
+  0x9e, 0xd6, 0x88, 0xe7, 0xa6, 0xe6, 0x5b, 0xac, 0x25, 0xf4, 0x40, 0x76, 0xae, 0xf1, 0x24, 0xec,
+  0x6a, 0x85, 0xc0, 0x1c, 0x2f, 0xc7, 0xa5, 0x7e, 0x75, 0xef, 0x62, 0x02, 0x97, 0x43, 0x4b, 0x3c,
+  0x48, 0x59, 0xa5, 0x2d, 0x11, 0xef, 0xdc, 0x69, 0x47, 0xd4, 0xdb, 0xd7, 0x5c, 0x28, 0x8f, 0xde,
+  0xae, 0xce, 0x2e, 0x35, 0xeb, 0x49, 0xbd, 0x77, 0xbb, 0xd0, 0x16, 0x6a, 0x7d, 0xbc, 0x3a, 0x4f,
+  0xb7, 0x63, 0xaa, 0xe6, 0xfe, 0x7e, 0xb5, 0xb1, 0xa8, 0x53, 0xf3, 0x84, 0xb0, 0x67, 0x31, 0xc4,
+  0xb9, 0xb8, 0x93, 0x23, 0x96, 0x54, 0xb6, 0x22, 0x1d, 0x2d, 0x7c, 0x1d, 0xce, 0x0b, 0xbb, 0xc2,
+  0x3d, 0xa1, 0xaa, 0x4a, 0xba, 0xee, 0x98, 0x60, 0x54, 0x11, 0xb8, 0x2f, 0xbf, 0x10, 0xca, 0x09,
+  0x86, 0xfa, 0x10, 0xcd, 0x7d, 0x40, 0x5d, 0x84, 0xf8, 0x0f, 0x97, 0xf9, 0xdd, 0xa4, 0x42, 0x33,
+  0xe1, 0x72, 0x67, 0xaa, 0xc8, 0x1c, 0xb1, 0x1c, 0xa1, 0x8b, 0x53, 0xf9, 0x6e, 0xe8, 0x26, 0x11,
+  0x33, 0x19, 0x73, 0x35, 0x26, 0x21, 0x86, 0xe8, 0xdc, 0x5d, 0xa4, 0x78, 0xa1, 0xaa, 0x93, 0xd0,
+  0x23, 0xad, 0xef, 0x76, 0x55, 0xc3, 0x69, 0x52, 0xf7, 0x5a, 0x6a, 0xc2, 0xfa, 0x5e, 0x21, 0x7c,
+  0xd6, 0x54, 0xd9, 0xed, 0xd5, 0x13, 0xa3, 0xda, 0xed, 0xd5, 0x87, 0x61, 0x55, 0xd5, 0x2d, 0xf4,
+  0xcf, 0x90, 0x25, 0x51, 0x87, 0x17, 0xd8, 0x63, 0x3c, 0x77, 0xf2, 0xec, 0x37, 0x97, 0xbe, 0x5d,
+  0x03, 0x34, 0xff, 0x18, 0x5f, 0xe7, 0xc8, 0xce, 0x68, 0x52, 0x71, 0x83, 0x36, 0x56, 0x55, 0x1f,
+  0xb9, 0xcc, 0xef, 0x60, 0xce, 0xde, 0x7c, 0x59, 0xab, 0x06, 0x45, 0xa7, 0x45, 0x9c, 0x9c, 0xbd,
+  0x5f, 0xae, 0xf0, 0x97, 0x06, 0x28, 0x8f, 0xee, 0x92, 0x9b, 0xd4, 0x7a, 0x17, 0xba, 0xe3, 0x9b,
+  0xab, 0x88, 0xf1, 0x47, 0xc7, 0xbb, 0x22, 0x5a, 0x17, 0xbb, 0xe2, 0x49, 0xf3, 0xb6, 0xa4, 0xed,
+  0x9b, 0xc2, 0x96, 0x60, 0xce, 0xeb, 0x9f, 0x2e, 0x07, 0xaa, 0x56, 0xe3, 0x64, 0x0d, 0x35, 0xb1,
+  0x11, 0x3a, 0x65, 0x64, 0x09, 0x8e, 0xa8, 0x7a, 0x1a, 0x10, 0xc3, 0xc3, 0xd3, 0xaf, 0x42, 0x74,
+  0xac, 0xa2, 0xf7, 0x8c, 0xa6, 0x0c, 0xdb, 0x11, 0xb8, 0xfd, 0x65, 0xbb, 0x91, 0xe5, 0x82, 0x46,
+  0x18, 0xcd, 0x7f, 0x83, 0xba, 0x40, 0x97, 0x6a, 0x08, 0x94, 0xe5, 0xf7, 0x73, 0x5e, 0x0e, 0xc6,
+  0x9d, 0xe6, 0xb7, 0x28, 0x67, 0xe0, 0x6e, 0xfd, 0xbf, 0xa8, 0x4f, 0x55, 0x38, 0xb8, 0x1c, 0x17,
+  0x9a, 0x90, 0x0a, 0xe4, 0x94, 0xba, 0xab, 0x6e, 0x35, 0xb5, 0x22, 0xe9, 0x60, 0xb5, 0x93, 0x4a,
+  0x74, 0x34, 0xa1, 0x1a, 0xfe, 0x85, 0xca, 0x82, 0xd9, 0xf9, 0x3d, 0x83, 0xc8, 0xea, 0xe2, 0x4e,
+  0xfc, 0xa0, 0x79, 0x07, 0x2e, 0xd8, 0xdc, 0x5f, 0x60, 0xd3, 0x5e, 0xcf, 0x1b, 0xc8, 0xf2, 0x39,
+  0xbb, 0x55, 0x2c, 0xdb, 0x7b, 0x5f, 0xda, 0x51, 0x01, 0x36, 0x00, 0x61, 0x36, 0x4b, 0x4c, 0x0c,
+  0xbb, 0x3a, 0xc8, 0xc4, 0xde, 0x1d, 0x69, 0x7f, 0x49, 0x3b, 0x0f, 0x27, 0xeb, 0x4f, 0x85, 0x5f,
+  0x78, 0xf4, 0x92, 0xe3, 0x18, 0xcd, 0xab, 0x93, 0xfd, 0x64, 0xde, 0x5e, 0x96, 0xe2, 0xe7, 0xdf,
+  0xd4, 0x7d, 0xc1, 0x42, 0xa2, 0xaa, 0x32, 0xea, 0xdd, 0x54, 0x51, 0x98, 0x98, 0xba, 0x47, 0x28,
+  0xd5, 0x12, 0xbd, 0xe0, 0xb1, 0x60, 0xfb, 0x88, 0xf9, 0x32, 0x84, 0x3a, 0xe7, 0x97, 0xfa, 0xcf,
+  0xb7, 0x93, 0x25, 0xfa, 0xee, 0xa2, 0x3b, 0xb0, 0x49, 0x96, 0x17, 0x2a, 0x6d, 0xce, 0x1a, 0x6c,
+  0xfe, 0x56, 0xe2, 0x03, 0xd8, 0xab, 0x93, 0x8f, 0xcd, 0x8a, 0x02, 0x29, 0xd9, 0x43, 0xf7, 0x96,
+  0xf8, 0x0f, 0xa7, 0x75, 0x85, 0xaa, 0xad, 0xfe, 0xff, 0x9b, 0x49, 0x78, 0x48, 0x45, 0x73, 0x76,
+  0x55, 0xc3, 0x3e, 0xf6, 0x66, 0x6a, 0xb7, 0x3f, 0x96, 0x3a, 0x64, 0xa0, 0xb2, 0x40, 0x38, 0x81,
+  0x1f, 0x35, 0x17, 0xf1, 0xaa, 0x91, 0x13, 0xbb, 0x5f, 0x56, 0xda, 0xa0, 0x93, 0x43, 0x53, 0xe1,
+  0x10, 0x0d, 0x52, 0x4d, 0xf8, 0xf0, 0xc4, 0x5c, 0xff, 0xab, 0xb7, 0xe2, 0xc4, 0x4d, 0x1a, 0x2f,
+  0xff, 0x2c, 0xd0, 0x09, 0x40, 0x3b, 0xd5, 0xed, 0xbc, 0x7a, 0xa4, 0x17, 0x79, 0xa2, 0x59, 0xc9,
+  0xd0, 0xf4, 0xdd, 0x3c, 0xc7, 0x46, 0xcd, 0x3f, 0x36, 0xae, 0xb7, 0xd8, 0x1f, 0x5f, 0x48, 0xd5,
+  0x75, 0xac, 0x50, 0x63, 0x5b, 0xbd, 0x85, 0x5a, 0xca, 0x00, 0x2a, 0xe1, 0xa4, 0x46, 0x23, 0x72,
+  0x9c, 0xb8, 0x6f, 0x41, 0x4a, 0x7d, 0xc7, 0xc4, 0x3e, 0xbb, 0x0c, 0x41, 0x9a, 0x10, 0xe5, 0x62,
+  0x0a, 0xae, 0x9d, 0xbe, 0xc4, 0x84, 0x49, 0xac, 0x31, 0xf1, 0x6c, 0xd0, 0x79, 0x43, 0xe8, 0x2d,
+  0x26, 0x12, 0x77, 0xea, 0xc9, 0x84, 0xc6, 0x92, 0x91, 0xbf, 0xd8, 0x0a, 0x95, 0x98, 0x4b, 0xcc,
+  0x00, 0x5d, 0xa6, 0xe6, 0xc4, 0x43, 0x9d, 0x88, 0x98, 0xa8, 0xd0, 0xf5, 0xa1, 0xe7, 0x85, 0x42,
+  0x7e, 0x23, 0xec, 0x0a, 0x91, 0x23, 0x79, 0xde, 0x3e, 0x84, 0x1e, 0x48, 0x43, 0x36, 0x4e, 0x3c,
+  0x73, 0x73, 0x81, 0xc3, 0x00, 0xa7, 0xed, 0xac, 0x0b, 0x38, 0xd5, 0xac, 0xad, 0x21, 0x26, 0x15,
+  0xde, 0x1a, 0x20, 0x4d, 0xac, 0x41, 0x9d, 0x81, 0xe6, 0xca, 0x41, 0xa9, 0x84, 0x2a, 0x20, 0x77,
+  0xb6, 0xa8, 0x2b, 0x5c, 0xce, 0x69, 0x5e, 0xf3, 0x6e, 0x62, 0x16, 0x89, 0x9d, 0xfd, 0xda, 0xc9,
+  0xcb, 0x3c, 0xa4, 0x29, 0x97, 0xe0, 0x86, 0xd2, 0x5a, 0xa0, 0x87, 0xf4, 0x0f, 0xae, 0x41, 0x53,
+  0x91, 0xfd, 0x8f, 0x5a, 0x55, 0xa3, 0x4a, 0x90, 0xbb, 0x60, 0xec, 0x43, 0x49, 0x8e, 0xb5, 0xa3,
+  0xbb, 0xd0, 0xba, 0x36, 0xf0, 0x61, 0x6a, 0x4f, 0xc5, 0x55, 0x08, 0x3d, 0x3c, 0x5b, 0x69, 0x08,
+  0x0d, 0x2b, 0xf4, 0x12, 0x0c, 0x9e, 0xfb, 0xeb, 0xa2, 0xba, 0x6e, 0x5d, 0xa8, 0xd3, 0xdb, 0x1c,
+  0xa2, 0x22, 0x76, 0x7b, 0x4b, 0xa8, 0x43, 0xd1, 0xc0, 0x86, 0xa5, 0xbe, 0x50, 0xb0, 0x17, 0x78,
+  0xfe, 0x7c, 0x13, 0x7c, 0xda, 0xc6, 0x95, 0x62, 0xcc, 0xbe, 0x74, 0x91, 0xe5, 0xdf, 0x49, 0x7a,
+  0xc4, 0x4d, 0x52, 0x77, 0xb8, 0x4c, 0x92, 0x6d, 0x7f, 0x7a, 0xe5, 0xfe, 0x0f, 0x2b, 0x8e, 0x24,
+  0x2b, 0x00, 0xa0, 0x00, 0x00,
+};
@@ -0,0 +1,137 @@
+// OTA stream writer against a real `gzip -9` image: every chunking of the
+// upload and every tinfl read-ahead (0..4 bytes past the deflate end) must
+// give back the image with its CRC, size and SHA-256; truncated, corrupt and
+// padded uploads must fail
+#define USE_WIFI 1
+
+#include <unity.h>
+#include "clock.cpp"
+#include "modules/ota_stream.cpp"
+#include "firmware_gz.h"
+
+#include <vector>
+
+static uint32_t s_services;
+void otaServiceCriticalTasks() { s_services++; }
+
+// 40 KiB stand-in for a firmware image: an 0xE9 header, then log-like lines
+// with pseudo-random numbers, so deflate uses back-references across the
+// whole 32 KiB window
+static std::vector<uint8_t> makePayload() {
+  std::vector<uint8_t> p = {0xE9, 0x03, 0x02, 0x20};
+  uint32_t x = 12345;
+  char line[48];
+  while (p.size() < 40u * 1024u) {
+    x = x * 1103515245u + 12345u;
+    const int n = snprintf(line, sizeof line, "fan%u rpm %04u duty %02u\n",
+                           (unsigned)(x >> 30), (unsigned)((x >> 12) % 3000), (unsigned)((x >> 4) % 100));
+    p.insert(p.end(), line, line + n);
+  }
+  p.resize(40u * 1024u);
+  return p;
+}
+
+static const char kPayloadSha[] = "9e304327703061905fa19480713e8534d5da9bedd71ee2481236a36e9e8a4125";
+
+static std::vector<uint8_t> gz() { return std::vector<uint8_t>(kFirmwareGz, kFirmwareGz + sizeof(kFirmwareGz)); }
+
+// Upload in chunks of chunk bytes (last one shorter); false if any step failed
+static bool upload(std::vector<uint8_t> img, size_t chunk, const char* sha = kPayloadSha) {
+  if (!otaStreamBegin(sha)) return false;
+  for (size_t i = 0; i < img.size(); i += chunk) {
+    const size_t n = img.size() - i < chunk ? img.size() - i : chunk;
+    if (!otaStreamWrite(img.data() + i, n)) return false;
+  }
+  return otaStreamEnd();
+}
+
+void setUp() {
+  g_tinflReadAhead = 4;
+  s_services = 0;
+}
+void tearDown() {}
+
+void test_sha_shim_matches_payload() {
+  const std::vector<uint8_t> p = makePayload();
+  TEST_ASSERT_TRUE(upload(p, p.size()));
+  TEST_ASSERT_FALSE(otaStreamStats().gzip);
+  TEST_ASSERT_EQUAL_STRING(kPayloadSha, otaStreamStats().sha256);
+}
+
+void test_gzip_every_chunking_and_read_ahead() {
+  const std::vector<uint8_t> p = makePayload();
+  static const size_t kChunks[] = {1, 3, 7, 8, 9, 511, 1436, 4096, 8192, sizeof(kFirmwareGz)};
+  for (size_t ra = 0; ra <= 4; ++ra) {
+    for (size_t chunk : kChunks) {
+      g_tinflReadAhead = ra;
+      char msg[64];
+      snprintf(msg, sizeof msg, "read-ahead %u, chunk %u", (unsigned)ra, (unsigned)chunk);
+      TEST_ASSERT_TRUE_MESSAGE(upload(gz(), chunk), msg);
+      TEST_ASSERT_EQUAL_STRING_MESSAGE("", otaStreamError(), msg);
+      TEST_ASSERT_TRUE_MESSAGE(otaStreamStats().gzip, msg);
+      TEST_ASSERT_EQUAL_UINT32_MESSAGE(sizeof(kFirmwareGz), otaStreamStats().bytesIn, msg);
+      TEST_ASSERT_EQUAL_UINT32_MESSAGE(p.size(), otaStreamStats().bytesOut, msg);
+      TEST_ASSERT_TRUE_MESSAGE(Update.ended && Update.image == p, msg);
+    }
+  }
+  TEST_ASSERT_TRUE(s_services >= p.size() / OTA_SLICE_BYTES);
+}
+
+void test_truncated_upload_fails() {
+  for (size_t cut : {1, 4, 5, 8, 9, 100}) {
+    std::vector<uint8_t> img = gz();
+    img.resize(img.size() - cut);
+    TEST_ASSERT_FALSE(upload(img, 1436));
+    TEST_ASSERT_FALSE(Update.ended);
+  }
+}
+
+void test_trailing_bytes_fail() {
+  for (size_t extra : {1, 8, 9, 64}) {
+    std::vector<uint8_t> img = gz();
+    img.insert(img.end(), extra, 0x00);
+    TEST_ASSERT_FALSE(upload(img, 1436));
+    TEST_ASSERT_FALSE(Update.ended);
+  }
+  std::vector<uint8_t> img = gz();
+  img.insert(img.end(), 9, 0x00);
+  TEST_ASSERT_FALSE(upload(img, img.size()));
+  TEST_ASSERT_EQUAL_STRING("Trailing data after gzip stream", otaStreamError());
+}
+
+void test_corrupt_trailer_and_body_fail() {
+  std::vector<uint8_t> img = gz();
+  img[img.size() - 8] ^= 0x01;                        // CRC32
+  TEST_ASSERT_FALSE(upload(img, 1436));
+  TEST_ASSERT_EQUAL_STRING("gzip CRC/size mismatch", otaStreamError());
+
+  img = gz();
+  img[img.size() - 1] ^= 0x01;                        // ISIZE
+  TEST_ASSERT_FALSE(upload(img, 1436));
+  TEST_ASSERT_EQUAL_STRING("gzip CRC/size mismatch", otaStreamError());
+
+  img = gz();
+  img[img.size() / 2] ^= 0x40;                        // deflate body
+  TEST_ASSERT_FALSE(upload(img, 1436));
+  TEST_ASSERT_FALSE(Update.ended);
+}
+
+void test_sha_mismatch_fails() {
+  char wrong[65];
+  memcpy(wrong, kPayloadSha, sizeof(wrong));
+  wrong[0] = wrong[0] == '0' ? '1' : '0';
+  TEST_ASSERT_FALSE(upload(gz(), 4096, wrong));
+  TEST_ASSERT_EQUAL_STRING("SHA-256 mismatch", otaStreamError());
+  TEST_ASSERT_FALSE(Update.ended);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_sha_shim_matches_payload);
+  RUN_TEST(test_gzip_every_chunking_and_read_ahead);
+  RUN_TEST(test_truncated_upload_fails);
+  RUN_TEST(test_trailing_bytes_fail);
+  RUN_TEST(test_corrupt_trailer_and_body_fail);
+  RUN_TEST(test_sha_mismatch_fails);
+  return UNITY_END();
+}
@@ -0,0 +1,172 @@
+// Every page rendered through DisplayManager on the GxEPD2 shim, with a
+// full and an empty host state: nothing may be drawn off the 200x200 panel
+// (text that does not fit), and the mirror frame behind /screen.pbm must
+// match what was drawn
+#define USE_DALLAS 0
+
+#include <unity.h>
+#include "clock.cpp"
+#include "modules/sched.cpp"
+#include "modules/tach_core.cpp"
+#include "modules/fans.cpp"
+#include "modules/fancal.cpp"
+#include "modules/fanctrl.cpp"
+#define s_winUs s_profWinUs                 // sched.cpp has one too
+#include "modules/prof.cpp"
+#undef s_winUs
+#include "display_manager.cpp"
+#include "ui_theme.cpp"
+#include "pages/page_overview.cpp"
+#include "pages/page_disks.cpp"
+#define textW          textW_vms        // same-named file-local helpers as page_disks.cpp
+#define drawStatusIcon drawStatusIcon_vms
+#include "pages/page_vms.cpp"
+#undef textW
+#undef drawStatusIcon
+#include "pages/page_network.cpp"
+#include "pages/page_debug.cpp"
+#include "pages/page_alert.cpp"
+
+static DisplayManager g_disp;
+static PageOverview   g_pageOverview;
+static PageDisks      g_pageDisks;
+static PageVMs        g_pageVMs;
+static PageNetwork    g_pageNetwork;
+static PageDebug      g_pageDebug;
+static PageAlert      g_pageAlert;
+
+static HostState g_host;
+static UiState   g_ui;
+
+struct Named { const char* name; IPage* page; };
+static const Named kPages[] = {
+  {"overview", &g_pageOverview}, {"disks", &g_pageDisks}, {"vms", &g_pageVMs},
+  {"network", &g_pageNetwork},   {"debug", &g_pageDebug}, {"alert", &g_pageAlert},
+};
+
+static bool black(int16_t x, int16_t y) {
+  return g_disp.display().frame()[y * EpdMirror::STRIDE + (x >> 3)] & (0x80 >> (x & 7));
+}
+
+static uint32_t blackBelow(int16_t y0) {
+  uint32_t n = 0;
+  for (int16_t y = y0; y < EpdMirror::FRAME_H; ++y)
+    for (int16_t x = 0; x < EpdMirror::FRAME_W; ++x) n += black(x, y);
+  return n;
+}
+
+// A busy host with the longest values the parser accepts
+static void fullHost(HostState& h) {
+  h = HostState();
+  h.uptime_sec = 123u * 86400u + 23u * 3600u;
+  strcpy(h.hostname, "pve-node-with-a-long-name");
+  h.cpu_percent = 100.0f;
+  h.load1 = 12.5f; h.load5 = 10.25f; h.load15 = 8.0f;
+  h.ram_total = 256ull << 30; h.ram_used = 255ull << 30;
+  h.fs_root_total = 4000ull << 30; h.fs_root_used = 3999ull << 30;
+  h.vms_running = 99; h.vms_total = 99; h.lxcs_running = 99; h.lxcs_total = 99;
+  h.vm_list_count = h.lxc_list_count = MAX_GUESTS;
+  for (uint8_t i = 0; i < MAX_GUESTS; ++i) {
+    h.vm_list[i].id = 100 + i;  strcpy(h.vm_list[i].name, "windows-server-22");
+    h.vm_list[i].running = i & 1;
+    h.lxc_list[i].id = 200 + i; strcpy(h.lxc_list[i].name, "container-number1");
+    h.lxc_list[i].running = !(i & 1);
+  }
+  h.disk_count = MAX_DISKS;
+  for (uint8_t i = 0; i < MAX_DISKS; ++i) {
+    snprintf(h.disks[i].name, sizeof(h.disks[i].name), "nvme%un1-data%u", i, i);
+    h.disks[i].temp_c = (int16_t)(30 + 10 * i);
+    h.disks[i].active = i & 1;
+  }
+  strcpy(h.primary_ifname, "enp0s31f6vmbr0");
+  strcpy(h.primary_ipv4, "192.168.178.254/24");
+  strcpy(h.gateway_ipv4, "192.168.178.1");
+  strcpy(h.ip_status, "static");
+  h.net_rx_kbps = 9999999.0f; h.net_tx_kbps = 123.4f; h.net_window_s = 60;
+  h.local_temp_c = 38.5f;
+  h.local_temp_count = 2; h.local_temps_c[0] = 38.5f; h.local_temps_c[1] = -12.25f;
+  for (uint8_t ch = 0; ch < MAX_FANS; ++ch) {
+    h.fan[ch].duty_cmd = 100.0f; h.fan[ch].duty_filt = 99.9f; h.fan[ch].active = 1;
+    h.fan[ch].fault = FAN_DEGRADED;
+  }
+  h.fan_ff_pct = 20.0f;
+  h.last_json = "{\"uptime_s\":10622800,\"hostname\":\"pve-node-with-a-long-name\"}";
+}
+
+static void renderAll(const char* state) {
+  for (const Named& p : kPages) {
+    EpdMirror& d = g_disp.display();
+    const uint32_t pages = d.pages, glyphs = d.glyphs, off = d.offscreen;
+    g_disp.renderPage(*p.page, g_host, g_ui);
+    char msg[64];
+    snprintf(msg, sizeof msg, "%s page, %s host", p.name, state);
+    TEST_ASSERT_TRUE_MESSAGE(d.pages == pages + 1, msg);
+    TEST_ASSERT_TRUE_MESSAGE(d.glyphs > glyphs, msg);
+    TEST_ASSERT_TRUE_MESSAGE(blackBelow(ui::HEADER_H) > 0, msg);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, d.offscreen - off, msg);   // nothing clipped
+  }
+}
+
+void setUp() {
+  g_ui   = UiState();
+  WiFi.connected = true;
+}
+void tearDown() {}
+
+void test_pages_fit_with_full_host() {
+  g_disp.display().offscreen = 0;
+  fullHost(g_host);
+  g_ui.parseOkCount = 123456; g_ui.parseErrCount = 7; g_ui.lastJsonLen = 4095;
+  renderAll("full");
+}
+
+void test_pages_fit_with_no_host() {
+  g_disp.display().offscreen = 0;
+  g_host = HostState();
+  WiFi.connected = false;
+  renderAll("empty");
+}
+
+void test_header_and_stale_tag() {
+  g_host = HostState();
+  g_disp.renderPage(g_pageOverview, g_host, g_ui);
+  TEST_ASSERT_FALSE(black(1, 1));
+  for (int16_t x = 0; x < EpdMirror::FRAME_W; ++x) TEST_ASSERT_TRUE(black(x, ui::HEADER_H - 1));
+
+  g_ui.stale = true;
+  g_disp.renderPage(g_pageOverview, g_host, g_ui);
+  TEST_ASSERT_TRUE(black(1, 1));                 // inverted STALE tag, top-left
+}
+
+void test_rotation_and_alert_page() {
+  g_host = HostState();
+  const uint32_t n0 = g_disp.renderCount();
+  g_ui.debugEnabled = true;
+  TEST_ASSERT_EQUAL(DEBUG_IN_ROTATION ? 5 : 4, g_disp.pageCount(g_ui));
+  g_ui.debugEnabled = false;
+  TEST_ASSERT_EQUAL(4, g_disp.pageCount(g_ui));
+
+  g_ui.currentPage = 200;                        // out of range: first page instead
+  g_disp.renderCurrent(g_host, g_ui);
+  g_ui.alertShown = true;
+  g_disp.renderCurrent(g_host, g_ui);
+  TEST_ASSERT_EQUAL_UINT32(n0 + 2, g_disp.renderCount());
+}
+
+int main(int, char**) {
+  fansBegin();
+  g_disp.begin();
+  g_disp.registerPage(&g_pageOverview, false);
+  g_disp.registerPage(&g_pageDisks, false);
+  g_disp.registerPage(&g_pageVMs, false);
+  g_disp.registerPage(&g_pageNetwork, false);
+  g_disp.registerPage(&g_pageDebug, true);
+  g_disp.setAlertPage(&g_pageAlert);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_pages_fit_with_full_host);
+  RUN_TEST(test_pages_fit_with_no_host);
+  RUN_TEST(test_header_and_stale_tag);
+  RUN_TEST(test_rotation_and_alert_page);
+  return UNITY_END();
+}
@@ -0,0 +1,145 @@
+// Q16.16 fan loop vs a float reference of the same pipeline (curves → max
+// mix → rate limit → EMA → hysteresis/dwell → kick → min duty), tick by
+// tick over a day of random-walk inputs
+#define FAN_CTRL_MODE 0
+#define FAN_HW_FADE   0   // software rate limit is part of the comparison
+#define FAN_USE_FF    0   // own suite (test_ff_bound)
+#define USE_FANCAL    0
+
+#include <unity.h>
+#include "clock.cpp"
+#include "modules/tach_core.cpp"
+#include "modules/fans.cpp"
+#include "modules/fanctrl.cpp"
+
+static HostState g_host;
+static UiState   g_ui;
+
+// ---- float reference ----
+static float curveF(const CurvePt* pt, float x) {
+  if (x <= pt[0].c) return pt[0].p;
+  for (int i = 0; i < 4; ++i) {
+    if (x <= pt[i + 1].c) return pt[i].p + (x - pt[i].c) * (pt[i + 1].p - pt[i].p) / (pt[i + 1].c - pt[i].c);
+  }
+  return pt[4].p;
+}
+
+struct RefChan {
+  float    cmd = 0, out = 0;
+  bool     on = false;
+  uint32_t changed = 0, kickUntil = 0;
+  bool     kickOn = false;
+  int      pct = 0;
+  float    applyF = 0;     // before rounding (ties are allowed to differ)
+};
+
+static void refTick(RefChan& r, float caseC, int hotDisk, float cpu, uint32_t now, uint32_t dtMs) {
+  float cmd = curveF(kCurves[0], caseC);
+  if (hotDisk > -127) cmd = fmaxf(cmd, curveF(kDiskCurve, (float)hotDisk));
+  if (!isnan(cpu))    cmd = fmaxf(cmd, curveF(kCpuCurve, cpu));
+  r.cmd = fminf(fmaxf(cmd, 0.0f), 100.0f);
+
+  const float rate    = FAN_RATE_PCT_PER_S * dtMs / 1000.0f;
+  const float limited = fminf(fmaxf(r.cmd, r.out - rate), r.out + rate);
+  r.out += (limited - r.out) * FAN_ALPHA_Q8 / 256.0f;
+
+  float apply = r.out;
+  if (!r.on) {
+    apply = 0;
+    if (now - r.changed >= FAN_MIN_OFF_MS && r.cmd >= FAN_ON_ABOVE_PCT) {
+      r.on = true; r.changed = now; r.kickUntil = now + FAN_KICK_MS; r.kickOn = true;
+      apply = FAN_ON_ABOVE_PCT;
+    }
+  } else {
+    if (apply < FAN_OFF_BELOW_PCT) apply = FAN_OFF_BELOW_PCT;
+    if (now - r.changed >= FAN_MIN_ON_MS && r.cmd < FAN_OFF_BELOW_PCT) {
+      r.on = false; r.changed = now; apply = 0; r.kickOn = false;
+    }
+  }
+  if (r.kickOn && (int32_t)(r.kickUntil - now) > 0) apply = FAN_KICK_PCT;
+  else r.kickOn = false;
+  r.applyF = fminf(fmaxf(apply, 0.0f), 100.0f);
+  r.pct    = (int)lroundf(r.applyF);
+  if (r.pct > 0 && r.pct < FAN1_MIN_DUTY_PCT) r.pct = FAN1_MIN_DUTY_PCT;
+}
+
+// ---- inputs: bounded random walks, 1/16 °C Dallas steps ----
+static uint32_t s_lcg = 12345;
+static float rnd() { s_lcg = s_lcg * 1664525u + 1013904223u; return (float)(s_lcg >> 8) / 16777216.0f; }
+static float walk(float v, float step, float lo, float hi) {
+  v += (rnd() - 0.5f) * 2.0f * step;
+  return v < lo ? lo : (v > hi ? hi : v);
+}
+
+struct Worst { float cmd = 0, out = 0; uint32_t stateDiff = 0, pctDiff = 0, ties = 0; };
+
+static Worst run(uint32_t ticks, bool hostInputs) {
+  fansBegin();
+  fanCtrlBegin();
+  RefChan ref;
+  ref.changed = clockMs();
+  Worst w;
+  float caseC = 33.0f, cpu = 20.0f, disk = 40.0f;
+  uint32_t last = clockMs();
+  for (uint32_t i = 0; i < ticks; ++i) {
+    clockAdvanceMs(FAN_TICK_MS);
+    const uint32_t now = clockMs();
+    caseC = walk(caseC, 0.08f, 28.0f, 58.0f);
+    cpu   = walk(cpu, 3.0f, 0.0f, 100.0f);
+    disk  = walk(disk, 0.3f, 30.0f, 60.0f);
+    g_host.local_temp_c = roundf(caseC * 16.0f) / 16.0f;
+    if (hostInputs) {
+      g_host.cpu_percent = roundf(cpu * 10.0f) / 10.0f;
+      g_host.disk_count  = 1;
+      g_host.disks[0].active = true;
+      g_host.disks[0].temp_c = (int16_t)lroundf(disk);
+      g_ui.lastParseOkMs = now;
+    }
+    fanCtrlTick(g_host, g_ui);
+    refTick(ref, g_host.local_temp_c, hostInputs ? g_host.disks[0].temp_c : -127,
+            hostInputs ? g_host.cpu_percent : NAN, now, now - last);
+    last = now;
+
+    const FanTelemetry& t = g_host.fan[0];
+    w.cmd = fmaxf(w.cmd, fabsf(t.duty_cmd - ref.cmd));
+    w.out = fmaxf(w.out, fabsf(t.duty_filt - ref.out));
+    if (s_ch[0].onLatched != ref.on) w.stateDiff++;
+    if (fanPwmGetPercent(0) != ref.pct) {
+      const float frac = ref.applyF - floorf(ref.applyF);
+      if (fabsf(frac - 0.5f) < 0.01f) w.ties++;
+      else w.pctDiff++;
+    }
+  }
+  char msg[140];
+  snprintf(msg, sizeof msg, "max |cmd| %.5f %%, max |out| %.5f %%, state %u, pct %u (+%u ties), %u toggles",
+           w.cmd, w.out, w.stateDiff, w.pctDiff, w.ties, (unsigned)fanCtrlStats(0).toggles);
+  TEST_MESSAGE(msg);
+  return w;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// One LSB of Q16.16 is 1.5e-5 %; the EMA truncates once per tick
+void test_case_only_day() {
+  const Worst w = run(432000, false);          // 24 h at 5 Hz
+  TEST_ASSERT_TRUE(w.cmd < 0.001f);
+  TEST_ASSERT_TRUE(w.out < 0.01f);
+  TEST_ASSERT_EQUAL_UINT32(0, w.stateDiff);
+  TEST_ASSERT_EQUAL_UINT32(0, w.pctDiff);
+}
+
+void test_with_disk_and_cpu() {
+  const Worst w = run(432000, true);
+  TEST_ASSERT_TRUE(w.cmd < 0.001f);
+  TEST_ASSERT_TRUE(w.out < 0.01f);
+  TEST_ASSERT_EQUAL_UINT32(0, w.stateDiff);
+  TEST_ASSERT_EQUAL_UINT32(0, w.pctDiff);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_case_only_day);
+  RUN_TEST(test_with_disk_and_cpu);
+  return UNITY_END();
+}
@@ -0,0 +1,156 @@
+// TachCore: median/outlier rejection, the ISR glitch gate, stop detection
+// and window timing, fed with synthetic edge trains on the virtual clock
+#include <unity.h>
+#include <vector>
+#include "clock.cpp"
+#include "modules/tach_core.cpp"
+
+static constexpr uint32_t kTickUs = SCHED_SENSORS_MS * 1000U; // fansTick() cadence
+static TachCore t;
+
+// Edges every periodUs for ms, starting one period after from
+static std::vector<uint64_t> train(uint64_t from, uint32_t periodUs, uint32_t ms) {
+  std::vector<uint64_t> e;
+  for (uint64_t ts = from + periodUs; ts <= from + (uint64_t)ms * 1000U; ts += periodUs) e.push_back(ts);
+  return e;
+}
+
+// Replay the edges through the ISR body, ticking like the sensors job
+static void feed(const std::vector<uint64_t>& edges, uint64_t endUs) {
+  size_t i = 0;
+  for (uint64_t tick = g_clockVirtUs + kTickUs; tick <= endUs; tick += kTickUs) {
+    while (i < edges.size() && edges[i] <= tick) {
+      g_clockVirtUs = edges[i++];
+      tachCoreEdge(t);
+    }
+    g_clockVirtUs = tick;
+    tachCoreTick(t);
+  }
+}
+
+static int rpmFor(uint32_t periodUs) { return (int)(60000000UL / (periodUs * 2U)); }
+
+void setUp() {
+  g_clockVirtUs = g_clockVirtUs + 10000000U;   // quiet gap between tests
+  tachCoreBegin(t, 2, 500, 2000);
+}
+void tearDown() {}
+
+void test_steady_speed() {
+  const uint64_t t0 = g_clockVirtUs;
+  feed(train(t0, 20000, 3000), t0 + 3000000U);  // 1500 rpm
+  TEST_ASSERT_EQUAL_INT(1500, t.rpm);
+  TEST_ASSERT_EQUAL_UINT32(0, t.rejects);
+  TEST_ASSERT_EQUAL_UINT32(0, t.glitches);
+}
+
+void test_fast_fan_closes_window_early() {
+  const uint64_t t0 = g_clockVirtUs;
+  feed(train(t0, 10000, 2000), t0 + 2000000U);  // 3000 rpm: 12 periods in 120 ms
+  TEST_ASSERT_EQUAL_INT(3000, t.rpm);
+  TEST_ASSERT_LESS_OR_EQUAL(140, t.winMs);
+  TEST_ASSERT_GREATER_OR_EQUAL(12, t.seq);
+}
+
+// Ringing on the tach line: extra edges shortly after real ones
+void test_glitches_gated_in_isr() {
+  const uint64_t t0 = g_clockVirtUs;
+  std::vector<uint64_t> e;
+  for (uint64_t ts : train(t0, 20000, 3000)) {
+    e.push_back(ts);
+    if (e.size() % 3 == 0) e.push_back(ts + 150);    // inside the debounce floor
+    if (e.size() % 7 == 0) e.push_back(ts + 4000);   // inside the period-following gate
+  }
+  feed(e, t0 + 3000000U);
+  TEST_ASSERT_EQUAL_INT(1500, t.rpm);
+  TEST_ASSERT_GREATER_THAN(60, t.glitches);
+  TEST_ASSERT_LESS_OR_EQUAL(2, t.rejects);         // first window, before the gate has a period
+}
+
+// A late ISR (edge delayed by another interrupt) makes one long + one short period
+void test_late_edge_rejected() {
+  const uint64_t t0 = g_clockVirtUs;
+  std::vector<uint64_t> e = train(t0, 20000, 3000);
+  for (size_t i = 20; i < e.size(); i += 25) e[i] += 9000;
+  feed(e, t0 + 3000000U);
+  TEST_ASSERT_EQUAL_INT(1500, t.rpm);
+  TEST_ASSERT_GREATER_OR_EQUAL(2 * 5, t.rejects);    // both neighbours of each late edge
+}
+
+// A missed pulse doubles one period; the median throws it out
+void test_missed_pulse_rejected() {
+  const uint64_t t0 = g_clockVirtUs;
+  std::vector<uint64_t> e = train(t0, 20000, 3000);
+  for (size_t i = 30; i < e.size(); i += 30) e.erase(e.begin() + i);
+  feed(e, t0 + 3000000U);
+  TEST_ASSERT_EQUAL_INT(1500, t.rpm);
+  TEST_ASSERT_GREATER_OR_EQUAL(4, t.rejects);
+}
+
+// Only ~10% of the periods are jittered by up to ±40%: the mean of the inliers stays put
+void test_jitter_outliers_do_not_bias() {
+  const uint64_t t0 = g_clockVirtUs;
+  std::vector<uint64_t> e = train(t0, 16000, 4000);  // 1875 rpm
+  uint32_t lcg = 1;
+  for (size_t i = 1; i + 1 < e.size(); ++i) {
+    lcg = lcg * 1103515245u + 12345u;
+    if ((lcg >> 16) % 10 == 0) e[i] += 6400;             // +40% then -40%
+  }
+  feed(e, t0 + 4000000U);
+  TEST_ASSERT_INT_WITHIN(2, rpmFor(16000), t.rpm);
+}
+
+void test_speed_step_followed() {
+  uint64_t t0 = g_clockVirtUs;
+  feed(train(t0, 20000, 2000), t0 + 2000000U);       // 1500 rpm
+  t0 = g_clockVirtUs;
+  const uint64_t last = t.prevUs;
+  std::vector<uint64_t> e = train(last, 12500, 1200); // 2400 rpm
+  feed(e, t0 + 1000000U);
+  TEST_ASSERT_EQUAL_INT(2400, t.rpm);
+}
+
+void test_stop_decays_then_zero() {
+  const uint64_t t0 = g_clockVirtUs;
+  feed(train(t0, 20000, 1000), t0 + 1000000U);
+  TEST_ASSERT_EQUAL_INT(1500, t.rpm);
+  // The next (empty) window caps the speed at one pulse per time since the last edge
+  feed({}, t0 + 1000000U + 1100000U);
+  TEST_ASSERT_GREATER_THAN(0, t.rpm);
+  TEST_ASSERT_LESS_OR_EQUAL(60000000 / (900000 * 2), t.rpm);
+  feed({}, t0 + 1000000U + 2600000U);
+  TEST_ASSERT_EQUAL_INT(0, t.rpm);
+}
+
+void test_unknown_until_first_window() {
+  TEST_ASSERT_EQUAL_INT(-1, t.rpm);
+  const uint64_t t0 = g_clockVirtUs;
+  feed(train(t0, 20000, 100), t0 + 100000U);
+  TEST_ASSERT_EQUAL_INT(-1, t.rpm);                    // 4 periods, window still open
+}
+
+// Edge timestamps wrap at 2^32 µs (clockUs() every 71.6 min)
+void test_microsecond_wrap() {
+  g_clockVirtUs = (g_clockVirtUs | 0xFFFFFFFFull) + 1 - 1500000U;
+  tachCoreBegin(t, 2, 500, 2000);
+  const uint64_t t0 = g_clockVirtUs;
+  feed(train(t0, 20000, 3000), t0 + 3000000U);
+  TEST_ASSERT_EQUAL_INT(1500, t.rpm);
+  TEST_ASSERT_EQUAL_UINT32(0, t.rejects);
+  TEST_ASSERT_EQUAL_UINT32(0, t.glitches);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_steady_speed);
+  RUN_TEST(test_fast_fan_closes_window_early);
+  RUN_TEST(test_glitches_gated_in_isr);
+  RUN_TEST(test_late_edge_rejected);
+  RUN_TEST(test_missed_pulse_rejected);
+  RUN_TEST(test_jitter_outliers_do_not_bias);
+  RUN_TEST(test_speed_step_followed);
+  RUN_TEST(test_stop_decays_then_zero);
+  RUN_TEST(test_unknown_until_first_window);
+  RUN_TEST(test_microsecond_wrap);
+  return UNITY_END();
+}